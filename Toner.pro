@@ -29,20 +29,68 @@ SOURCES += \
     overtoneanalyzer.cpp \
     utils.cpp \
     datareader.cpp \
-    staticanalysisdialog.cpp
+    staticanalysisdialog.cpp \
+    ringbuffer.cpp
 
 HEADERS += \
     ffft/OscSinCos.hpp \
     ffft/OscSinCos.h \
+    ffft/OscSinCosLanes.hpp \
+    ffft/OscSinCosLanes.h \
     ffft/FFTRealUseTrigo.hpp \
     ffft/FFTRealUseTrigo.h \
     ffft/FFTRealSelect.hpp \
     ffft/FFTRealSelect.h \
+    ffft/FFTRealLanes.hpp \
+    ffft/FFTRealLanes.h \
+    ffft/FFTRealSimd.hpp \
+    ffft/FFTRealSimd.h \
+    ffft/FFTRealSimdSse2.hpp \
+    ffft/FFTRealSimdSse2.h \
+    ffft/FFTRealSimdAvx2.hpp \
+    ffft/FFTRealSimdAvx2.h \
+    ffft/FFTRealSimdAvx512.hpp \
+    ffft/FFTRealSimdAvx512.h \
+    ffft/FFTRealRadix4.hpp \
+    ffft/FFTRealRadix4.h \
     ffft/FFTRealPassInverse.hpp \
     ffft/FFTRealPassInverse.h \
     ffft/FFTRealPassDirect.hpp \
     ffft/FFTRealPassDirect.h \
     ffft/FFTRealFixLenParam.h \
+    ffft/FFTRealFixLenTables.hpp \
+    ffft/FFTRealFixLenTables.h \
+    ffft/FFTRealFixLenIface.h \
+    ffft/FFTRealFixLenImpl.hpp \
+    ffft/FFTRealFixLenImpl.h \
+    ffft/FFTRealFixLenFactory.hpp \
+    ffft/FFTRealFixLenFactory.h \
+    ffft/FFTRealPlanCache.hpp \
+    ffft/FFTRealPlanCache.h \
+    ffft/FFTRealSharedPlan.hpp \
+    ffft/FFTRealSharedPlan.h \
+    ffft/FFTAnyLen.hpp \
+    ffft/FFTAnyLen.h \
+    ffft/GoertzelBank.hpp \
+    ffft/GoertzelBank.h \
+    ffft/FFTConvolver.hpp \
+    ffft/FFTConvolver.h \
+    ffft/FFTComplex.hpp \
+    ffft/FFTComplex.h \
+    ffft/FFTRealAnyLen.hpp \
+    ffft/FFTRealAnyLen.h \
+    ffft/FFTRealDct.hpp \
+    ffft/FFTRealDct.h \
+    ffft/FFTRealEven.hpp \
+    ffft/FFTRealEven.h \
+    ffft/FFTRealLarge.hpp \
+    ffft/FFTRealLarge.h \
+    ffft/ThreadPool.hpp \
+    ffft/ThreadPool.h \
+    ffft/FFTRealPower.hpp \
+    ffft/FFTRealPower.h \
+    ffft/FFTRealSplit.hpp \
+    ffft/FFTRealSplit.h \
     ffft/FFTRealFixLen.hpp \
     ffft/FFTRealFixLen.h \
     ffft/FFTReal.hpp \
@@ -52,11 +100,17 @@ HEADERS += \
     ffft/def.h \
     ffft/Array.hpp \
     ffft/Array.h \
+    ffft/Allocator.h \
+    ffft/AllocatorHeap.hpp \
+    ffft/AllocatorHeap.h \
+    ffft/AllocatorArena.hpp \
+    ffft/AllocatorArena.h \
     maindialog.h \
     overtoneanalyzer.h \
     utils.h \
     datareader.h \
-    staticanalysisdialog.h
+    staticanalysisdialog.h \
+    ringbuffer.h
 
 FORMS += maindialog.ui \
     staticanalysisdialog.ui
@@ -0,0 +1,93 @@
+/*****************************************************************************
+
+        Allocator.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_Allocator_HEADER_INCLUDED)
+#define	ffft_Allocator_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cstddef>
+
+
+
+namespace ffft
+{
+
+
+
+// Memory source for DynArray. Blocks are raw storage, the caller constructs
+// and destroys the objects.
+class Allocator
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	virtual			~Allocator () {}
+
+	// Returns a block of at least size bytes, aligned on align bytes (power
+	// of 2). Throws std::bad_alloc when out of memory.
+	virtual void *	allocate (size_t size, size_t align) = 0;
+
+	// ptr is 0 or comes from allocate() on the same object
+	virtual void	deallocate (void *ptr) = 0;
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+							Allocator () {}
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+							Allocator (const Allocator &other);
+	Allocator &		operator = (const Allocator &other);
+	bool				operator == (const Allocator &other);
+	bool				operator != (const Allocator &other);
+
+};	// class Allocator
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_Allocator_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,125 @@
+/*****************************************************************************
+
+        AllocatorArena.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_AllocatorArena_HEADER_INCLUDED)
+#define	ffft_AllocatorArena_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/Allocator.h"
+#include	"ffft/AllocatorHeap.h"
+
+
+
+namespace ffft
+{
+
+
+
+// Bump allocator for objects that live and die together, like the buffers of
+// one analysis stream. deallocate() does nothing, the memory comes back with
+// reset() or when the arena is destroyed.
+// When a chunk is full, a new one is taken from the parent allocator. The
+// next reset() merges them, so the arena settles on a single chunk.
+// Not thread-safe.
+class AllocatorArena
+:	public Allocator
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	enum {			DEFAULT_CHUNK_SIZE	= 64 * 1024	};
+
+	explicit inline	AllocatorArena (size_t chunk_size = DEFAULT_CHUNK_SIZE, Allocator &parent = AllocatorHeap::use_instance ());
+	virtual inline	~AllocatorArena ();
+
+	inline void		reset ();
+	inline size_t	get_used () const;
+
+	// Allocator
+	virtual inline void *
+							allocate (size_t size, size_t align);
+	virtual inline void
+							deallocate (void *ptr);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	// Stored at the beginning of each chunk
+	class Chunk
+	{
+	public:
+		Chunk *		_prev_ptr;
+		size_t		_size;
+	};
+
+	inline void		add_chunk (size_t min_size);
+	inline size_t	compute_aligned_pos (size_t align) const;
+	inline void		release_chunks ();
+
+	Allocator &		_parent;
+	size_t			_chunk_size;
+	Chunk *			_chunk_ptr;	// Current chunk, 0 if none
+	size_t			_pos;		// In the current chunk, from its beginning
+	size_t			_used;	// Bytes given away since the last reset, padding included
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+							AllocatorArena (const AllocatorArena &other);
+	AllocatorArena &
+							operator = (const AllocatorArena &other);
+	bool				operator == (const AllocatorArena &other);
+	bool				operator != (const AllocatorArena &other);
+
+};	// class AllocatorArena
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/AllocatorArena.hpp"
+
+
+
+#endif	// ffft_AllocatorArena_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,215 @@
+/*****************************************************************************
+
+        AllocatorArena.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_AllocatorArena_CURRENT_CODEHEADER)
+	#error Recursive inclusion of AllocatorArena code header.
+#endif
+#define	ffft_AllocatorArena_CURRENT_CODEHEADER
+
+#if ! defined (ffft_AllocatorArena_CODEHEADER_INCLUDED)
+#define	ffft_AllocatorArena_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: ctor
+Input parameters:
+	- chunk_size: Size of the first chunk in bytes. Nothing is allocated
+		before the first request.
+	- parent: Where the chunks come from. Must outlive the arena.
+Throws: Nothing
+==============================================================================
+*/
+
+AllocatorArena::AllocatorArena (size_t chunk_size, Allocator &parent)
+:	_parent (parent)
+,	_chunk_size (chunk_size)
+,	_chunk_ptr (0)
+,	_pos (0)
+,	_used (0)
+{
+	assert (&parent != 0);
+}
+
+
+
+AllocatorArena::~AllocatorArena ()
+{
+	release_chunks ();
+}
+
+
+
+/*
+==============================================================================
+Name: reset
+Description:
+	Makes the whole arena available again. Everything allocated before must
+	have been released by its owner.
+	If several chunks were needed, they are replaced by a single one large
+	enough for all of them, allocated on the next request.
+Throws: Nothing
+==============================================================================
+*/
+
+void	AllocatorArena::reset ()
+{
+	if (_chunk_ptr != 0 && _chunk_ptr->_prev_ptr != 0)
+	{
+		size_t			total = 0;
+		for (Chunk *chunk_ptr = _chunk_ptr
+		;	chunk_ptr != 0
+		;	chunk_ptr = chunk_ptr->_prev_ptr)
+		{
+			total += chunk_ptr->_size;
+		}
+		release_chunks ();
+		if (total > _chunk_size)
+		{
+			_chunk_size = total;
+		}
+	}
+
+	_pos = sizeof (Chunk);
+	_used = 0;
+}
+
+
+
+// Bytes handed out since the last reset, alignment padding included. Gives
+// the chunk size for a single-chunk arena.
+size_t	AllocatorArena::get_used () const
+{
+	return (_used);
+}
+
+
+
+void *	AllocatorArena::allocate (size_t size, size_t align)
+{
+	assert (align > 0);
+	assert ((align & (align - 1)) == 0);
+
+	size_t			pos = 0;
+	if (_chunk_ptr != 0)
+	{
+		pos = compute_aligned_pos (align);
+	}
+	if (_chunk_ptr == 0 || pos + size > _chunk_ptr->_size)
+	{
+		// The chunk itself is only aligned on a cache line
+		add_chunk (sizeof (Chunk) + align - 1 + size);
+		pos = compute_aligned_pos (align);
+	}
+
+	_used += pos + size - _pos;
+	_pos = pos + size;
+
+	return (reinterpret_cast <char *> (_chunk_ptr) + pos);
+}
+
+
+
+void	AllocatorArena::deallocate (void *ptr)
+{
+	// Nothing, see reset()
+	(void) ptr;
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+void	AllocatorArena::add_chunk (size_t min_size)
+{
+	size_t			size = _chunk_size;
+	if (size < min_size)
+	{
+		size = min_size;
+	}
+
+	// Aligned on a cache line, like the blocks cut from it
+	void *			mem_ptr = _parent.allocate (size, 64);
+	Chunk *		chunk_ptr = static_cast <Chunk *> (mem_ptr);
+	chunk_ptr->_prev_ptr = _chunk_ptr;
+	chunk_ptr->_size = size;
+
+	_chunk_ptr = chunk_ptr;
+	_pos = sizeof (Chunk);
+}
+
+
+
+// First position from _pos where the address is a multiple of align. The
+// address is rounded, not the position: the chunk base may be less aligned.
+size_t	AllocatorArena::compute_aligned_pos (size_t align) const
+{
+	assert (_chunk_ptr != 0);
+
+	const size_t	base_adr = reinterpret_cast <size_t> (_chunk_ptr);
+	const size_t	aligned_adr = (base_adr + _pos + align - 1) & ~(align - 1);
+
+	return (aligned_adr - base_adr);
+}
+
+
+
+void	AllocatorArena::release_chunks ()
+{
+	while (_chunk_ptr != 0)
+	{
+		Chunk *		prev_ptr = _chunk_ptr->_prev_ptr;
+		_parent.deallocate (_chunk_ptr);
+		_chunk_ptr = prev_ptr;
+	}
+	_pos = 0;
+}
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_AllocatorArena_CODEHEADER_INCLUDED
+
+#undef ffft_AllocatorArena_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
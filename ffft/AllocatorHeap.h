@@ -0,0 +1,100 @@
+/*****************************************************************************
+
+        AllocatorHeap.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_AllocatorHeap_HEADER_INCLUDED)
+#define	ffft_AllocatorHeap_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/Allocator.h"
+
+
+
+namespace ffft
+{
+
+
+
+// Default allocator, on the free store. Stateless, so the shared instance
+// can be used from any thread.
+class AllocatorHeap
+:	public Allocator
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+							AllocatorHeap () {}
+	virtual			~AllocatorHeap () {}
+
+	static inline AllocatorHeap &
+							use_instance ();
+
+	// Allocator
+	virtual inline void *
+							allocate (size_t size, size_t align);
+	virtual inline void
+							deallocate (void *ptr);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+							AllocatorHeap (const AllocatorHeap &other);
+	AllocatorHeap &
+							operator = (const AllocatorHeap &other);
+	bool				operator == (const AllocatorHeap &other);
+	bool				operator != (const AllocatorHeap &other);
+
+};	// class AllocatorHeap
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/AllocatorHeap.hpp"
+
+
+
+#endif	// ffft_AllocatorHeap_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,123 @@
+/*****************************************************************************
+
+        AllocatorHeap.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_AllocatorHeap_CURRENT_CODEHEADER)
+	#error Recursive inclusion of AllocatorHeap code header.
+#endif
+#define	ffft_AllocatorHeap_CURRENT_CODEHEADER
+
+#if ! defined (ffft_AllocatorHeap_CODEHEADER_INCLUDED)
+#define	ffft_AllocatorHeap_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<new>
+
+#include	<cassert>
+#include	<cstdlib>
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+AllocatorHeap &	AllocatorHeap::use_instance ()
+{
+	static AllocatorHeap	instance;
+
+	return (instance);
+}
+
+
+
+/*
+==============================================================================
+Name: allocate
+Description:
+	Allocates an aligned block. The block is cut from a larger malloc() one,
+	whose address is stored right before the returned pointer.
+Input parameters:
+	- size: Number of bytes, >= 0.
+	- align: Alignment in bytes, power of 2, > 0.
+Returns: The aligned block, never 0.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+void *	AllocatorHeap::allocate (size_t size, size_t align)
+{
+	assert (align > 0);
+	assert ((align & (align - 1)) == 0);
+
+	if (align < sizeof (void *))
+	{
+		align = sizeof (void *);
+	}
+
+	void *			raw_ptr = std::malloc (size + align + sizeof (void *));
+	if (raw_ptr == 0)
+	{
+		throw std::bad_alloc ();
+	}
+
+	const size_t	raw_adr = reinterpret_cast <size_t> (raw_ptr);
+	const size_t	aligned_adr =
+		(raw_adr + sizeof (void *) + align - 1) & ~(align - 1);
+	void **		aligned_ptr = reinterpret_cast <void **> (aligned_adr);
+	aligned_ptr [-1] = raw_ptr;
+
+	return (aligned_ptr);
+}
+
+
+
+void	AllocatorHeap::deallocate (void *ptr)
+{
+	if (ptr != 0)
+	{
+		std::free (static_cast <void **> (ptr) [-1]);
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_AllocatorHeap_CODEHEADER_INCLUDED
+
+#undef ffft_AllocatorHeap_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -27,6 +27,8 @@ http://sam.zoy.org/wtfpl/COPYING for more details.
 
 /*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
+#include	"ffft/def.h"
+
 
 
 namespace ffft
@@ -34,6 +36,8 @@ namespace ffft
 
 
 
+// Storage is aligned on ffft_ALIGNMENT bytes. On the free store this needs a
+// compiler honouring the alignment of new-expressions (C++17).
 template <class T, long LEN>
 class Array
 {
@@ -66,6 +70,7 @@ protected:
 
 private:
 
+	ffft_ALIGN (ffft_ALIGNMENT)
 	DataType			_data_arr [LEN];
 
 
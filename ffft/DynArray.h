@@ -27,6 +27,10 @@ http://sam.zoy.org/wtfpl/COPYING for more details.
 
 /*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
+#include	"ffft/def.h"
+#include	"ffft/Allocator.h"
+#include	"ffft/AllocatorHeap.h"
+
 
 
 namespace ffft
@@ -34,7 +38,9 @@ namespace ffft
 
 
 
-template <class T>
+// Storage is aligned on ALIGN bytes (power of 2) and comes from an Allocator,
+// the shared AllocatorHeap unless another one is given.
+template <class T, long ALIGN = ffft_ALIGNMENT>
 class DynArray
 {
 
@@ -44,12 +50,19 @@ public:
 
 	typedef	T	DataType;
 
+	enum {			ALIGNMENT	= ALIGN	};
+
 						DynArray ();
 	explicit			DynArray (long size);
+	explicit			DynArray (Allocator &allocator);
+						DynArray (long size, Allocator &allocator);
 						~DynArray ();
 
 	inline long		size () const;
 	inline void		resize (long size);
+	inline void		clear ();
+	inline Allocator &
+						use_allocator () const;
 
 	inline const DataType &
 						operator [] (long pos) const;
@@ -68,8 +81,12 @@ protected:
 
 private:
 
+	inline void		allocate (long size);
+	inline void		release ();
+
 	DataType *		_data_ptr;
 	long				_len;
+	Allocator *		_allocator_ptr;
 
 
 
@@ -27,6 +27,8 @@ http://sam.zoy.org/wtfpl/COPYING for more details.
 
 /*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
+#include	<new>
+
 #include	<cassert>
 
 
@@ -40,69 +42,120 @@ namespace ffft
 
 
 
-template <class T>
-DynArray <T>::DynArray ()
+template <class T, long ALIGN>
+DynArray <T, ALIGN>::DynArray ()
 :	_data_ptr (0)
 ,	_len (0)
+,	_allocator_ptr (&AllocatorHeap::use_instance ())
 {
 	// Nothing
 }
 
 
 
-template <class T>
-DynArray <T>::DynArray (long size)
+template <class T, long ALIGN>
+DynArray <T, ALIGN>::DynArray (long size)
+:	_data_ptr (0)
+,	_len (0)
+,	_allocator_ptr (&AllocatorHeap::use_instance ())
+{
+	assert (size >= 0);
+	if (size > 0)
+	{
+		allocate (size);
+	}
+}
+
+
+
+// The allocator must outlive the array.
+template <class T, long ALIGN>
+DynArray <T, ALIGN>::DynArray (Allocator &allocator)
 :	_data_ptr (0)
 ,	_len (0)
+,	_allocator_ptr (&allocator)
+{
+	assert (&allocator != 0);
+}
+
+
+
+template <class T, long ALIGN>
+DynArray <T, ALIGN>::DynArray (long size, Allocator &allocator)
+:	_data_ptr (0)
+,	_len (0)
+,	_allocator_ptr (&allocator)
 {
 	assert (size >= 0);
+	assert (&allocator != 0);
 	if (size > 0)
 	{
-		_data_ptr = new DataType [size];
-		_len = size;
+		allocate (size);
 	}
 }
 
 
 
-template <class T>
-DynArray <T>::~DynArray ()
+template <class T, long ALIGN>
+DynArray <T, ALIGN>::~DynArray ()
 {
-	delete [] _data_ptr;
-	_data_ptr = 0;
-	_len = 0;
+	release ();
 }
 
 
 
-template <class T>
-long	DynArray <T>::size () const
+template <class T, long ALIGN>
+long	DynArray <T, ALIGN>::size () const
 {
 	return (_len);
 }
 
 
 
-template <class T>
-void	DynArray <T>::resize (long size)
+/*
+==============================================================================
+Name: resize
+Description:
+	Changes the number of elements. The content is lost, except when the size
+	does not change: then nothing happens. A size of 0 keeps the current
+	storage, use clear() to release it.
+Input parameters:
+	- size: New number of elements, >= 0.
+Throws: std::bad_alloc, or whatever the allocator throws.
+==============================================================================
+*/
+
+template <class T, long ALIGN>
+void	DynArray <T, ALIGN>::resize (long size)
 {
 	assert (size >= 0);
-	if (size > 0)
+	if (size > 0 && size != _len)
 	{
-		DataType *		old_data_ptr = _data_ptr;
-		DataType *		tmp_data_ptr = new DataType [size];
+		release ();
+		allocate (size);
+	}
+}
 
-		_data_ptr = tmp_data_ptr;
-		_len = size;
 
-		delete [] old_data_ptr;
-	}
+
+template <class T, long ALIGN>
+void	DynArray <T, ALIGN>::clear ()
+{
+	release ();
+}
+
+
+
+template <class T, long ALIGN>
+Allocator &	DynArray <T, ALIGN>::use_allocator () const
+{
+	return (*_allocator_ptr);
 }
 
 
 
-template <class T>
-const typename DynArray <T>::DataType &	DynArray <T>::operator [] (long pos) const
+template <class T, long ALIGN>
+const typename DynArray <T, ALIGN>::DataType &	DynArray <T, ALIGN>::operator [] (long pos) const
 {
 	assert (pos >= 0);
 	assert (pos < _len);
@@ -112,8 +165,8 @@ const typename DynArray <T>::DataType &	DynArray <T>::operator [] (long pos) con
 
 
 
-template <class T>
-typename DynArray <T>::DataType &	DynArray <T>::operator [] (long pos)
+template <class T, long ALIGN>
+typename DynArray <T, ALIGN>::DataType &	DynArray <T, ALIGN>::operator [] (long pos)
 {
 	assert (pos >= 0);
 	assert (pos < _len);
@@ -131,6 +184,44 @@ typename DynArray <T>::DataType &	DynArray <T>::operator [] (long pos)
 
 
 
+// Elements are default-constructed, like with new [].
+template <class T, long ALIGN>
+void	DynArray <T, ALIGN>::allocate (long size)
+{
+	assert (_data_ptr == 0);
+	assert (size > 0);
+	assert ((ALIGN & (ALIGN - 1)) == 0);
+
+	void *			mem_ptr = _allocator_ptr->allocate (size * sizeof (DataType), ALIGN);
+	DataType *		data_ptr = static_cast <DataType *> (mem_ptr);
+	for (long pos = 0; pos < size; ++pos)
+	{
+		new (data_ptr + pos) DataType;
+	}
+
+	_data_ptr = data_ptr;
+	_len = size;
+}
+
+
+
+template <class T, long ALIGN>
+void	DynArray <T, ALIGN>::release ()
+{
+	if (_data_ptr != 0)
+	{
+		for (long pos = _len - 1; pos >= 0; --pos)
+		{
+			_data_ptr [pos].~DataType ();
+		}
+		_allocator_ptr->deallocate (_data_ptr);
+		_data_ptr = 0;
+		_len = 0;
+	}
+}
+
+
+
 }	// namespace ffft
 
 
@@ -0,0 +1,148 @@
+/*****************************************************************************
+
+        FFTAnyLen.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_FFTAnyLen_HEADER_INCLUDED)
+#define	ffft_FFTAnyLen_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/AllocatorHeap.h"
+#include	"ffft/DynArray.h"
+#include	"ffft/FFTComplex.h"
+
+
+
+namespace ffft
+{
+
+
+
+// Complex FFT of any length, same format as FFTComplex.
+// Lengths 2^a * 3^b * 5^c run on radix-2, 3, 4 and 5 passes (Stockham
+// algorithm, the output is in natural order). The other lengths use the
+// Bluestein algorithm: the transform is written as a convolution with a
+// chirp, done with FFTComplex on a power of 2 of about twice the length.
+// It is 3 to 6 times slower than the mixed radix, find_smooth_len() gives
+// the next length that avoids it.
+template <class DT>
+class FFTAnyLen
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	DT	DataType;
+
+	explicit			FFTAnyLen (long length, Allocator &allocator = AllocatorHeap::use_instance ());
+	virtual			~FFTAnyLen () {}
+
+	long				get_length () const;
+	bool				is_mixed_radix () const;
+	long				get_workspace_len () const;
+	void				do_fft (DataType fr [], DataType fi [], const DataType xr [], const DataType xi []) const;
+	void				do_fft (DataType fr [], DataType fi [], const DataType xr [], const DataType xi [], DataType ws []) const;
+	void				do_ifft (const DataType fr [], const DataType fi [], DataType xr [], DataType xi []) const;
+	void				do_ifft (const DataType fr [], const DataType fi [], DataType xr [], DataType xi [], DataType ws []) const;
+	void				rescale (DataType xr [], DataType xi []) const;
+
+	static bool	is_smooth (long length);
+	static long	find_smooth_len (long length);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	// 2^62 needs 31 radix-4 passes at most
+	enum {			MAX_NBR_PASSES = 64	};
+
+	static long	compute_conv_len (long length);
+	void				init_mixed_radix ();
+	void				init_bluestein (Allocator &allocator);
+	void				compute_mixed_radix (DataType fr [], DataType fi [], const DataType xr [], const DataType xi [], DataType ws []) const;
+	void				compute_bluestein (DataType fr [], DataType fi [], const DataType xr [], const DataType xi [], DataType ws []) const;
+	static inline void
+							pass_2 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long l, long r, const DataType tw_ptr []);
+	static inline void
+							pass_3 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long l, long r, const DataType tw_ptr []);
+	static inline void
+							pass_4 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long l, long r, const DataType tw_ptr []);
+	static inline void
+							pass_5 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long l, long r, const DataType tw_ptr []);
+	static ffft_FORCEINLINE void
+							rotate (DataType &dst_r, DataType &dst_i, DataType src_r, DataType src_i, const DataType w_ptr []);
+	DataType *		use_buffer () const;
+
+	const long		_length;
+	const bool		_mixed_flag;	// false: Bluestein
+	int				_nbr_passes;
+	int				_radix_arr [MAX_NBR_PASSES];
+	DynArray <DataType>
+							_twiddle_lut;	// Mixed radix: exp (-2*PI*i*t*f/(l*p)), cos then sin, for each pass
+	const long		_conv_len;	// Bluestein: power of 2, 2 * length - 1 or more. 0 otherwise
+	DynArray <DataType>
+							_chirp_lut;		// Bluestein: exp (-PI*i*n^2/length), cos then sin
+	DynArray <DataType>
+							_kernel_lut;	// Bluestein: FFT of the conjugate chirp / conv_len, real then imaginary parts
+	FFTComplex <DataType>
+							_conv;			// Bluestein: convolution FFT. Length 2 and unused otherwise
+	mutable DynArray <DataType>
+							_buffer;			// Workspace for the functions called without one
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+							FFTAnyLen ();
+							FFTAnyLen (const FFTAnyLen &other);
+	FFTAnyLen &	operator = (const FFTAnyLen &other);
+	bool				operator == (const FFTAnyLen &other);
+	bool				operator != (const FFTAnyLen &other);
+
+};	// class FFTAnyLen
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/FFTAnyLen.hpp"
+
+
+
+#endif	// ffft_FFTAnyLen_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
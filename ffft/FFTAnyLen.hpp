@@ -0,0 +1,713 @@
+/*****************************************************************************
+
+        FFTAnyLen.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_FFTAnyLen_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTAnyLen code header.
+#endif
+#define	ffft_FFTAnyLen_CURRENT_CODEHEADER
+
+#if ! defined (ffft_FFTAnyLen_CODEHEADER_INCLUDED)
+#define	ffft_FFTAnyLen_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/def.h"
+
+#include	<algorithm>
+
+#include	<cassert>
+#include	<cmath>
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: ctor
+Input parameters:
+	- length: length of the FFT, 1 or more.
+	- allocator: provides the tables, the buffer and the convolution FFT.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <class DT>
+FFTAnyLen <DT>::FFTAnyLen (long length, Allocator &allocator)
+:	_length (length)
+,	_mixed_flag (is_smooth (length))
+,	_nbr_passes (0)
+,	_twiddle_lut (allocator)
+,	_conv_len (_mixed_flag ? 0 : compute_conv_len (length))
+,	_chirp_lut (allocator)
+,	_kernel_lut (allocator)
+,	_conv (std::max (_conv_len, 2L), allocator)
+,	_buffer (allocator)
+{
+	assert (length >= 1);
+
+	if (_mixed_flag)
+	{
+		init_mixed_radix ();
+	}
+	else
+	{
+		init_bluestein (allocator);
+	}
+}
+
+
+
+template <class DT>
+long	FFTAnyLen <DT>::get_length () const
+{
+	return (_length);
+}
+
+
+
+// false when the length has a prime factor above 5
+template <class DT>
+bool	FFTAnyLen <DT>::is_mixed_radix () const
+{
+	return (_mixed_flag);
+}
+
+
+
+// Mixed radix: one buffer of complex values, the passes go back and forth
+// between it and the output. Bluestein: two buffers of complex values on the
+// convolution length, then the workspace of the convolution FFT.
+template <class DT>
+long	FFTAnyLen <DT>::get_workspace_len () const
+{
+	if (_mixed_flag)
+	{
+		return (_length * 2);
+	}
+
+	return (_conv_len * 4 + _conv.get_workspace_len ());
+}
+
+
+
+template <class DT>
+void	FFTAnyLen <DT>::do_fft (DataType fr [], DataType fi [], const DataType xr [], const DataType xi []) const
+{
+	do_fft (fr, fi, xr, xi, use_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_fft
+Description:
+	Compute the FFT of the complex array, same definition as
+	FFTComplex::do_fft():
+	f [k] = sum (x [n] * exp (-2*PI*i*k*n / length)), n in [0 ; length[
+Input parameters:
+	- xr: real parts of the source array (time).
+	- xi: imaginary parts of the source array.
+Output parameters:
+	- fr: real parts of the spectrum, distinct from the inputs.
+	- fi: imaginary parts of the spectrum, distinct from the inputs.
+Input/output parameters:
+	- ws: workspace, get_workspace_len() values at least.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTAnyLen <DT>::do_fft (DataType fr [], DataType fi [], const DataType xr [], const DataType xi [], DataType ws []) const
+{
+	assert (fr != 0);
+	assert (fi != 0);
+	assert (xr != 0);
+	assert (xi != 0);
+	assert (ws != 0);
+	assert (fr != fi);
+	assert (fr != xr && fr != xi);
+	assert (fi != xr && fi != xi);
+
+	if (_mixed_flag)
+	{
+		compute_mixed_radix (fr, fi, xr, xi, ws);
+	}
+	else
+	{
+		compute_bluestein (fr, fi, xr, xi, ws);
+	}
+}
+
+
+
+template <class DT>
+void	FFTAnyLen <DT>::do_ifft (const DataType fr [], const DataType fi [], DataType xr [], DataType xi []) const
+{
+	do_ifft (fr, fi, xr, xi, use_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_ifft
+Description:
+	Compute the inverse FFT of the complex array, without scaling. This is
+	the forward transform with the real and imaginary parts swapped, on the
+	input and on the output.
+Input parameters:
+	- fr: real parts of the source array (frequencies).
+	- fi: imaginary parts of the source array.
+Output parameters:
+	- xr: real parts of the result (time), distinct from the inputs.
+	- xi: imaginary parts of the result, distinct from the inputs.
+Input/output parameters:
+	- ws: workspace, get_workspace_len() values at least.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTAnyLen <DT>::do_ifft (const DataType fr [], const DataType fi [], DataType xr [], DataType xi [], DataType ws []) const
+{
+	do_fft (xi, xr, fi, fr, ws);
+}
+
+
+
+template <class DT>
+void	FFTAnyLen <DT>::rescale (DataType xr [], DataType xi []) const
+{
+	assert (xr != 0);
+	assert (xi != 0);
+
+	const DataType	mul = DataType (1.0 / _length);
+	for (long pos = 0; pos < _length; ++pos)
+	{
+		xr [pos] *= mul;
+		xi [pos] *= mul;
+	}
+}
+
+
+
+// Lengths made of 2, 3 and 5 only, they do not need the Bluestein algorithm
+template <class DT>
+bool	FFTAnyLen <DT>::is_smooth (long length)
+{
+	assert (length >= 1);
+
+	static const long	factor_arr [3] = { 2, 3, 5 };
+	for (int f_cnt = 0; f_cnt < 3; ++f_cnt)
+	{
+		while (length % factor_arr [f_cnt] == 0)
+		{
+			length /= factor_arr [f_cnt];
+		}
+	}
+
+	return (length == 1);
+}
+
+
+
+// Smallest length not below the given one that runs on the mixed radix.
+// They are dense: there is one in about every 2 % above 1000, and 0.5 %
+// above 100000.
+template <class DT>
+long	FFTAnyLen <DT>::find_smooth_len (long length)
+{
+	assert (length >= 1);
+
+	while (! is_smooth (length))
+	{
+		++ length;
+	}
+
+	return (length);
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// Smallest power of 2 holding the linear convolution of two sequences of
+// the length
+template <class DT>
+long	FFTAnyLen <DT>::compute_conv_len (long length)
+{
+	long				conv_len = 1;
+	while (conv_len < length * 2 - 1)
+	{
+		conv_len *= 2;
+	}
+
+	return (conv_len);
+}
+
+
+
+// Radix 4 as long as possible, then 2, 3 and 5. Pass p, after passes of
+// total length l, uses exp (-2*PI*i*t*f/(l*p)) for f in [0 ; l[ and t in
+// [1 ; p[, stored by f.
+template <class DT>
+void	FFTAnyLen <DT>::init_mixed_radix ()
+{
+	long				rem = _length;
+	while (rem % 4 == 0)
+	{
+		assert (_nbr_passes < MAX_NBR_PASSES);
+		_radix_arr [_nbr_passes] = 4;
+		++ _nbr_passes;
+		rem /= 4;
+	}
+	static const int	factor_arr [3] = { 2, 3, 5 };
+	for (int f_cnt = 0; f_cnt < 3; ++f_cnt)
+	{
+		while (rem % factor_arr [f_cnt] == 0)
+		{
+			assert (_nbr_passes < MAX_NBR_PASSES);
+			_radix_arr [_nbr_passes] = factor_arr [f_cnt];
+			++ _nbr_passes;
+			rem /= factor_arr [f_cnt];
+		}
+	}
+	assert (rem == 1);
+
+	long				lut_len = 0;
+	long				l = 1;
+	for (int pass = 0; pass < _nbr_passes; ++pass)
+	{
+		lut_len += l * (_radix_arr [pass] - 1) * 2;
+		l *= _radix_arr [pass];
+	}
+	_twiddle_lut.resize (lut_len);
+
+	long				pos = 0;
+	l = 1;
+	for (int pass = 0; pass < _nbr_passes; ++pass)
+	{
+		const int	p = _radix_arr [pass];
+		const double	mul = 2 * PI / (l * p);
+		for (long f = 0; f < l; ++f)
+		{
+			for (int t = 1; t < p; ++t)
+			{
+				_twiddle_lut [pos    ] = DataType (cos (t * f * mul));
+				_twiddle_lut [pos + 1] = DataType (sin (t * f * mul));
+				pos += 2;
+			}
+		}
+		l *= p;
+	}
+}
+
+
+
+// Chirp and kernel of the convolution. The phase of the chirp is computed
+// modulo 2*PI with integers, n^2 would lose precision in the sin and cos
+// arguments.
+template <class DT>
+void	FFTAnyLen <DT>::init_bluestein (Allocator &allocator)
+{
+	_chirp_lut.resize (_length * 2);
+	_kernel_lut.resize (_conv_len * 2);
+
+	const long		mod = _length * 2;
+	long				sq = 0;	// n^2 modulo 2 * length
+	for (long n = 0; n < _length; ++n)
+	{
+		const double	a = PI * sq / _length;
+		_chirp_lut [n * 2    ] = DataType (cos (a));
+		_chirp_lut [n * 2 + 1] = DataType (sin (a));
+		sq += n * 2 + 1;
+		if (sq >= mod)
+		{
+			sq -= mod;
+		}
+	}
+
+	// Conjugate chirp, on positive and negative positions
+	DynArray <DataType>	tmp (_conv_len * 2 + _conv.get_workspace_len (), allocator);
+	DataType * const	tr_ptr = &tmp [0];
+	DataType * const	ti_ptr = tr_ptr + _conv_len;
+	for (long pos = 0; pos < _conv_len; ++pos)
+	{
+		tr_ptr [pos] = 0;
+		ti_ptr [pos] = 0;
+	}
+	for (long n = 0; n < _length; ++n)
+	{
+		tr_ptr [n] = _chirp_lut [n * 2    ];
+		ti_ptr [n] = _chirp_lut [n * 2 + 1];
+		if (n > 0)
+		{
+			tr_ptr [_conv_len - n] = tr_ptr [n];
+			ti_ptr [_conv_len - n] = ti_ptr [n];
+		}
+	}
+
+	DataType * const	kr_ptr = &_kernel_lut [0];
+	DataType * const	ki_ptr = kr_ptr + _conv_len;
+	_conv.do_fft (kr_ptr, ki_ptr, tr_ptr, ti_ptr, ti_ptr + _conv_len);
+
+	// Scale of the inverse convolution FFT
+	const DataType	mul = DataType (1.0 / _conv_len);
+	for (long pos = 0; pos < _conv_len; ++pos)
+	{
+		kr_ptr [pos] *= mul;
+		ki_ptr [pos] *= mul;
+	}
+}
+
+
+
+// The passes go back and forth between the workspace and the output, so the
+// last one writes the output.
+template <class DT>
+void	FFTAnyLen <DT>::compute_mixed_radix (DataType fr [], DataType fi [], const DataType xr [], const DataType xi [], DataType ws []) const
+{
+	if (_nbr_passes == 0)
+	{
+		fr [0] = xr [0];
+		fi [0] = xi [0];
+		return;
+	}
+
+	DataType * const	br_ptr = ws;
+	DataType * const	bi_ptr = ws + _length;
+	const DataType *	sr_ptr = xr;
+	const DataType *	si_ptr = xi;
+	const DataType *	tw_ptr = &_twiddle_lut [0];
+	long				l = 1;
+	for (int pass = 0; pass < _nbr_passes; ++pass)
+	{
+		const int	p = _radix_arr [pass];
+		const long		r = _length / (l * p);
+		const bool	to_out_flag = (((_nbr_passes - 1 - pass) & 1) == 0);
+		DataType * const	dr_ptr = to_out_flag ? fr : br_ptr;
+		DataType * const	di_ptr = to_out_flag ? fi : bi_ptr;
+
+		switch (p)
+		{
+		case 2:
+			pass_2 (dr_ptr, di_ptr, sr_ptr, si_ptr, l, r, tw_ptr);
+			break;
+		case 3:
+			pass_3 (dr_ptr, di_ptr, sr_ptr, si_ptr, l, r, tw_ptr);
+			break;
+		case 4:
+			pass_4 (dr_ptr, di_ptr, sr_ptr, si_ptr, l, r, tw_ptr);
+			break;
+		case 5:
+			pass_5 (dr_ptr, di_ptr, sr_ptr, si_ptr, l, r, tw_ptr);
+			break;
+		default:
+			assert (false);
+			break;
+		}
+
+		sr_ptr = dr_ptr;
+		si_ptr = di_ptr;
+		tw_ptr += l * (p - 1) * 2;
+		l *= p;
+	}
+}
+
+
+
+// Convolution of the input times the chirp with the conjugate chirp, times
+// the chirp again:
+// f [k] = w [k] * sum (x [n] * w [n] * conj (w [k - n])), w [n] = exp (-PI*i*n^2/length)
+template <class DT>
+void	FFTAnyLen <DT>::compute_bluestein (DataType fr [], DataType fi [], const DataType xr [], const DataType xi [], DataType ws []) const
+{
+	DataType * const	ar_ptr = ws;
+	DataType * const	ai_ptr = ws + _conv_len;
+	DataType * const	br_ptr = ws + _conv_len * 2;
+	DataType * const	bi_ptr = ws + _conv_len * 3;
+	DataType * const	conv_ws_ptr = ws + _conv_len * 4;
+	const DataType * const	chirp_ptr = &_chirp_lut [0];
+	const DataType * const	kr_ptr = &_kernel_lut [0];
+	const DataType * const	ki_ptr = kr_ptr + _conv_len;
+
+	for (long n = 0; n < _length; ++n)
+	{
+		rotate (ar_ptr [n], ai_ptr [n], xr [n], xi [n], chirp_ptr + n * 2);
+	}
+	for (long n = _length; n < _conv_len; ++n)
+	{
+		ar_ptr [n] = 0;
+		ai_ptr [n] = 0;
+	}
+
+	_conv.do_fft (br_ptr, bi_ptr, ar_ptr, ai_ptr, conv_ws_ptr);
+	for (long k = 0; k < _conv_len; ++k)
+	{
+		const DataType	vr = br_ptr [k];
+		const DataType	vi = bi_ptr [k];
+		ar_ptr [k] = vr * kr_ptr [k] - vi * ki_ptr [k];
+		ai_ptr [k] = vr * ki_ptr [k] + vi * kr_ptr [k];
+	}
+	_conv.do_ifft (ar_ptr, ai_ptr, br_ptr, bi_ptr, conv_ws_ptr);
+
+	for (long k = 0; k < _length; ++k)
+	{
+		rotate (fr [k], fi [k], br_ptr [k], bi_ptr [k], chirp_ptr + k * 2);
+	}
+}
+
+
+
+// A pass of radix p reads p sequences of length l * r spaced by l * r, and
+// writes the p outputs of each butterfly spaced by l:
+// d [f + l * (q + p * k)] = sum (exp (-2*PI*i*q*t/p) * w (t, f) * s [f + l * (k + r * t)])
+template <class DT>
+void	FFTAnyLen <DT>::pass_2 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long l, long r, const DataType tw_ptr [])
+{
+	const long		stride = l * r;
+	for (long k = 0; k < r; ++k)
+	{
+		for (long f = 0; f < l; ++f)
+		{
+			const long		i0 = l * k + f;
+			const long		o0 = l * 2 * k + f;
+
+			DataType		a1r;
+			DataType		a1i;
+			rotate (a1r, a1i, sr [i0 + stride], si [i0 + stride], tw_ptr + f * 2);
+			const DataType	a0r = sr [i0];
+			const DataType	a0i = si [i0];
+
+			dr [o0    ] = a0r + a1r;
+			di [o0    ] = a0i + a1i;
+			dr [o0 + l] = a0r - a1r;
+			di [o0 + l] = a0i - a1i;
+		}
+	}
+}
+
+
+
+template <class DT>
+void	FFTAnyLen <DT>::pass_3 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long l, long r, const DataType tw_ptr [])
+{
+	const DataType	s3 = DataType (0.86602540378443864676);	// sin (2*PI/3)
+	const DataType	h = DataType (0.5);
+
+	const long		stride = l * r;
+	for (long k = 0; k < r; ++k)
+	{
+		for (long f = 0; f < l; ++f)
+		{
+			const long		i0 = l * k + f;
+			const long		o0 = l * 3 * k + f;
+			const DataType * const	w_ptr = tw_ptr + f * 4;
+
+			DataType		a1r;
+			DataType		a1i;
+			DataType		a2r;
+			DataType		a2i;
+			rotate (a1r, a1i, sr [i0 + stride    ], si [i0 + stride    ], w_ptr    );
+			rotate (a2r, a2i, sr [i0 + stride * 2], si [i0 + stride * 2], w_ptr + 2);
+			const DataType	a0r = sr [i0];
+			const DataType	a0i = si [i0];
+
+			const DataType	sum_r = a1r + a2r;
+			const DataType	sum_i = a1i + a2i;
+			const DataType	dif_r = (a1r - a2r) * s3;
+			const DataType	dif_i = (a1i - a2i) * s3;
+			const DataType	mr = a0r - sum_r * h;
+			const DataType	mi = a0i - sum_i * h;
+
+			dr [o0        ] = a0r + sum_r;
+			di [o0        ] = a0i + sum_i;
+			dr [o0 + l    ] = mr + dif_i;
+			di [o0 + l    ] = mi - dif_r;
+			dr [o0 + l * 2] = mr - dif_i;
+			di [o0 + l * 2] = mi + dif_r;
+		}
+	}
+}
+
+
+
+template <class DT>
+void	FFTAnyLen <DT>::pass_4 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long l, long r, const DataType tw_ptr [])
+{
+	const long		stride = l * r;
+	for (long k = 0; k < r; ++k)
+	{
+		for (long f = 0; f < l; ++f)
+		{
+			const long		i0 = l * k + f;
+			const long		o0 = l * 4 * k + f;
+			const DataType * const	w_ptr = tw_ptr + f * 6;
+
+			DataType		a1r;
+			DataType		a1i;
+			DataType		a2r;
+			DataType		a2i;
+			DataType		a3r;
+			DataType		a3i;
+			rotate (a1r, a1i, sr [i0 + stride    ], si [i0 + stride    ], w_ptr    );
+			rotate (a2r, a2i, sr [i0 + stride * 2], si [i0 + stride * 2], w_ptr + 2);
+			rotate (a3r, a3i, sr [i0 + stride * 3], si [i0 + stride * 3], w_ptr + 4);
+			const DataType	a0r = sr [i0];
+			const DataType	a0i = si [i0];
+
+			const DataType	t0r = a0r + a2r;
+			const DataType	t0i = a0i + a2i;
+			const DataType	t1r = a0r - a2r;
+			const DataType	t1i = a0i - a2i;
+			const DataType	t2r = a1r + a3r;
+			const DataType	t2i = a1i + a3i;
+			const DataType	t3r = a1r - a3r;
+			const DataType	t3i = a1i - a3i;
+
+			dr [o0        ] = t0r + t2r;
+			di [o0        ] = t0i + t2i;
+			dr [o0 + l    ] = t1r + t3i;
+			di [o0 + l    ] = t1i - t3r;
+			dr [o0 + l * 2] = t0r - t2r;
+			di [o0 + l * 2] = t0i - t2i;
+			dr [o0 + l * 3] = t1r - t3i;
+			di [o0 + l * 3] = t1i + t3r;
+		}
+	}
+}
+
+
+
+template <class DT>
+void	FFTAnyLen <DT>::pass_5 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long l, long r, const DataType tw_ptr [])
+{
+	const DataType	c1 = DataType ( 0.30901699437494742410);	// cos (2*PI/5)
+	const DataType	c2 = DataType (-0.80901699437494742410);	// cos (4*PI/5)
+	const DataType	s1 = DataType ( 0.95105651629515357212);	// sin (2*PI/5)
+	const DataType	s2 = DataType ( 0.58778525229247312917);	// sin (4*PI/5)
+
+	const long		stride = l * r;
+	for (long k = 0; k < r; ++k)
+	{
+		for (long f = 0; f < l; ++f)
+		{
+			const long		i0 = l * k + f;
+			const long		o0 = l * 5 * k + f;
+			const DataType * const	w_ptr = tw_ptr + f * 8;
+
+			DataType		a1r;
+			DataType		a1i;
+			DataType		a2r;
+			DataType		a2i;
+			DataType		a3r;
+			DataType		a3i;
+			DataType		a4r;
+			DataType		a4i;
+			rotate (a1r, a1i, sr [i0 + stride    ], si [i0 + stride    ], w_ptr    );
+			rotate (a2r, a2i, sr [i0 + stride * 2], si [i0 + stride * 2], w_ptr + 2);
+			rotate (a3r, a3i, sr [i0 + stride * 3], si [i0 + stride * 3], w_ptr + 4);
+			rotate (a4r, a4i, sr [i0 + stride * 4], si [i0 + stride * 4], w_ptr + 6);
+			const DataType	a0r = sr [i0];
+			const DataType	a0i = si [i0];
+
+			const DataType	b1r = a1r + a4r;
+			const DataType	b1i = a1i + a4i;
+			const DataType	b2r = a2r + a3r;
+			const DataType	b2i = a2i + a3i;
+			const DataType	d1r = a1r - a4r;
+			const DataType	d1i = a1i - a4i;
+			const DataType	d2r = a2r - a3r;
+			const DataType	d2i = a2i - a3i;
+
+			const DataType	u1r = a0r + c1 * b1r + c2 * b2r;
+			const DataType	u1i = a0i + c1 * b1i + c2 * b2i;
+			const DataType	u2r = a0r + c2 * b1r + c1 * b2r;
+			const DataType	u2i = a0i + c2 * b1i + c1 * b2i;
+			const DataType	v1r = s1 * d1r + s2 * d2r;
+			const DataType	v1i = s1 * d1i + s2 * d2i;
+			const DataType	v2r = s2 * d1r - s1 * d2r;
+			const DataType	v2i = s2 * d1i - s1 * d2i;
+
+			dr [o0        ] = a0r + b1r + b2r;
+			di [o0        ] = a0i + b1i + b2i;
+			dr [o0 + l    ] = u1r + v1i;
+			di [o0 + l    ] = u1i - v1r;
+			dr [o0 + l * 2] = u2r + v2i;
+			di [o0 + l * 2] = u2i - v2r;
+			dr [o0 + l * 3] = u2r - v2i;
+			di [o0 + l * 3] = u2i + v2r;
+			dr [o0 + l * 4] = u1r - v1i;
+			di [o0 + l * 4] = u1i + v1r;
+		}
+	}
+}
+
+
+
+// dst = src * exp (-i*a), with w_ptr = { cos (a), sin (a) }
+template <class DT>
+void	FFTAnyLen <DT>::rotate (DataType &dst_r, DataType &dst_i, DataType src_r, DataType src_i, const DataType w_ptr [])
+{
+	const DataType	c = w_ptr [0];
+	const DataType	s = w_ptr [1];
+	dst_r = src_r * c + src_i * s;
+	dst_i = src_i * c - src_r * s;
+}
+
+
+
+template <class DT>
+typename FFTAnyLen <DT>::DataType *	FFTAnyLen <DT>::use_buffer () const
+{
+	if (_buffer.size () == 0)
+	{
+		_buffer.resize (get_workspace_len ());
+	}
+
+	return (&_buffer [0]);
+}
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_FFTAnyLen_CODEHEADER_INCLUDED
+
+#undef ffft_FFTAnyLen_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,128 @@
+/*****************************************************************************
+
+        FFTComplex.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_FFTComplex_HEADER_INCLUDED)
+#define	ffft_FFTComplex_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/AllocatorHeap.h"
+#include	"ffft/DynArray.h"
+#include	"ffft/FFTRealSimd.h"
+
+
+
+namespace ffft
+{
+
+
+
+// FFT of a complex sequence, given as separate real and imaginary arrays.
+// Radix-4 passes in the Stockham order: each pass goes from one buffer to
+// the other and the spectrum comes out in natural order, without bit
+// reversal. A radix-2 pass ends the odd powers of 2. The passes are
+// vectorized for float.
+// do_fft_pair() transforms two real signals at once, packed as the real and
+// imaginary parts of one complex signal.
+// The spectrum is the regular DFT, the imaginary parts are not negated as in
+// the FFTReal output. The inverse transform is not scaled. Both directions
+// work in place.
+template <class DT>
+class FFTComplex
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	DT	DataType;
+
+	explicit			FFTComplex (long length, Allocator &allocator = AllocatorHeap::use_instance ());
+	virtual			~FFTComplex () {}
+
+	long				get_length () const;
+	long				get_workspace_len () const;
+	void				do_fft (DataType fr [], DataType fi [], const DataType xr [], const DataType xi []) const;
+	void				do_fft (DataType fr [], DataType fi [], const DataType xr [], const DataType xi [], DataType ws []) const;
+	void				do_ifft (const DataType fr [], const DataType fi [], DataType xr [], DataType xi []) const;
+	void				do_ifft (const DataType fr [], const DataType fi [], DataType xr [], DataType xi [], DataType ws []) const;
+	void				do_fft_pair (DataType f1 [], DataType f2 [], const DataType x1 [], const DataType x2 []) const;
+	void				do_fft_pair (DataType f1 [], DataType f2 [], const DataType x1 [], const DataType x2 [], DataType ws []) const;
+	void				rescale (DataType xr [], DataType xi []) const;
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	DataType *		use_buffer () const;
+
+	void				init_twiddle ();
+	inline void		compute (DataType fr [], DataType fi [], const DataType xr [], const DataType xi [], DataType ws []) const;
+	inline void		compute_pass_4 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long nbr_coef, long stride, const DataType tw_ptr []) const;
+	inline void		compute_pass_2 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long stride) const;
+
+	const long		_length;
+	const int		_simd_level;	// SimdLevel, fixed at construction
+	int				_nbr_passes;
+	DynArray <DataType>
+							_twiddle;		// Per radix-4 pass: w, w^2 and w^3, real then imaginary parts
+	mutable DynArray <DataType>
+							_buffer;			// Workspace for the functions called without one
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+							FFTComplex ();
+							FFTComplex (const FFTComplex &other);
+	FFTComplex &	operator = (const FFTComplex &other);
+	bool				operator == (const FFTComplex &other);
+	bool				operator != (const FFTComplex &other);
+
+};	// class FFTComplex
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/FFTComplex.hpp"
+
+
+
+#endif	// ffft_FFTComplex_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,485 @@
+/*****************************************************************************
+
+        FFTComplex.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_FFTComplex_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTComplex code header.
+#endif
+#define	ffft_FFTComplex_CURRENT_CODEHEADER
+
+#if ! defined (ffft_FFTComplex_CODEHEADER_INCLUDED)
+#define	ffft_FFTComplex_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/def.h"
+
+#include	<cassert>
+#include	<cmath>
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: ctor
+Input parameters:
+	- length: length of the FFT, power of 2, 2 or more.
+	- allocator: provides the twiddle factors and the buffer.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <class DT>
+FFTComplex <DT>::FFTComplex (long length, Allocator &allocator)
+:	_length (length)
+,	_simd_level (FFTRealSimd <DT>::get_level ())
+,	_nbr_passes (0)
+,	_twiddle (allocator)
+,	_buffer (allocator)
+{
+	assert (length >= 2);
+	assert ((length & (length - 1)) == 0);
+
+	// Radix-4 passes, and a radix-2 one for the odd powers of 2
+	int				nbr_bits = 0;
+	while ((1L << nbr_bits) < length)
+	{
+		++ nbr_bits;
+	}
+	_nbr_passes = (nbr_bits + 1) >> 1;
+
+	init_twiddle ();
+}
+
+
+
+template <class DT>
+long	FFTComplex <DT>::get_length () const
+{
+	return (_length);
+}
+
+
+
+// The real and imaginary parts of the other buffer of the passes
+template <class DT>
+long	FFTComplex <DT>::get_workspace_len () const
+{
+	return (_length * 2);
+}
+
+
+
+template <class DT>
+void	FFTComplex <DT>::do_fft (DataType fr [], DataType fi [], const DataType xr [], const DataType xi []) const
+{
+	do_fft (fr, fi, xr, xi, use_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_fft
+Description:
+	Compute the FFT of the complex array:
+	f [k] = sum (x [n] * exp (-2*PI*i*k*n / length)), n in [0 ; length[
+Input parameters:
+	- xr: real parts of the source array (time).
+	- xi: imaginary parts of the source array.
+Output parameters:
+	- fr: real parts of the spectrum. May be xr, then fi must be xi.
+	- fi: imaginary parts of the spectrum.
+Input/output parameters:
+	- ws: workspace, get_workspace_len() values at least.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTComplex <DT>::do_fft (DataType fr [], DataType fi [], const DataType xr [], const DataType xi [], DataType ws []) const
+{
+	compute (fr, fi, xr, xi, ws);
+}
+
+
+
+template <class DT>
+void	FFTComplex <DT>::do_ifft (const DataType fr [], const DataType fi [], DataType xr [], DataType xi []) const
+{
+	do_ifft (fr, fi, xr, xi, use_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_ifft
+Description:
+	Compute the inverse FFT of the complex array, without scaling:
+	x [n] = sum (f [k] * exp (2*PI*i*k*n / length)), k in [0 ; length[
+	This is the forward transform with the real and imaginary parts
+	swapped on both sides.
+Input parameters:
+	- fr: real parts of the source array (frequencies).
+	- fi: imaginary parts of the source array.
+Output parameters:
+	- xr: real parts of the result (time). May be fr, then xi must be fi.
+	- xi: imaginary parts of the result.
+Input/output parameters:
+	- ws: workspace, get_workspace_len() values at least.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTComplex <DT>::do_ifft (const DataType fr [], const DataType fi [], DataType xr [], DataType xi [], DataType ws []) const
+{
+	compute (xi, xr, fi, fr, ws);
+}
+
+
+
+template <class DT>
+void	FFTComplex <DT>::do_fft_pair (DataType f1 [], DataType f2 [], const DataType x1 [], const DataType x2 []) const
+{
+	do_fft_pair (f1, f2, x1, x2, use_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_fft_pair
+Description:
+	Compute the FFT of two real arrays with a single complex transform of
+	z = x1 + i * x2. Both spectra are then taken from the Hermitian
+	symmetry of real signals:
+	F1 [k] = (Z [k] + conj (Z [length - k])) / 2
+	F2 [k] = (Z [k] - conj (Z [length - k])) / (2 * i)
+Input parameters:
+	- x1: first source array (time).
+	- x2: second source array (time).
+Output parameters:
+	- f1: spectrum of x1, in the FFTReal::do_fft() format. May be x1, then
+		f2 must be x2.
+	- f2: spectrum of x2, same format.
+Input/output parameters:
+	- ws: workspace, get_workspace_len() values at least.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTComplex <DT>::do_fft_pair (DataType f1 [], DataType f2 [], const DataType x1 [], const DataType x2 [], DataType ws []) const
+{
+	compute (f1, f2, x1, x2, ws);
+
+	// Bins k and length - k give bins k of both spectra. length - k is at
+	// the place of the imaginary part of bin length/2 - k in the FFTReal
+	// format, so bins k and length/2 - k are processed together.
+	const long		half = _length >> 1;
+	const DataType	h = DataType (0.5);
+
+	// Bins 0 and length/2 are real in both spectra, Z gives them directly
+	for (long k = 1; k <= (half >> 1); ++k)
+	{
+		const long		j = half - k;
+
+		// length - k = half + j and length - j = half + k
+		const DataType	zr_k = f1 [k];
+		const DataType	zi_k = f2 [k];
+		const DataType	zr_nk = f1 [half + j];
+		const DataType	zi_nk = f2 [half + j];
+		const DataType	zr_j = f1 [j];
+		const DataType	zi_j = f2 [j];
+		const DataType	zr_nj = f1 [half + k];
+		const DataType	zi_nj = f2 [half + k];
+
+		// Imaginary parts are stored negated
+		f1 [k] = (zr_k + zr_nk) * h;
+		f1 [half + k] = (zi_nk - zi_k) * h;
+		f2 [k] = (zi_k + zi_nk) * h;
+		f2 [half + k] = (zr_k - zr_nk) * h;
+
+		f1 [j] = (zr_j + zr_nj) * h;
+		f1 [half + j] = (zi_nj - zi_j) * h;
+		f2 [j] = (zi_j + zi_nj) * h;
+		f2 [half + j] = (zr_j - zr_nj) * h;
+	}
+}
+
+
+
+template <class DT>
+void	FFTComplex <DT>::rescale (DataType xr [], DataType xi []) const
+{
+	assert (xr != 0);
+	assert (xi != 0);
+
+	const DataType	mul = DataType (1.0 / _length);
+	for (long pos = 0; pos < _length; ++pos)
+	{
+		xr [pos] *= mul;
+		xi [pos] *= mul;
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <class DT>
+typename FFTComplex <DT>::DataType *	FFTComplex <DT>::use_buffer () const
+{
+	if (_buffer.size () == 0)
+	{
+		_buffer.resize (get_workspace_len ());
+	}
+
+	return (&_buffer [0]);
+}
+
+
+
+// For each radix-4 pass on nbr_coef points, nbr_coef / 4 values of w ^ 1,
+// w ^ 2 and w ^ 3, real parts then imaginary parts, with
+// w = exp (-2*PI*i*p / nbr_coef).
+template <class DT>
+void	FFTComplex <DT>::init_twiddle ()
+{
+	using namespace std;
+
+	long				total_len = 0;
+	for (long n = _length; n >= 4; n >>= 2)
+	{
+		total_len += (n >> 2) * 6;
+	}
+	if (total_len == 0)
+	{
+		return;
+	}
+	_twiddle.resize (total_len);
+
+	long				pos = 0;
+	for (long n = _length; n >= 4; n >>= 2)
+	{
+		const long		quarter = n >> 2;
+		const double	mul = -2 * PI / n;
+		for (int r = 1; r <= 3; ++r)
+		{
+			DataType * const	tw_ptr = &_twiddle [pos + (r - 1) * 2 * quarter];
+			for (long p = 0; p < quarter; ++p)
+			{
+				const double	angle = mul * ((r * p) % n);
+				tw_ptr [p          ] = DataType (cos (angle));
+				tw_ptr [p + quarter] = DataType (sin (angle));
+			}
+		}
+		pos += quarter * 6;
+	}
+	assert (pos == total_len);
+}
+
+
+
+// The passes alternate between f and the workspace, the last one writes in
+// f. In place with an odd number of passes, the first one would overwrite
+// its own source, so the source is copied to the workspace first.
+template <class DT>
+void	FFTComplex <DT>::compute (DataType fr [], DataType fi [], const DataType xr [], const DataType xi [], DataType ws []) const
+{
+	assert (fr != 0);
+	assert (fi != 0);
+	assert (xr != 0);
+	assert (xi != 0);
+	assert (ws != 0);
+	assert (fr != fi);
+	assert ((fr == xr) == (fi == xi));
+	assert (fr != xi && fi != xr);
+
+	DataType * const	wr = ws;
+	DataType * const	wi = ws + _length;
+
+	const DataType *	sr = xr;
+	const DataType *	si = xi;
+	DataType *		dr = fr;
+	DataType *		di = fi;
+	if ((_nbr_passes & 1) == 0)
+	{
+		dr = wr;
+		di = wi;
+	}
+	else if (fr == xr)
+	{
+		for (long pos = 0; pos < _length; ++pos)
+		{
+			wr [pos] = xr [pos];
+			wi [pos] = xi [pos];
+		}
+		sr = wr;
+		si = wi;
+	}
+
+	const DataType *	tw_ptr = (_twiddle.size () > 0) ? &_twiddle [0] : 0;
+	long				nbr_coef = _length;
+	long				stride = 1;
+	while (nbr_coef >= 4)
+	{
+		compute_pass_4 (dr, di, sr, si, nbr_coef, stride, tw_ptr);
+		tw_ptr += (nbr_coef >> 2) * 6;
+		nbr_coef >>= 2;
+		stride <<= 2;
+
+		sr = dr;
+		si = di;
+		dr = (dr == fr) ? wr : fr;
+		di = (di == fi) ? wi : fi;
+	}
+
+	if (nbr_coef == 2)
+	{
+		compute_pass_2 (dr, di, sr, si, stride);
+	}
+}
+
+
+
+// First nbr_coef-point stage of the remaining transform, on stride
+// interleaved sequences:
+// d [q + stride * (4 * p + r)] = w ^ (r * p) * sum (s [q + stride * (p + l * nbr_coef/4)] * (-i) ^ (r * l)), l in [0 ; 3]
+template <class DT>
+void	FFTComplex <DT>::compute_pass_4 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long nbr_coef, long stride, const DataType tw_ptr []) const
+{
+	assert (nbr_coef >= 4);
+	assert (tw_ptr != 0);
+
+	if (FFTRealSimd <DT>::complex_pass_4 (_simd_level, dr, di, sr, si, nbr_coef, stride, tw_ptr))
+	{
+		return;
+	}
+
+	const long		quarter = nbr_coef >> 2;
+	const long		dist = quarter * stride;
+	const DataType * const	w1r_ptr = tw_ptr;
+	const DataType * const	w1i_ptr = tw_ptr + quarter;
+	const DataType * const	w2r_ptr = tw_ptr + quarter * 2;
+	const DataType * const	w2i_ptr = tw_ptr + quarter * 3;
+	const DataType * const	w3r_ptr = tw_ptr + quarter * 4;
+	const DataType * const	w3i_ptr = tw_ptr + quarter * 5;
+
+	for (long p = 0; p < quarter; ++p)
+	{
+		const DataType	w1r = w1r_ptr [p];
+		const DataType	w1i = w1i_ptr [p];
+		const DataType	w2r = w2r_ptr [p];
+		const DataType	w2i = w2i_ptr [p];
+		const DataType	w3r = w3r_ptr [p];
+		const DataType	w3i = w3i_ptr [p];
+
+		const DataType * const	sr0 = sr + p * stride;
+		const DataType * const	si0 = si + p * stride;
+		DataType * const	dr0 = dr + p * 4 * stride;
+		DataType * const	di0 = di + p * 4 * stride;
+
+		for (long q = 0; q < stride; ++q)
+		{
+			const DataType	apc_r = sr0 [q] + sr0 [q + dist * 2];
+			const DataType	apc_i = si0 [q] + si0 [q + dist * 2];
+			const DataType	amc_r = sr0 [q] - sr0 [q + dist * 2];
+			const DataType	amc_i = si0 [q] - si0 [q + dist * 2];
+			const DataType	bpd_r = sr0 [q + dist] + sr0 [q + dist * 3];
+			const DataType	bpd_i = si0 [q + dist] + si0 [q + dist * 3];
+			const DataType	bmd_r = sr0 [q + dist] - sr0 [q + dist * 3];
+			const DataType	bmd_i = si0 [q + dist] - si0 [q + dist * 3];
+
+			dr0 [q] = apc_r + bpd_r;
+			di0 [q] = apc_i + bpd_i;
+
+			// (a - c) - i * (b - d)
+			const DataType	t1r = amc_r + bmd_i;
+			const DataType	t1i = amc_i - bmd_r;
+			dr0 [q + stride] = t1r * w1r - t1i * w1i;
+			di0 [q + stride] = t1r * w1i + t1i * w1r;
+
+			const DataType	t2r = apc_r - bpd_r;
+			const DataType	t2i = apc_i - bpd_i;
+			dr0 [q + stride * 2] = t2r * w2r - t2i * w2i;
+			di0 [q + stride * 2] = t2r * w2i + t2i * w2r;
+
+			// (a - c) + i * (b - d)
+			const DataType	t3r = amc_r - bmd_i;
+			const DataType	t3i = amc_i + bmd_r;
+			dr0 [q + stride * 3] = t3r * w3r - t3i * w3i;
+			di0 [q + stride * 3] = t3r * w3i + t3i * w3r;
+		}
+	}
+}
+
+
+
+// Last stage, 2 points, no twiddle factor
+template <class DT>
+void	FFTComplex <DT>::compute_pass_2 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long stride) const
+{
+	if (FFTRealSimd <DT>::complex_pass_2 (_simd_level, dr, di, sr, si, stride))
+	{
+		return;
+	}
+
+	for (long q = 0; q < stride; ++q)
+	{
+		const DataType	ar = sr [q];
+		const DataType	ai = si [q];
+		const DataType	br = sr [q + stride];
+		const DataType	bi = si [q + stride];
+
+		dr [q] = ar + br;
+		di [q] = ai + bi;
+		dr [q + stride] = ar - br;
+		di [q + stride] = ai - bi;
+	}
+}
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_FFTComplex_CODEHEADER_INCLUDED
+
+#undef ffft_FFTComplex_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,138 @@
+/*****************************************************************************
+
+        FFTConvolver.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_FFTConvolver_HEADER_INCLUDED)
+#define	ffft_FFTConvolver_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/AllocatorHeap.h"
+#include	"ffft/DynArray.h"
+#include	"ffft/FFTRealFixLen.h"
+
+
+
+namespace ffft
+{
+
+
+
+// Streaming FIR filter of any length, uniformly partitioned overlap-save.
+// The impulse is cut into partitions of BLOCK_LEN taps, each one stored as
+// the spectrum of an FFT of twice that length. Every BLOCK_LEN input
+// samples, one FFT of the last two blocks is multiplied with all the
+// partitions against the matching older input spectra, and one inverse FFT
+// gives BLOCK_LEN output samples. The latency is BLOCK_LEN samples whatever
+// the impulse length, and the cost per sample grows with the number of
+// partitions only in the spectrum multiplications.
+// set_template() turns it into a cross-correlator: the template is used
+// reversed, so the output peaks len - 1 samples after the end of a match
+// (plus the latency).
+template <int LL2, class DT = FFTRealFixLenParam::DataType>
+class FFTConvolver
+{
+	typedef	int	CompileTimeCheck1 [(LL2 >= 2) ? 1 : -1];
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	DT	DataType;
+	typedef	FFTRealFixLen <LL2, DT>	FftType;
+
+	enum {			FFT_LEN		= FftType::FFT_LEN	};
+	enum {			BLOCK_LEN	= FFT_LEN / 2	};
+
+	explicit			FFTConvolver (Allocator &allocator = AllocatorHeap::use_instance ());
+	virtual			~FFTConvolver () {}
+
+	void				set_impulse (const DataType ir [], long len);
+	void				set_template (const DataType t [], long len);
+	long				get_impulse_len () const;
+	inline long		get_latency () const;
+	void				clear_buffers ();
+	void				process (DataType out [], const DataType in [], long nbr_spl);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	void				set_partitions (const DataType ir [], long len, bool reverse_flag);
+	void				process_block ();
+	static inline void
+							multiply_add (DataType acc [], const DataType a [], const DataType b []);
+
+	FftType			_fft;
+	long				_impulse_len;
+	long				_nbr_parts;
+	DynArray <DataType>
+							_ir_spec;		// Spectra of the partitions, scaled by 1/FFT_LEN
+	DynArray <DataType>
+							_fdl;			// Spectra of the last _nbr_parts input blocks, circular
+	long				_fdl_pos;		// Slot of the next input spectrum
+	DynArray <DataType>
+							_in_buf;		// Previous block, then the one being filled
+	DynArray <DataType>
+							_out_buf;		// Inverse FFT, the second half is the current output block
+	DynArray <DataType>
+							_acc;			// Product of the spectra
+	DynArray <DataType>
+							_ws;			// FFT workspace
+	long				_fill;			// Samples in the current block, [0 ; BLOCK_LEN[
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+							FFTConvolver (const FFTConvolver &other);
+	FFTConvolver &	operator = (const FFTConvolver &other);
+	bool				operator == (const FFTConvolver &other);
+	bool				operator != (const FFTConvolver &other);
+
+};	// class FFTConvolver
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/FFTConvolver.hpp"
+
+
+
+#endif	// ffft_FFTConvolver_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
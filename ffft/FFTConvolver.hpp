@@ -0,0 +1,307 @@
+/*****************************************************************************
+
+        FFTConvolver.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_FFTConvolver_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTConvolver code header.
+#endif
+#define	ffft_FFTConvolver_CURRENT_CODEHEADER
+
+#if ! defined (ffft_FFTConvolver_CODEHEADER_INCLUDED)
+#define	ffft_FFTConvolver_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<algorithm>
+
+#include	<cassert>
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: ctor
+Description:
+	The convolver outputs silence until set_impulse() or set_template() is
+	called.
+Input parameters:
+	- allocator: provides the FFT buffer and the spectra.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <int LL2, class DT>
+FFTConvolver <LL2, DT>::FFTConvolver (Allocator &allocator)
+:	_fft (allocator)
+,	_impulse_len (0)
+,	_nbr_parts (0)
+,	_ir_spec (allocator)
+,	_fdl (allocator)
+,	_fdl_pos (0)
+,	_in_buf (FFT_LEN, allocator)
+,	_out_buf (FFT_LEN, allocator)
+,	_acc (FFT_LEN, allocator)
+,	_ws (_fft.get_workspace_len (), allocator)
+,	_fill (0)
+{
+	clear_buffers ();
+}
+
+
+
+/*
+==============================================================================
+Name: set_impulse
+Description:
+	Set the impulse response of the filter and clear the signal history:
+	out [n] = sum (ir [k] * in [n - latency - k]), k in [0 ; len[
+Input parameters:
+	- ir: impulse response, len values.
+	- len: number of taps, 1 or more.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <int LL2, class DT>
+void	FFTConvolver <LL2, DT>::set_impulse (const DataType ir [], long len)
+{
+	set_partitions (ir, len, false);
+}
+
+
+
+/*
+==============================================================================
+Name: set_template
+Description:
+	Set the template of a cross-correlation and clear the signal history:
+	out [n] = sum (t [k] * in [n - latency - (len - 1) + k]), k in [0 ; len[
+Input parameters:
+	- t: template, len values.
+	- len: length of the template, 1 or more.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <int LL2, class DT>
+void	FFTConvolver <LL2, DT>::set_template (const DataType t [], long len)
+{
+	set_partitions (t, len, true);
+}
+
+
+
+template <int LL2, class DT>
+long	FFTConvolver <LL2, DT>::get_impulse_len () const
+{
+	return (_impulse_len);
+}
+
+
+
+template <int LL2, class DT>
+long	FFTConvolver <LL2, DT>::get_latency () const
+{
+	return (BLOCK_LEN);
+}
+
+
+
+// Forgets the past input, the impulse is kept
+template <int LL2, class DT>
+void	FFTConvolver <LL2, DT>::clear_buffers ()
+{
+	std::fill (&_in_buf [0], &_in_buf [0] + FFT_LEN, DataType (0));
+	std::fill (&_out_buf [0], &_out_buf [0] + FFT_LEN, DataType (0));
+	if (_nbr_parts > 0)
+	{
+		std::fill (&_fdl [0], &_fdl [0] + _nbr_parts * FFT_LEN, DataType (0));
+	}
+	_fdl_pos = 0;
+	_fill = 0;
+}
+
+
+
+/*
+==============================================================================
+Name: process
+Description:
+	Filter a chunk of the stream. Chunks can have any size, the blocks are
+	computed as soon as they are complete.
+	out may be in.
+Input parameters:
+	- in: input samples, nbr_spl values.
+	- nbr_spl: number of samples, 0 or more.
+Output parameters:
+	- out: output samples, nbr_spl values.
+Throws: Nothing
+==============================================================================
+*/
+
+template <int LL2, class DT>
+void	FFTConvolver <LL2, DT>::process (DataType out [], const DataType in [], long nbr_spl)
+{
+	assert (out != 0);
+	assert (in != 0);
+	assert (nbr_spl >= 0);
+
+	long				pos = 0;
+	while (pos < nbr_spl)
+	{
+		const long		work_len = std::min (nbr_spl - pos, BLOCK_LEN - _fill);
+
+		// Input first, out may be in
+		std::copy (in + pos, in + pos + work_len, &_in_buf [BLOCK_LEN + _fill]);
+		std::copy (
+			&_out_buf [BLOCK_LEN + _fill],
+			&_out_buf [BLOCK_LEN + _fill] + work_len,
+			out + pos
+		);
+
+		_fill += work_len;
+		pos += work_len;
+		if (_fill == BLOCK_LEN)
+		{
+			process_block ();
+			_fill = 0;
+		}
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <int LL2, class DT>
+void	FFTConvolver <LL2, DT>::set_partitions (const DataType ir [], long len, bool reverse_flag)
+{
+	assert (ir != 0);
+	assert (len > 0);
+
+	const long		nbr_parts = (len + BLOCK_LEN - 1) / BLOCK_LEN;
+	_ir_spec.resize (nbr_parts * FFT_LEN);
+	_fdl.resize (nbr_parts * FFT_LEN);
+	_impulse_len = len;
+	_nbr_parts = nbr_parts;
+
+	// Each partition is zero-padded to the FFT length. The inverse FFT
+	// scale is applied here, once.
+	const DataType	scale = DataType (1.0 / FFT_LEN);
+	DataType * const	tmp_ptr = &_acc [0];
+	for (long part = 0; part < nbr_parts; ++part)
+	{
+		const long		start = part * BLOCK_LEN;
+		const long		part_len = std::min (len - start, long (BLOCK_LEN));
+		for (long pos = 0; pos < part_len; ++pos)
+		{
+			const long		src = start + pos;
+			tmp_ptr [pos] = (reverse_flag ? ir [len - 1 - src] : ir [src]) * scale;
+		}
+		std::fill (tmp_ptr + part_len, tmp_ptr + FFT_LEN, DataType (0));
+
+		_fft.do_fft (&_ir_spec [part * FFT_LEN], tmp_ptr, &_ws [0]);
+	}
+
+	clear_buffers ();
+}
+
+
+
+// Overlap-save: the last BLOCK_LEN samples of the circular convolution of
+// the input window with each partition are the linear convolution.
+template <int LL2, class DT>
+void	FFTConvolver <LL2, DT>::process_block ()
+{
+	if (_nbr_parts > 0)
+	{
+		DataType * const	acc_ptr = &_acc [0];
+		_fft.do_fft (&_fdl [_fdl_pos * FFT_LEN], &_in_buf [0], &_ws [0]);
+
+		// Partition p goes with the input spectrum p blocks ago
+		std::fill (acc_ptr, acc_ptr + FFT_LEN, DataType (0));
+		long				slot = _fdl_pos;
+		for (long part = 0; part < _nbr_parts; ++part)
+		{
+			multiply_add (acc_ptr, &_fdl [slot * FFT_LEN], &_ir_spec [part * FFT_LEN]);
+			slot = (slot == 0) ? _nbr_parts - 1 : slot - 1;
+		}
+
+		_fft.do_ifft (acc_ptr, &_out_buf [0], &_ws [0]);
+
+		++ _fdl_pos;
+		if (_fdl_pos == _nbr_parts)
+		{
+			_fdl_pos = 0;
+		}
+	}
+
+	// The current block becomes the previous one
+	std::copy (&_in_buf [BLOCK_LEN], &_in_buf [0] + FFT_LEN, &_in_buf [0]);
+}
+
+
+
+// acc += a * b, spectra in the FFTReal layout. The imaginary parts are
+// negated in this layout, but the complex product keeps its usual formulas:
+// the signs cancel in both terms of each part.
+template <int LL2, class DT>
+void	FFTConvolver <LL2, DT>::multiply_add (DataType acc [], const DataType a [], const DataType b [])
+{
+	enum {			HALF = FFT_LEN / 2	};
+
+	acc [0   ] += a [0   ] * b [0   ];
+	acc [HALF] += a [HALF] * b [HALF];
+	for (long bin = 1; bin < HALF; ++bin)
+	{
+		const DataType	ar = a [bin];
+		const DataType	ai = a [HALF + bin];
+		const DataType	br = b [bin];
+		const DataType	bi = b [HALF + bin];
+		acc [bin       ] += ar * br - ai * bi;
+		acc [HALF + bin] += ar * bi + ai * br;
+	}
+}
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_FFTConvolver_CODEHEADER_INCLUDED
+
+#undef ffft_FFTConvolver_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -28,7 +28,12 @@ http://sam.zoy.org/wtfpl/COPYING for more details.
 /*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
 #include	"ffft/def.h"
+#include	"ffft/AllocatorHeap.h"
 #include	"ffft/DynArray.h"
+#include	"ffft/FFTRealLanes.h"
+#include	"ffft/FFTRealPower.h"
+#include	"ffft/FFTRealRadix4.h"
+#include	"ffft/FFTRealSimd.h"
 #include	"ffft/OscSinCos.h"
 
 
@@ -50,12 +55,23 @@ public:
 
 	typedef	DT	DataType;
 
-	explicit			FFTReal (long length);
+	explicit			FFTReal (long length, Allocator &allocator = AllocatorHeap::use_instance ());
 	virtual			~FFTReal () {}
 
 	long				get_length () const;
+	long				get_workspace_len () const;
 	void				do_fft (DataType f [], const DataType x []) const;
+	void				do_fft (DataType f [], const DataType x [], DataType ws []) const;
 	void				do_ifft (const DataType f [], DataType x []) const;
+	void				do_ifft (const DataType f [], DataType x [], DataType ws []) const;
+	void				do_fft_pruned (DataType f [], const DataType x [], long nbr_samples) const;
+	void				do_fft_pruned (DataType f [], const DataType x [], long nbr_samples, DataType ws []) const;
+	void				do_power_spectrum (DataType out [], const DataType x [], DataType exponent) const;
+	void				do_power_spectrum (DataType out [], const DataType x [], DataType exponent, DataType ws []) const;
+	void				do_fft_batch (DataType f [], const DataType x [], long nbr_frames) const;
+	void				do_fft_batch (DataType f [], const DataType x [], long nbr_frames, DataType ws []) const;
+	void				do_ifft_batch (const DataType f [], DataType x [], long nbr_frames) const;
+	void				do_ifft_batch (const DataType f [], DataType x [], long nbr_frames, DataType ws []) const;
 	void				rescale (DataType x []) const;
 	DataType *		use_buffer () const;
 
@@ -74,7 +90,15 @@ private:
    // Over this bit depth, we use direct calculation for sin/cos
    enum {	      TRIGO_BD_LIMIT	= 12  };
 
+	// Batches: passes up to this bit depth are done block by block (in
+	// vectors, so NBR_LANES times this in scalars)
+	enum {			LANES_BLOCK_BD	= 10	};
+
 	typedef	OscSinCos <DataType>	OscType;
+	typedef	FFTRealLanes <DataType>	Lanes;
+	typedef	typename Lanes::VectorType	LaneVector;
+
+	DataType *		use_batch_buffer () const;
 
 	void				init_br_lut ();
 	void				init_trigo_lut ();
@@ -87,20 +111,36 @@ private:
 	ffft_FORCEINLINE long
 						get_trigo_level_index (int level) const;
 
-	inline void		compute_fft_general (DataType f [], const DataType x []) const;
+	inline void		compute_fft_general (DataType f [], const DataType x [], DataType ws [], DataType exponent) const;
+	inline void		compute_fft_pruned (DataType f [], const DataType x [], DataType ws [], int nbr_skip) const;
 	inline void		compute_direct_pass_1_2 (DataType df [], const DataType x []) const;
+	inline void		compute_direct_pruned_1_2 (DataType df [], const DataType x []) const;
+	inline void		compute_direct_pruned_n (DataType df [], const DataType x [], int nbr_skip) const;
 	inline void		compute_direct_pass_3 (DataType df [], const DataType sf []) const;
 	inline void		compute_direct_pass_n (DataType df [], const DataType sf [], int pass) const;
 	inline void		compute_direct_pass_n_lut (DataType df [], const DataType sf [], int pass) const;
 	inline void		compute_direct_pass_n_osc (DataType df [], const DataType sf [], int pass) const;
+	inline void		compute_direct_pass_n2 (DataType df [], const DataType sf [], int pass) const;
+	inline void		compute_power_pass_n2 (DataType out [], const DataType sf [], int pass, DataType exponent) const;
 
-	inline void		compute_ifft_general (const DataType f [], DataType x []) const;
+	inline void		compute_ifft_general (const DataType f [], DataType x [], DataType ws []) const;
 	inline void		compute_inverse_pass_n (DataType df [], const DataType sf [], int pass) const;
 	inline void		compute_inverse_pass_n_osc (DataType df [], const DataType sf [], int pass) const;
 	inline void		compute_inverse_pass_n_lut (DataType df [], const DataType sf [], int pass) const;
+	inline void		compute_inverse_pass_n2 (DataType df [], const DataType sf [], int pass) const;
 	inline void		compute_inverse_pass_3 (DataType df [], const DataType sf []) const;
 	inline void		compute_inverse_pass_1_2 (DataType x [], const DataType sf []) const;
 
+	inline void		compute_fft_lanes (DataType f [], const DataType x [], DataType ws []) const;
+	inline void		compute_direct_lanes_1_2 (LaneVector df [], const LaneVector x [], long pos, long len) const;
+	inline void		compute_direct_lanes_3 (LaneVector df [], const LaneVector sf [], long pos, long len) const;
+	inline void		compute_direct_lanes_n (LaneVector df [], const LaneVector sf [], int pass, long pos, long len) const;
+
+	inline void		compute_ifft_lanes (const DataType f [], DataType x [], DataType ws []) const;
+	inline void		compute_inverse_lanes_n (LaneVector df [], const LaneVector sf [], int pass, long pos, long len) const;
+	inline void		compute_inverse_lanes_3 (LaneVector df [], const LaneVector sf [], long pos, long len) const;
+	inline void		compute_inverse_lanes_1_2 (LaneVector x [], const LaneVector sf [], long pos, long len) const;
+
 	const long		_length;
 	const int		_nbr_bits;
 	DynArray <long>
@@ -108,9 +148,12 @@ private:
 	DynArray <DataType>
 						_trigo_lut;
 	mutable DynArray <DataType>
-						_buffer;
-   mutable DynArray <OscType>
-						_trigo_osc;
+						_buffer;			// Workspace for the functions called without one
+	DynArray <OscType>
+						_trigo_osc;		// Copied before use, so the object stays untouched
+	mutable DynArray <DataType>
+						_batch_buffer;	// Same for the batches, allocated on first use
+	const int		_simd_level;	// SimdLevel, fixed at construction
 
 
 
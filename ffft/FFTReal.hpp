@@ -82,18 +82,22 @@ Name: ctor
 Input parameters:
 	- length: length of the array on which we want to do a FFT. Range: power of
 		2 only, > 0.
-Throws: std::bad_alloc
+	- allocator: where the tables and buffers are taken from. Must outlive
+		the object.
+Throws: std::bad_alloc, or whatever the allocator throws.
 ==============================================================================
 */
 
 template <class DT>
-FFTReal <DT>::FFTReal (long length)
+FFTReal <DT>::FFTReal (long length, Allocator &allocator)
 :	_length (length)
 ,	_nbr_bits (FFTReal_get_next_pow2 (length))
-,	_br_lut ()
-,	_trigo_lut ()
-,	_buffer (length)
-,	_trigo_osc ()
+,	_br_lut (allocator)
+,	_trigo_lut (allocator)
+,	_buffer (length, allocator)
+,	_trigo_osc (allocator)
+,	_batch_buffer (allocator)
+,	_simd_level (FFTRealSimd <DT>::get_level ())
 {
 	assert (FFTReal_is_pow2 (length));
 	assert (_nbr_bits <= MAX_BIT_DEPTH);
@@ -123,6 +127,32 @@ long	FFTReal <DT>::get_length () const
 
 
 
+/*
+==============================================================================
+Name: get_workspace_len
+Description:
+	Size of the workspace the reentrant functions need, single-frame or
+	batched.
+Returns: The number of values, >= length.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+long	FFTReal <DT>::get_workspace_len () const
+{
+	long				len = _length;
+	if (_nbr_bits > 2 && Lanes::is_usable (_simd_level))
+	{
+		// Two lane buffers
+		len = _length * 2 * long (sizeof (LaneVector) / sizeof (DataType));
+	}
+
+	return (len);
+}
+
+
+
 /*
 ==============================================================================
 Name: do_fft
@@ -141,17 +171,43 @@ Throws: Nothing
 
 template <class DT>
 void	FFTReal <DT>::do_fft (DataType f [], const DataType x []) const
+{
+	do_fft (f, x, use_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_fft
+Description:
+	Same as above, but the temporary data goes to ws instead of the internal
+	buffer. The object is only read, so several threads can use it at the
+	same time, each one with its own workspace.
+Input parameters:
+	- x: pointer on the source array (time).
+Output parameters:
+	- f: pointer on the destination array (frequencies).
+Input/output parameters:
+	- ws: workspace, get_workspace_len() values at least.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTReal <DT>::do_fft (DataType f [], const DataType x [], DataType ws []) const
 {
 	assert (f != 0);
-	assert (f != use_buffer ());
 	assert (x != 0);
-	assert (x != use_buffer ());
 	assert (x != f);
+	assert (ws != 0);
+	assert (ws != f);
+	assert (ws != x);
 
 	// General case
 	if (_nbr_bits > 2)
 	{
-		compute_fft_general (f, x);
+		compute_fft_general (f, x, ws, 0);
 	}
 
 	// 4-point FFT
@@ -183,6 +239,60 @@ void	FFTReal <DT>::do_fft (DataType f [], const DataType x []) const
 
 
 
+/*
+==============================================================================
+Name: do_fft_pruned
+Description:
+	Same as do_fft(), for an input made of nbr_samples values followed by
+	zeros, like a zero-padded frame. The first passes, where each group of
+	butterflies sees a single non-zero sample, are replaced by a copy: with
+	nbr_samples <= length / 2^k, k passes are skipped.
+	The first call allocates a work area of get_workspace_len() values.
+Input parameters:
+	- x: pointer on the source array (time), length values. x [pos] must be
+		0 for pos >= nbr_samples. Only the values up to the next power of 2
+		are read.
+	- nbr_samples: number of leading samples that may be non-zero, in
+		[1 ; length].
+Output parameters:
+	- f: pointer on the destination array (frequencies), see do_fft().
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <class DT>
+void	FFTReal <DT>::do_fft_pruned (DataType f [], const DataType x [], long nbr_samples) const
+{
+	do_fft_pruned (f, x, nbr_samples, use_buffer ());
+}
+
+
+
+// Reentrant version, see do_fft()
+template <class DT>
+void	FFTReal <DT>::do_fft_pruned (DataType f [], const DataType x [], long nbr_samples, DataType ws []) const
+{
+	assert (nbr_samples > 0);
+	assert (nbr_samples <= _length);
+
+	int				nbr_skip = 0;
+	while ((_length >> (nbr_skip + 1)) >= nbr_samples)
+	{
+		++ nbr_skip;
+	}
+
+	if (_nbr_bits > 2 && nbr_skip > 0)
+	{
+		compute_fft_pruned (f, x, ws, nbr_skip);
+	}
+	else
+	{
+		do_fft (f, x, ws);
+	}
+}
+
+
+
 /*
 ==============================================================================
 Name: do_ifft
@@ -202,17 +312,41 @@ Throws: Nothing
 
 template <class DT>
 void	FFTReal <DT>::do_ifft (const DataType f [], DataType x []) const
+{
+	do_ifft (f, x, use_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_ifft
+Description:
+	Reentrant version, see do_fft().
+Input parameters:
+	- f: pointer on the source array (frequencies).
+Output parameters:
+	- x: pointer on the destination array (time).
+Input/output parameters:
+	- ws: workspace, get_workspace_len() values at least.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTReal <DT>::do_ifft (const DataType f [], DataType x [], DataType ws []) const
 {
 	assert (f != 0);
-	assert (f != use_buffer ());
 	assert (x != 0);
-	assert (x != use_buffer ());
 	assert (x != f);
+	assert (ws != 0);
+	assert (ws != f);
+	assert (ws != x);
 
 	// General case
 	if (_nbr_bits > 2)
 	{
-		compute_ifft_general (f, x);
+		compute_ifft_general (f, x, ws);
 	}
 
 	// 4-point IFFT
@@ -243,6 +377,211 @@ void	FFTReal <DT>::do_ifft (const DataType f [], DataType x []) const
 
 
 
+/*
+==============================================================================
+Name: do_power_spectrum
+Description:
+	Compute the power of each bin of the FFT of the array, raised to the
+	given exponent as in FFTRealPower::compute(). From 64 points, the last
+	sweep of the transform computes the power directly instead of storing
+	the spectrum, see FFTRealPower::compute_pass_lut().
+Input parameters:
+	- x: pointer on the source array (time).
+	- exponent: > 0. 1 gives the power spectrum, 0.5 the magnitudes.
+Output parameters:
+	- out: pointer on the destination array, length(x) values.
+		out [0...length(x)/2] = (re ^ 2 + im ^ 2) ^ exponent,
+		the other values are overwritten.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTReal <DT>::do_power_spectrum (DataType out [], const DataType x [], DataType exponent) const
+{
+	do_power_spectrum (out, x, exponent, use_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_power_spectrum
+Description:
+	Reentrant version, see do_fft().
+Input parameters:
+	- x: pointer on the source array (time).
+	- exponent: > 0.
+Output parameters:
+	- out: pointer on the destination array, length(x) values.
+Input/output parameters:
+	- ws: workspace, get_workspace_len() values at least.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTReal <DT>::do_power_spectrum (DataType out [], const DataType x [], DataType exponent, DataType ws []) const
+{
+	assert (out != 0);
+	assert (x != 0);
+	assert (x != out);
+	assert (ws != 0);
+	assert (exponent > 0);
+
+	// The last sweep is two passes at once
+	if (_nbr_bits >= 6)
+	{
+		compute_fft_general (out, x, ws, exponent);
+	}
+
+	else
+	{
+		do_fft (out, x, ws);
+		FFTRealPower <DT>::compute (out, out, _length, exponent);
+	}
+}
+
+
+
+/*
+==============================================================================
+Name: do_fft_batch
+Description:
+	Compute the FFT of several frames at once. Frames are processed in groups
+	of FFTRealLanes::NBR_LANES, one frame per vector lane, so the twiddle
+	factors and bit-reversed indexes are shared by the group. The remaining
+	frames go through do_fft().
+	The first call allocates a work area of get_workspace_len() values.
+Input parameters:
+	- x: pointer on the source frames (time), nbr_frames * length values, one
+		frame after the other.
+	- nbr_frames: number of frames, >= 0.
+Output parameters:
+	- f: pointer on the destination frames (frequencies), same layout as x.
+		See do_fft() for the format of each frame.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <class DT>
+void	FFTReal <DT>::do_fft_batch (DataType f [], const DataType x [], long nbr_frames) const
+{
+	do_fft_batch (f, x, nbr_frames, use_batch_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_fft_batch
+Description:
+	Reentrant version, see do_fft().
+Input parameters:
+	- x: pointer on the source frames (time).
+	- nbr_frames: number of frames, >= 0.
+Output parameters:
+	- f: pointer on the destination frames (frequencies).
+Input/output parameters:
+	- ws: workspace, get_workspace_len() values at least, aligned like the
+		DynArray storage.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTReal <DT>::do_fft_batch (DataType f [], const DataType x [], long nbr_frames, DataType ws []) const
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (x != f);
+	assert (nbr_frames >= 0);
+	assert (ws != 0);
+
+	long				frame = 0;
+	if (_nbr_bits > 2 && Lanes::is_usable (_simd_level))
+	{
+		for ( ; frame + Lanes::NBR_LANES <= nbr_frames; frame += Lanes::NBR_LANES)
+		{
+			compute_fft_lanes (f + frame * _length, x + frame * _length, ws);
+		}
+	}
+
+	for ( ; frame < nbr_frames; ++frame)
+	{
+		do_fft (f + frame * _length, x + frame * _length, ws);
+	}
+}
+
+
+
+/*
+==============================================================================
+Name: do_ifft_batch
+Description:
+	Compute the inverse FFT of several frames at once, see do_fft_batch().
+	Data must be post-scaled, as with do_ifft().
+Input parameters:
+	- f: pointer on the source frames (frequencies), nbr_frames * length
+		values, one frame after the other.
+	- nbr_frames: number of frames, >= 0.
+Output parameters:
+	- x: pointer on the destination frames (time), same layout as f.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <class DT>
+void	FFTReal <DT>::do_ifft_batch (const DataType f [], DataType x [], long nbr_frames) const
+{
+	do_ifft_batch (f, x, nbr_frames, use_batch_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_ifft_batch
+Description:
+	Reentrant version, see do_fft().
+Input parameters:
+	- f: pointer on the source frames (frequencies).
+	- nbr_frames: number of frames, >= 0.
+Output parameters:
+	- x: pointer on the destination frames (time).
+Input/output parameters:
+	- ws: workspace, get_workspace_len() values at least, aligned like the
+		DynArray storage.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTReal <DT>::do_ifft_batch (const DataType f [], DataType x [], long nbr_frames, DataType ws []) const
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (x != f);
+	assert (nbr_frames >= 0);
+	assert (ws != 0);
+
+	long				frame = 0;
+	if (_nbr_bits > 2 && Lanes::is_usable (_simd_level))
+	{
+		for ( ; frame + Lanes::NBR_LANES <= nbr_frames; frame += Lanes::NBR_LANES)
+		{
+			compute_ifft_lanes (f + frame * _length, x + frame * _length, ws);
+		}
+	}
+
+	for ( ; frame < nbr_frames; ++frame)
+	{
+		do_ifft (f + frame * _length, x + frame * _length, ws);
+	}
+}
+
+
+
 /*
 ==============================================================================
 Name: rescale
@@ -322,6 +661,20 @@ typename FFTReal <DT>::DataType *	FFTReal <DT>::use_buffer () const
 
 
 
+// Workspace for the batches called without one, allocated on first use
+template <class DT>
+typename FFTReal <DT>::DataType *	FFTReal <DT>::use_batch_buffer () const
+{
+	if (_batch_buffer.size () == 0)
+	{
+		_batch_buffer.resize (get_workspace_len ());
+	}
+
+	return (&_batch_buffer [0]);
+}
+
+
+
 template <class DT>
 void	FFTReal <DT>::init_br_lut ()
 {
@@ -421,36 +774,56 @@ long	FFTReal <DT>::get_trigo_level_index (int level) const
 
 
 
-// Transform in several passes
+// Transform in several passes. Passes from 4 are done two by two (radix 4),
+// the odd one if any comes first. Pass 3 is too short for the vector code.
+// With an exponent > 0, a last sweep of two passes gives the power of the
+// bins instead of the spectrum, see do_power_spectrum().
 template <class DT>
-void	FFTReal <DT>::compute_fft_general (DataType f [], const DataType x []) const
+void	FFTReal <DT>::compute_fft_general (DataType f [], const DataType x [], DataType ws [], DataType exponent) const
 {
 	assert (f != 0);
-	assert (f != use_buffer ());
 	assert (x != 0);
-	assert (x != use_buffer ());
 	assert (x != f);
+	assert (ws != 0);
 
 	DataType *		sf;
 	DataType *		df;
 
-	if ((_nbr_bits & 1) != 0)
+	// Sweeps over the data, the last one must write in f
+	const int		nbr_sweeps =
+		(_nbr_bits <= 3) ? 2 : 3 + (_nbr_bits - 3) / 2;
+	if ((nbr_sweeps & 1) == 0)
 	{
-		df = use_buffer ();
+		df = ws;
 		sf = f;
 	}
 	else
 	{
 		df = f;
-		sf = use_buffer ();
+		sf = ws;
 	}
 
 	compute_direct_pass_1_2 (df, x);
 	compute_direct_pass_3 (sf, df);
 
-	for (int pass = 3; pass < _nbr_bits; ++ pass)
+	int				pass = 3;
+	while (pass < _nbr_bits)
 	{
-		compute_direct_pass_n (df, sf, pass);
+		if (pass == 3 || ((_nbr_bits - pass) & 1) != 0)
+		{
+			compute_direct_pass_n (df, sf, pass);
+			++ pass;
+		}
+		else if (exponent > 0 && pass + 2 == _nbr_bits)
+		{
+			compute_power_pass_n2 (df, sf, pass, exponent);
+			pass += 2;
+		}
+		else
+		{
+			compute_direct_pass_n2 (df, sf, pass);
+			pass += 2;
+		}
 
 		DataType * const	temp_ptr = df;
 		df = sf;
@@ -460,46 +833,230 @@ void	FFTReal <DT>::compute_fft_general (DataType f [], const DataType x []) cons
 
 
 
+// do_fft_pruned(). The first nbr_skip passes are replaced with
+// compute_direct_pruned_1_2() or compute_direct_pruned_n(), then the
+// passes go on as in compute_fft_general().
 template <class DT>
-void	FFTReal <DT>::compute_direct_pass_1_2 (DataType df [], const DataType x []) const
+void	FFTReal <DT>::compute_fft_pruned (DataType f [], const DataType x [], DataType ws [], int nbr_skip) const
 {
-	assert (df != 0);
+	assert (f != 0);
 	assert (x != 0);
-	assert (df != x);
-
-	const long * const	bit_rev_lut_ptr = get_br_ptr ();
-	long				coef_index = 0;
-	do
+	assert (x != f);
+	assert (ws != 0);
+	assert (_nbr_bits > 2);
+	assert (nbr_skip > 0);
+	assert (nbr_skip <= _nbr_bits);
+
+	// Passes done by the first sweep
+	const int		first_pass = (nbr_skip >= 2) ? nbr_skip : 2;
+
+	// Counts the sweeps, the last one must write in f
+	int				nbr_sweeps = 1;
+	int				pass = first_pass;
+	if (pass == 2)
 	{
-		const long		rev_index_0 = bit_rev_lut_ptr [coef_index];
-		const long		rev_index_1 = bit_rev_lut_ptr [coef_index + 1];
-		const long		rev_index_2 = bit_rev_lut_ptr [coef_index + 2];
-		const long		rev_index_3 = bit_rev_lut_ptr [coef_index + 3];
-
-		DataType	* const	df2 = df + coef_index;
-		df2 [1] = x [rev_index_0] - x [rev_index_1];
-		df2 [3] = x [rev_index_2] - x [rev_index_3];
+		++ nbr_sweeps;
+		pass = 3;
+	}
+	while (pass < _nbr_bits)
+	{
+		pass += (pass == 3 || ((_nbr_bits - pass) & 1) != 0) ? 1 : 2;
+		++ nbr_sweeps;
+	}
 
-		const DataType	sf_0 = x [rev_index_0] + x [rev_index_1];
-		const DataType	sf_2 = x [rev_index_2] + x [rev_index_3];
+	// The current data is always in sf
+	DataType *		sf = ((nbr_sweeps & 1) != 0) ? f : ws;
+	DataType *		df = (sf == f) ? ws : f;
 
-		df2 [0] = sf_0 + sf_2;
-		df2 [2] = sf_0 - sf_2;
-		
-		coef_index += 4;
+	if (nbr_skip == 1)
+	{
+		compute_direct_pruned_1_2 (sf, x);
+	}
+	else
+	{
+		compute_direct_pruned_n (sf, x, nbr_skip);
 	}
-	while (coef_index < _length);
-}
-
 
+	pass = first_pass;
+	if (pass == 2)
+	{
+		compute_direct_pass_3 (df, sf);
+		pass = 3;
 
-template <class DT>
+		DataType * const	temp_ptr = df;
+		df = sf;
+		sf = temp_ptr;
+	}
+
+	while (pass < _nbr_bits)
+	{
+		if (pass == 3 || ((_nbr_bits - pass) & 1) != 0)
+		{
+			compute_direct_pass_n (df, sf, pass);
+			++ pass;
+		}
+		else
+		{
+			compute_direct_pass_n2 (df, sf, pass);
+			pass += 2;
+		}
+
+		DataType * const	temp_ptr = df;
+		df = sf;
+		sf = temp_ptr;
+	}
+
+	assert (sf == f);
+}
+
+
+
+template <class DT>
+void	FFTReal <DT>::compute_direct_pass_1_2 (DataType df [], const DataType x []) const
+{
+	assert (df != 0);
+	assert (x != 0);
+	assert (df != x);
+
+	if (FFTRealSimd <DT>::direct_pass_1_2 (_simd_level, df, x, get_br_ptr (), 4, _length))
+	{
+		return;
+	}
+
+	const long * const	bit_rev_lut_ptr = get_br_ptr ();
+	long				coef_index = 0;
+	do
+	{
+		const long		rev_index_0 = bit_rev_lut_ptr [coef_index];
+		const long		rev_index_1 = bit_rev_lut_ptr [coef_index + 1];
+		const long		rev_index_2 = bit_rev_lut_ptr [coef_index + 2];
+		const long		rev_index_3 = bit_rev_lut_ptr [coef_index + 3];
+
+		DataType	* const	df2 = df + coef_index;
+		df2 [1] = x [rev_index_0] - x [rev_index_1];
+		df2 [3] = x [rev_index_2] - x [rev_index_3];
+
+		const DataType	sf_0 = x [rev_index_0] + x [rev_index_1];
+		const DataType	sf_2 = x [rev_index_2] + x [rev_index_3];
+
+		df2 [0] = sf_0 + sf_2;
+		df2 [2] = sf_0 - sf_2;
+		
+		coef_index += 4;
+	}
+	while (coef_index < _length);
+}
+
+
+
+// compute_direct_pass_1_2() when the second half of x is 0: one of the two
+// samples of each first-pass butterfly is 0.
+template <class DT>
+void	FFTReal <DT>::compute_direct_pruned_1_2 (DataType df [], const DataType x []) const
+{
+	assert (df != 0);
+	assert (x != 0);
+	assert (df != x);
+
+	const long * const	br_ptr = get_br_ptr ();
+
+	long				coef_index = 0;
+	do
+	{
+		const DataType	x_0 = x [br_ptr [coef_index    ]];
+		const DataType	x_2 = x [br_ptr [coef_index + 2]];
+
+		df [coef_index    ] = x_0 + x_2;
+		df [coef_index + 1] = x_0;
+		df [coef_index + 2] = x_0 - x_2;
+		df [coef_index + 3] = x_2;
+
+		coef_index += 4;
+	}
+	while (coef_index < _length);
+}
+
+
+
+// Result of the first nbr_skip passes when only the first sample of each
+// group of 2^nbr_skip (in bit-reversed order) can be non-zero. The spectrum
+// of a single sample is flat: all the real parts are equal to the sample,
+// the imaginary parts are 0.
+template <class DT>
+void	FFTReal <DT>::compute_direct_pruned_n (DataType df [], const DataType x [], int nbr_skip) const
+{
+	assert (df != 0);
+	assert (x != 0);
+	assert (df != x);
+	assert (nbr_skip >= 2);
+	assert (nbr_skip <= _nbr_bits);
+
+	const long * const	br_ptr = get_br_ptr ();
+	const long		block_len = 1L << nbr_skip;
+	const long		half_len = block_len >> 1;
+
+	long				coef_index = 0;
+	if (nbr_skip == 2)
+	{
+		do
+		{
+			const DataType	val = x [br_ptr [coef_index]];
+			df [coef_index    ] = val;
+			df [coef_index + 1] = val;
+			df [coef_index + 2] = val;
+			df [coef_index + 3] = 0;
+
+			coef_index += 4;
+		}
+		while (coef_index < _length);
+	}
+
+	// Blocks of 8 or more, filled 4 values at a time
+	else
+	{
+		do
+		{
+			const DataType	val = x [br_ptr [coef_index]];
+			DataType * const	blk_ptr = df + coef_index;
+			for (long pos = 0; pos < half_len; pos += 4)
+			{
+				blk_ptr [pos    ] = val;
+				blk_ptr [pos + 1] = val;
+				blk_ptr [pos + 2] = val;
+				blk_ptr [pos + 3] = val;
+			}
+			blk_ptr [half_len    ] = val;
+			blk_ptr [half_len + 1] = 0;
+			blk_ptr [half_len + 2] = 0;
+			blk_ptr [half_len + 3] = 0;
+			for (long pos = half_len + 4; pos < block_len; pos += 4)
+			{
+				blk_ptr [pos    ] = 0;
+				blk_ptr [pos + 1] = 0;
+				blk_ptr [pos + 2] = 0;
+				blk_ptr [pos + 3] = 0;
+			}
+
+			coef_index += block_len;
+		}
+		while (coef_index < _length);
+	}
+}
+
+
+
+template <class DT>
 void	FFTReal <DT>::compute_direct_pass_3 (DataType df [], const DataType sf []) const
 {
 	assert (df != 0);
 	assert (sf != 0);
 	assert (df != sf);
 
+	if (FFTRealSimd <DT>::direct_pass_3 (_simd_level, df, sf, _length))
+	{
+		return;
+	}
+
 	const DataType	sqrt2_2 = DataType (SQRT2 * 0.5);
 	long				coef_index = 0;
 	do
@@ -561,6 +1118,11 @@ void	FFTReal <DT>::compute_direct_pass_n_lut (DataType df [], const DataType sf
 	const long		d_nbr_coef = nbr_coef << 1;
 	long				coef_index = 0;
 	const DataType	* const	cos_ptr = get_trigo_ptr (pass);
+	if (FFTRealSimd <DT>::direct_pass_n_lut (_simd_level, df, sf, nbr_coef, _length, cos_ptr))
+	{
+		return;
+	}
+
 	do
 	{
 		const DataType	* const	sf1r = sf + coef_index;
@@ -612,7 +1174,12 @@ void	FFTReal <DT>::compute_direct_pass_n_osc (DataType df [], const DataType sf
 	const long		h_nbr_coef = nbr_coef >> 1;
 	const long		d_nbr_coef = nbr_coef << 1;
 	long				coef_index = 0;
-	OscType &		osc = _trigo_osc [pass - (TRIGO_BD_LIMIT + 1)];
+	OscType			osc (_trigo_osc [pass - (TRIGO_BD_LIMIT + 1)]);
+	if (FFTRealSimd <DT>::direct_pass_n_osc (_simd_level, df, sf, nbr_coef, _length, osc))
+	{
+		return;
+	}
+
 	do
 	{
 		const DataType	* const	sf1r = sf + coef_index;
@@ -654,36 +1221,117 @@ void	FFTReal <DT>::compute_direct_pass_n_osc (DataType df [], const DataType sf
 
 
 
+// Passes pass and pass + 1 in a single sweep, see FFTRealRadix4. The tables
+// go one level above TRIGO_BD_LIMIT, so the LUT is used as long as the first
+// pass does.
+template <class DT>
+void	FFTReal <DT>::compute_direct_pass_n2 (DataType df [], const DataType sf [], int pass) const
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (pass >= 4);
+	assert (pass + 1 < _nbr_bits);
+
+	const long		nbr_coef = 1 << pass;
+	if (pass <= TRIGO_BD_LIMIT)
+	{
+		const DataType * const	cos1_ptr = get_trigo_ptr (pass);
+		const DataType * const	cos2_ptr = get_trigo_ptr (pass + 1);
+		if (! FFTRealSimd <DT>::direct_pass_n2_lut (_simd_level, df, sf, nbr_coef, _length, cos1_ptr, cos2_ptr))
+		{
+			FFTRealRadix4 <DT>::direct_pass_lut (df, sf, nbr_coef, _length, cos1_ptr, cos2_ptr);
+		}
+	}
+	else
+	{
+		OscType			osc1 (_trigo_osc [pass - (TRIGO_BD_LIMIT + 1)]);
+		OscType			osc2 (_trigo_osc [pass + 1 - (TRIGO_BD_LIMIT + 1)]);
+		if (! FFTRealSimd <DT>::direct_pass_n2_osc (_simd_level, df, sf, nbr_coef, _length, osc1, osc2))
+		{
+			FFTRealRadix4 <DT>::direct_pass_osc (df, sf, nbr_coef, _length, osc1, osc2);
+		}
+	}
+}
+
+
+
+// Same as compute_direct_pass_n2() for the last sweep, see FFTRealPower
+template <class DT>
+void	FFTReal <DT>::compute_power_pass_n2 (DataType out [], const DataType sf [], int pass, DataType exponent) const
+{
+	assert (out != 0);
+	assert (sf != 0);
+	assert (out != sf);
+	assert (pass >= 4);
+	assert (pass + 2 == _nbr_bits);
+
+	const long		nbr_coef = 1 << pass;
+	if (pass <= TRIGO_BD_LIMIT)
+	{
+		const DataType * const	cos1_ptr = get_trigo_ptr (pass);
+		const DataType * const	cos2_ptr = get_trigo_ptr (pass + 1);
+		if (! FFTRealSimd <DT>::power_pass_n2_lut (_simd_level, out, sf, nbr_coef, cos1_ptr, cos2_ptr, exponent))
+		{
+			FFTRealPower <DT>::compute_pass_lut (out, sf, nbr_coef, cos1_ptr, cos2_ptr, exponent);
+		}
+	}
+	else
+	{
+		OscType			osc1 (_trigo_osc [pass - (TRIGO_BD_LIMIT + 1)]);
+		OscType			osc2 (_trigo_osc [pass + 1 - (TRIGO_BD_LIMIT + 1)]);
+		if (! FFTRealSimd <DT>::power_pass_n2_osc (_simd_level, out, sf, nbr_coef, osc1, osc2, exponent))
+		{
+			FFTRealPower <DT>::compute_pass_osc (out, sf, nbr_coef, osc1, osc2, exponent);
+		}
+	}
+}
+
+
+
 // Transform in several pass
 template <class DT>
-void	FFTReal <DT>::compute_ifft_general (const DataType f [], DataType x []) const
+void	FFTReal <DT>::compute_ifft_general (const DataType f [], DataType x [], DataType ws []) const
 {
 	assert (f != 0);
-	assert (f != use_buffer ());
 	assert (x != 0);
-	assert (x != use_buffer ());
 	assert (x != f);
+	assert (ws != 0);
 
 	DataType *		sf = const_cast <DataType *> (f);
 	DataType *		df;
 	DataType *		df_temp;
 
-	if (_nbr_bits & 1)
+	// Sweeps before the last passes, the last one must not write in x.
+	const int		nbr_sweeps =
+		(_nbr_bits <= 3) ? 1 : 2 + (_nbr_bits - 3) / 2;
+	if ((nbr_sweeps & 1) != 0)
 	{
-		df = use_buffer ();
+		df = ws;
 		df_temp = x;
 	}
 	else
 	{
 		df = x;
-		df_temp = use_buffer ();
+		df_temp = ws;
 	}
 
-	for (int pass = _nbr_bits - 1; pass >= 3; -- pass)
+	// Two by two (radix 4) down to pass 4, the odd pass if any comes last
+	int				pass = _nbr_bits - 1;
+	while (pass >= 3)
 	{
-		compute_inverse_pass_n (df, sf, pass);
+		if (pass >= 5)
+		{
+			compute_inverse_pass_n2 (df, sf, pass - 1);
+			pass -= 2;
+		}
+		else
+		{
+			compute_inverse_pass_n (df, sf, pass);
+			-- pass;
+		}
 
-		if (pass < _nbr_bits - 1)
+		if (sf != f)
 		{
 			DataType	* const	temp_ptr = df;
 			df = sf;
@@ -737,6 +1385,11 @@ void	FFTReal <DT>::compute_inverse_pass_n_lut (DataType df [], const DataType sf
 	const long		d_nbr_coef = nbr_coef << 1;
 	long				coef_index = 0;
 	const DataType * const	cos_ptr = get_trigo_ptr (pass);
+	if (FFTRealSimd <DT>::inverse_pass_n_lut (_simd_level, df, sf, nbr_coef, _length, cos_ptr))
+	{
+		return;
+	}
+
 	do
 	{
 		const DataType	* const	sfr = sf + coef_index;
@@ -787,7 +1440,12 @@ void	FFTReal <DT>::compute_inverse_pass_n_osc (DataType df [], const DataType sf
 	const long		h_nbr_coef = nbr_coef >> 1;
 	const long		d_nbr_coef = nbr_coef << 1;
 	long				coef_index = 0;
-	OscType &		osc = _trigo_osc [pass - (TRIGO_BD_LIMIT + 1)];
+	OscType			osc (_trigo_osc [pass - (TRIGO_BD_LIMIT + 1)]);
+	if (FFTRealSimd <DT>::inverse_pass_n_osc (_simd_level, df, sf, nbr_coef, _length, osc))
+	{
+		return;
+	}
+
 	do
 	{
 		const DataType	* const	sfr = sf + coef_index;
@@ -828,6 +1486,39 @@ void	FFTReal <DT>::compute_inverse_pass_n_osc (DataType df [], const DataType sf
 
 
 
+// Passes pass + 1 and pass in a single sweep, see FFTRealRadix4
+template <class DT>
+void	FFTReal <DT>::compute_inverse_pass_n2 (DataType df [], const DataType sf [], int pass) const
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (pass >= 4);
+	assert (pass + 1 < _nbr_bits);
+
+	const long		nbr_coef = 1 << pass;
+	if (pass <= TRIGO_BD_LIMIT)
+	{
+		const DataType * const	cos1_ptr = get_trigo_ptr (pass);
+		const DataType * const	cos2_ptr = get_trigo_ptr (pass + 1);
+		if (! FFTRealSimd <DT>::inverse_pass_n2_lut (_simd_level, df, sf, nbr_coef, _length, cos1_ptr, cos2_ptr))
+		{
+			FFTRealRadix4 <DT>::inverse_pass_lut (df, sf, nbr_coef, _length, cos1_ptr, cos2_ptr);
+		}
+	}
+	else
+	{
+		OscType			osc1 (_trigo_osc [pass - (TRIGO_BD_LIMIT + 1)]);
+		OscType			osc2 (_trigo_osc [pass + 1 - (TRIGO_BD_LIMIT + 1)]);
+		if (! FFTRealSimd <DT>::inverse_pass_n2_osc (_simd_level, df, sf, nbr_coef, _length, osc1, osc2))
+		{
+			FFTRealRadix4 <DT>::inverse_pass_osc (df, sf, nbr_coef, _length, osc1, osc2);
+		}
+	}
+}
+
+
+
 template <class DT>
 void	FFTReal <DT>::compute_inverse_pass_3 (DataType df [], const DataType sf []) const
 {
@@ -835,6 +1526,11 @@ void	FFTReal <DT>::compute_inverse_pass_3 (DataType df [], const DataType sf [])
 	assert (sf != 0);
 	assert (df != sf);
 
+	if (FFTRealSimd <DT>::inverse_pass_3 (_simd_level, df, sf, _length))
+	{
+		return;
+	}
+
 	const DataType	sqrt2_2 = DataType (SQRT2 * 0.5);
 	long				coef_index = 0;
 	do
@@ -867,6 +1563,11 @@ void	FFTReal <DT>::compute_inverse_pass_1_2 (DataType x [], const DataType sf []
 	assert (sf != 0);
 	assert (x != sf);
 
+	if (FFTRealSimd <DT>::inverse_pass_1_2 (_simd_level, x, sf, get_br_ptr (), 4, _length))
+	{
+		return;
+	}
+
 	const long *	bit_rev_lut_ptr = get_br_ptr ();
 	const DataType *	sf2 = sf;
 	long				coef_index = 0;
@@ -904,6 +1605,409 @@ void	FFTReal <DT>::compute_inverse_pass_1_2 (DataType x [], const DataType sf []
 
 
 
+// Batched transforms: the scalar passes, run on vectors whose lanes hold
+// NBR_LANES frames. x and f hold NBR_LANES frames one after the other.
+template <class DT>
+void	FFTReal <DT>::compute_fft_lanes (DataType f [], const DataType x [], DataType ws []) const
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (x != f);
+	assert (_nbr_bits > 2);
+
+	LaneVector *	sf = reinterpret_cast <LaneVector *> (ws);
+	LaneVector *	df = sf + _length;
+
+	// Bit-reversal is done here, so the first passes only touch their
+	// own block.
+	Lanes::interleave (sf, x, _length, get_br_ptr ());
+
+	// The vectors take NBR_LANES times more room than the scalars. The first
+	// passes work on independent blocks, finish them block by block while
+	// the block is still in the L1 cache.
+	const int		block_bits =
+		(_nbr_bits < LANES_BLOCK_BD) ? _nbr_bits : LANES_BLOCK_BD;
+	const long		block_len = 1L << block_bits;
+	for (long pos = 0; pos < _length; pos += block_len)
+	{
+		LaneVector *	sf_blk = sf;
+		LaneVector *	df_blk = df;
+		compute_direct_lanes_1_2 (df_blk, sf_blk, pos, block_len);
+		compute_direct_lanes_3 (sf_blk, df_blk, pos, block_len);
+
+		for (int pass = 3; pass < block_bits; ++ pass)
+		{
+			compute_direct_lanes_n (df_blk, sf_blk, pass, pos, block_len);
+
+			LaneVector * const	temp_ptr = df_blk;
+			df_blk = sf_blk;
+			sf_blk = temp_ptr;
+		}
+	}
+	if (((block_bits - 3) & 1) != 0)
+	{
+		LaneVector * const	temp_ptr = df;
+		df = sf;
+		sf = temp_ptr;
+	}
+
+	for (int pass = block_bits; pass < _nbr_bits; ++ pass)
+	{
+		compute_direct_lanes_n (df, sf, pass, 0, _length);
+
+		LaneVector * const	temp_ptr = df;
+		df = sf;
+		sf = temp_ptr;
+	}
+
+	Lanes::deinterleave (f, sf, _length, 0);
+}
+
+
+
+template <class DT>
+void	FFTReal <DT>::compute_direct_lanes_1_2 (LaneVector df [], const LaneVector x [], long pos, long len) const
+{
+	assert (df != 0);
+	assert (x != 0);
+	assert (df != x);
+	assert (pos >= 0);
+	assert (len > 0);
+	assert (pos + len <= _length);
+
+	// x is already in bit-reversed order, see compute_fft_lanes()
+	long				coef_index = pos;
+	do
+	{
+		const LaneVector * const	x2 = x + coef_index;
+		LaneVector * const	df2 = df + coef_index;
+		df2 [1] = x2 [0] - x2 [1];
+		df2 [3] = x2 [2] - x2 [3];
+
+		const LaneVector	sf_0 = x2 [0] + x2 [1];
+		const LaneVector	sf_2 = x2 [2] + x2 [3];
+
+		df2 [0] = sf_0 + sf_2;
+		df2 [2] = sf_0 - sf_2;
+
+		coef_index += 4;
+	}
+	while (coef_index < pos + len);
+}
+
+
+
+template <class DT>
+void	FFTReal <DT>::compute_direct_lanes_3 (LaneVector df [], const LaneVector sf [], long pos, long len) const
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (pos >= 0);
+	assert (len > 0);
+	assert (pos + len <= _length);
+
+	const DataType	sqrt2_2 = DataType (SQRT2 * 0.5);
+	long				coef_index = pos;
+	do
+	{
+		LaneVector		v;
+
+		df [coef_index] = sf [coef_index] + sf [coef_index + 4];
+		df [coef_index + 4] = sf [coef_index] - sf [coef_index + 4];
+		df [coef_index + 2] = sf [coef_index + 2];
+		df [coef_index + 6] = sf [coef_index + 6];
+
+		v = (sf [coef_index + 5] - sf [coef_index + 7]) * sqrt2_2;
+		df [coef_index + 1] = sf [coef_index + 1] + v;
+		df [coef_index + 3] = sf [coef_index + 1] - v;
+
+		v = (sf [coef_index + 5] + sf [coef_index + 7]) * sqrt2_2;
+		df [coef_index + 5] = v + sf [coef_index + 3];
+		df [coef_index + 7] = v - sf [coef_index + 3];
+
+		coef_index += 8;
+	}
+	while (coef_index < pos + len);
+}
+
+
+
+// Twiddle factors from the table or from the oscillators, like
+// compute_direct_pass_n(). They are shared by all the lanes.
+template <class DT>
+void	FFTReal <DT>::compute_direct_lanes_n (LaneVector df [], const LaneVector sf [], int pass, long pos, long len) const
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (pass >= 3);
+	assert (pass < _nbr_bits);
+	assert (pos >= 0);
+	assert (len > 0);
+	assert (pos + len <= _length);
+
+	const long		nbr_coef = 1 << pass;
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	const bool		lut_flag = (pass <= TRIGO_BD_LIMIT);
+	const DataType	* const	cos_ptr = lut_flag ? get_trigo_ptr (pass) : 0;
+	OscType			osc;
+	if (! lut_flag)
+	{
+		osc = _trigo_osc [pass - (TRIGO_BD_LIMIT + 1)];
+	}
+	long				coef_index = pos;
+	do
+	{
+		const LaneVector	* const	sf1r = sf + coef_index;
+		const LaneVector	* const	sf2r = sf1r + nbr_coef;
+		LaneVector			* const	dfr = df + coef_index;
+		LaneVector			* const	dfi = dfr + nbr_coef;
+
+		if (! lut_flag)
+		{
+			osc.clear_buffers ();
+		}
+
+		// Extreme coefficients are always real
+		dfr [0] = sf1r [0] + sf2r [0];
+		dfi [0] = sf1r [0] - sf2r [0];	// dfr [nbr_coef] =
+		dfr [h_nbr_coef] = sf1r [h_nbr_coef];
+		dfi [h_nbr_coef] = sf2r [h_nbr_coef];
+
+		// Others are conjugate complex numbers
+		const LaneVector * const	sf1i = sf1r + h_nbr_coef;
+		const LaneVector * const	sf2i = sf1i + nbr_coef;
+		for (long i = 1; i < h_nbr_coef; ++ i)
+		{
+			DataType			c;
+			DataType			s;
+			if (lut_flag)
+			{
+				c = cos_ptr [i];					// cos (i*PI/nbr_coef);
+				s = cos_ptr [h_nbr_coef - i];	// sin (i*PI/nbr_coef);
+			}
+			else
+			{
+				osc.step ();
+				c = osc.get_cos ();
+				s = osc.get_sin ();
+			}
+			LaneVector		v;
+
+			v = sf2r [i] * c - sf2i [i] * s;
+			dfr [i] = sf1r [i] + v;
+			dfi [-i] = sf1r [i] - v;	// dfr [nbr_coef - i] =
+
+			v = sf2r [i] * s + sf2i [i] * c;
+			dfi [i] = v + sf1i [i];
+			dfi [nbr_coef - i] = v - sf1i [i];
+		}
+
+		coef_index += d_nbr_coef;
+	}
+	while (coef_index < pos + len);
+}
+
+
+
+template <class DT>
+void	FFTReal <DT>::compute_ifft_lanes (const DataType f [], DataType x [], DataType ws []) const
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (x != f);
+	assert (_nbr_bits > 2);
+
+	LaneVector *	sf = reinterpret_cast <LaneVector *> (ws);
+	LaneVector *	df = sf + _length;
+
+	Lanes::interleave (sf, f, _length, 0);
+
+	// Same blocking as compute_fft_lanes(), in reverse order
+	const int		block_bits =
+		(_nbr_bits < LANES_BLOCK_BD) ? _nbr_bits : LANES_BLOCK_BD;
+	const long		block_len = 1L << block_bits;
+	for (int pass = _nbr_bits - 1; pass >= block_bits; -- pass)
+	{
+		compute_inverse_lanes_n (df, sf, pass, 0, _length);
+
+		LaneVector * const	temp_ptr = df;
+		df = sf;
+		sf = temp_ptr;
+	}
+
+	for (long pos = 0; pos < _length; pos += block_len)
+	{
+		LaneVector *	sf_blk = sf;
+		LaneVector *	df_blk = df;
+		for (int pass = block_bits - 1; pass >= 3; -- pass)
+		{
+			compute_inverse_lanes_n (df_blk, sf_blk, pass, pos, block_len);
+
+			LaneVector * const	temp_ptr = df_blk;
+			df_blk = sf_blk;
+			sf_blk = temp_ptr;
+		}
+
+		compute_inverse_lanes_3 (df_blk, sf_blk, pos, block_len);
+		compute_inverse_lanes_1_2 (sf_blk, df_blk, pos, block_len);
+	}
+	if (((block_bits - 3) & 1) != 0)
+	{
+		sf = df;
+	}
+
+	Lanes::deinterleave (x, sf, _length, get_br_ptr ());
+}
+
+
+
+template <class DT>
+void	FFTReal <DT>::compute_inverse_lanes_n (LaneVector df [], const LaneVector sf [], int pass, long pos, long len) const
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (pass >= 3);
+	assert (pass < _nbr_bits);
+	assert (pos >= 0);
+	assert (len > 0);
+	assert (pos + len <= _length);
+
+	const long		nbr_coef = 1 << pass;
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	const bool		lut_flag = (pass <= TRIGO_BD_LIMIT);
+	const DataType	* const	cos_ptr = lut_flag ? get_trigo_ptr (pass) : 0;
+	OscType			osc;
+	if (! lut_flag)
+	{
+		osc = _trigo_osc [pass - (TRIGO_BD_LIMIT + 1)];
+	}
+	long				coef_index = pos;
+	do
+	{
+		const LaneVector	* const	sfr = sf + coef_index;
+		const LaneVector	* const	sfi = sfr + nbr_coef;
+		LaneVector			* const	df1r = df + coef_index;
+		LaneVector			* const	df2r = df1r + nbr_coef;
+
+		if (! lut_flag)
+		{
+			osc.clear_buffers ();
+		}
+
+		// Extreme coefficients are always real
+		df1r [0] = sfr [0] + sfi [0];		// + sfr [nbr_coef]
+		df2r [0] = sfr [0] - sfi [0];		// - sfr [nbr_coef]
+		df1r [h_nbr_coef] = sfr [h_nbr_coef] * 2;
+		df2r [h_nbr_coef] = sfi [h_nbr_coef] * 2;
+
+		// Others are conjugate complex numbers
+		LaneVector * const	df1i = df1r + h_nbr_coef;
+		LaneVector * const	df2i = df1i + nbr_coef;
+		for (long i = 1; i < h_nbr_coef; ++ i)
+		{
+			df1r [i] = sfr [i] + sfi [-i];		// + sfr [nbr_coef - i]
+			df1i [i] = sfi [i] - sfi [nbr_coef - i];
+
+			DataType			c;
+			DataType			s;
+			if (lut_flag)
+			{
+				c = cos_ptr [i];					// cos (i*PI/nbr_coef);
+				s = cos_ptr [h_nbr_coef - i];	// sin (i*PI/nbr_coef);
+			}
+			else
+			{
+				osc.step ();
+				c = osc.get_cos ();
+				s = osc.get_sin ();
+			}
+			const LaneVector	vr = sfr [i] - sfi [-i];		// - sfr [nbr_coef - i]
+			const LaneVector	vi = sfi [i] + sfi [nbr_coef - i];
+
+			df2r [i] = vr * c + vi * s;
+			df2i [i] = vi * c - vr * s;
+		}
+
+		coef_index += d_nbr_coef;
+	}
+	while (coef_index < pos + len);
+}
+
+
+
+template <class DT>
+void	FFTReal <DT>::compute_inverse_lanes_3 (LaneVector df [], const LaneVector sf [], long pos, long len) const
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (pos >= 0);
+	assert (len > 0);
+	assert (pos + len <= _length);
+
+	const DataType	sqrt2_2 = DataType (SQRT2 * 0.5);
+	long				coef_index = pos;
+	do
+	{
+		df [coef_index] = sf [coef_index] + sf [coef_index + 4];
+		df [coef_index + 4] = sf [coef_index] - sf [coef_index + 4];
+		df [coef_index + 2] = sf [coef_index + 2] * 2;
+		df [coef_index + 6] = sf [coef_index + 6] * 2;
+
+		df [coef_index + 1] = sf [coef_index + 1] + sf [coef_index + 3];
+		df [coef_index + 3] = sf [coef_index + 5] - sf [coef_index + 7];
+
+		const LaneVector	vr = sf [coef_index + 1] - sf [coef_index + 3];
+		const LaneVector	vi = sf [coef_index + 5] + sf [coef_index + 7];
+
+		df [coef_index + 5] = (vr + vi) * sqrt2_2;
+		df [coef_index + 7] = (vi - vr) * sqrt2_2;
+
+		coef_index += 8;
+	}
+	while (coef_index < pos + len);
+}
+
+
+
+template <class DT>
+void	FFTReal <DT>::compute_inverse_lanes_1_2 (LaneVector x [], const LaneVector sf [], long pos, long len) const
+{
+	assert (x != 0);
+	assert (sf != 0);
+	assert (x != sf);
+	assert (pos >= 0);
+	assert (len > 0);
+	assert (pos + len <= _length);
+
+	// x is left in bit-reversed order, see compute_ifft_lanes()
+	long				coef_index = pos;
+	do
+	{
+		const LaneVector * const	sf2 = sf + coef_index;
+		LaneVector * const	x2 = x + coef_index;
+
+		const LaneVector	b_0 = sf2 [0] + sf2 [2];
+		const LaneVector	b_2 = sf2 [0] - sf2 [2];
+		const LaneVector	b_1 = sf2 [1] * 2;
+		const LaneVector	b_3 = sf2 [3] * 2;
+
+		x2 [0] = b_0 + b_1;
+		x2 [1] = b_0 - b_1;
+		x2 [2] = b_2 + b_3;
+		x2 [3] = b_2 - b_3;
+
+		coef_index += 4;
+	}
+	while (coef_index < pos + len);
+}
+
+
 }	// namespace ffft
 
 
@@ -0,0 +1,122 @@
+/*****************************************************************************
+
+        FFTRealAnyLen.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_FFTRealAnyLen_HEADER_INCLUDED)
+#define	ffft_FFTRealAnyLen_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/AllocatorHeap.h"
+#include	"ffft/DynArray.h"
+#include	"ffft/FFTAnyLen.h"
+
+
+
+namespace ffft
+{
+
+
+
+// Real FFT of any length, with the output format of FFTReal:
+// f [0...length(x)/2] = real values,
+// f [length(x)/2+1...length(x)-1] = negative imaginary values of coefficients
+// 1...length(x)/2-1 (odd lengths: 1...(length(x)-1)/2).
+// Even lengths run on a complex FFTAnyLen of half the length, the even and
+// odd samples packed as the real and imaginary parts. Odd lengths use a
+// complex FFT of the full length with null imaginary parts.
+template <class DT>
+class FFTRealAnyLen
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	DT	DataType;
+
+	explicit			FFTRealAnyLen (long length, Allocator &allocator = AllocatorHeap::use_instance ());
+	virtual			~FFTRealAnyLen () {}
+
+	long				get_length () const;
+	bool				is_mixed_radix () const;
+	long				get_workspace_len () const;
+	void				do_fft (DataType f [], const DataType x []) const;
+	void				do_fft (DataType f [], const DataType x [], DataType ws []) const;
+	void				do_ifft (const DataType f [], DataType x []) const;
+	void				do_ifft (const DataType f [], DataType x [], DataType ws []) const;
+	void				rescale (DataType x []) const;
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	static long	compute_fft_len (long length);
+	void				init_twiddles ();
+	DataType *		use_buffer () const;
+
+	const long		_length;
+	const bool		_even_flag;
+	FFTAnyLen <DataType>
+							_fft;			// Length / 2 for even lengths, length otherwise
+	DynArray <DataType>
+							_twiddle_lut;	// Even lengths: exp (-2*PI*i*k/length), cos then sin, k in [0 ; length/2]
+	mutable DynArray <DataType>
+							_buffer;			// Workspace for the functions called without one
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+							FFTRealAnyLen ();
+							FFTRealAnyLen (const FFTRealAnyLen &other);
+	FFTRealAnyLen &	operator = (const FFTRealAnyLen &other);
+	bool				operator == (const FFTRealAnyLen &other);
+	bool				operator != (const FFTRealAnyLen &other);
+
+};	// class FFTRealAnyLen
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/FFTRealAnyLen.hpp"
+
+
+
+#endif	// ffft_FFTRealAnyLen_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
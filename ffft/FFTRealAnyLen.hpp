@@ -0,0 +1,363 @@
+/*****************************************************************************
+
+        FFTRealAnyLen.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_FFTRealAnyLen_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealAnyLen code header.
+#endif
+#define	ffft_FFTRealAnyLen_CURRENT_CODEHEADER
+
+#if ! defined (ffft_FFTRealAnyLen_CODEHEADER_INCLUDED)
+#define	ffft_FFTRealAnyLen_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/def.h"
+
+#include	<cassert>
+#include	<cmath>
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: ctor
+Input parameters:
+	- length: length of the FFT, 1 or more.
+	- allocator: provides the tables, the buffer and the complex FFT.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <class DT>
+FFTRealAnyLen <DT>::FFTRealAnyLen (long length, Allocator &allocator)
+:	_length (length)
+,	_even_flag ((length & 1) == 0)
+,	_fft (compute_fft_len (length), allocator)
+,	_twiddle_lut (allocator)
+,	_buffer (allocator)
+{
+	assert (length >= 1);
+
+	if (_even_flag)
+	{
+		init_twiddles ();
+	}
+}
+
+
+
+template <class DT>
+long	FFTRealAnyLen <DT>::get_length () const
+{
+	return (_length);
+}
+
+
+
+template <class DT>
+bool	FFTRealAnyLen <DT>::is_mixed_radix () const
+{
+	return (_fft.is_mixed_radix ());
+}
+
+
+
+// Two complex arrays of the complex FFT length for its input and output,
+// then its own workspace
+template <class DT>
+long	FFTRealAnyLen <DT>::get_workspace_len () const
+{
+	return (_fft.get_length () * 4 + _fft.get_workspace_len ());
+}
+
+
+
+template <class DT>
+void	FFTRealAnyLen <DT>::do_fft (DataType f [], const DataType x []) const
+{
+	do_fft (f, x, use_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_fft
+Description:
+	Compute the FFT of the real array, same output format as
+	FFTReal::do_fft().
+Input parameters:
+	- x: pointer on the source array (time).
+Output parameters:
+	- f: pointer on the destination array (frequencies), distinct from x.
+Input/output parameters:
+	- ws: workspace, get_workspace_len() values at least.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealAnyLen <DT>::do_fft (DataType f [], const DataType x [], DataType ws []) const
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (ws != 0);
+	assert (f != x);
+
+	const long		fft_len = _fft.get_length ();
+	DataType * const	zr_ptr = ws;
+	DataType * const	zi_ptr = ws + fft_len;
+	DataType * const	yr_ptr = ws + fft_len * 2;
+	DataType * const	yi_ptr = ws + fft_len * 3;
+	DataType * const	fft_ws_ptr = ws + fft_len * 4;
+
+	if (! _even_flag)
+	{
+		for (long pos = 0; pos < _length; ++pos)
+		{
+			zr_ptr [pos] = x [pos];
+			zi_ptr [pos] = 0;
+		}
+		_fft.do_fft (yr_ptr, yi_ptr, zr_ptr, zi_ptr, fft_ws_ptr);
+
+		const long		half = _length >> 1;
+		f [0] = yr_ptr [0];
+		for (long k = 1; k <= half; ++k)
+		{
+			f [k       ] =   yr_ptr [k];
+			f [half + k] = - yi_ptr [k];
+		}
+
+		return;
+	}
+
+	// Even samples in the real part, odd samples in the imaginary part
+	for (long pos = 0; pos < fft_len; ++pos)
+	{
+		zr_ptr [pos] = x [pos * 2    ];
+		zi_ptr [pos] = x [pos * 2 + 1];
+	}
+	_fft.do_fft (yr_ptr, yi_ptr, zr_ptr, zi_ptr, fft_ws_ptr);
+
+	// Splits the spectrum into the even and odd sample spectra, then
+	// combines them with the twiddle factors:
+	// X [k] = E [k] + exp (-2*PI*i*k/length) * O [k]
+	const DataType	h = DataType (0.5);
+	const DataType * const	tw_ptr = &_twiddle_lut [0];
+	for (long k = 0; k <= fft_len; ++k)
+	{
+		const long		k0 = (k == fft_len) ? 0 : k;
+		const long		j0 = (k == 0) ? 0 : fft_len - k;
+		const DataType	evn_r = (yr_ptr [k0] + yr_ptr [j0]) * h;
+		const DataType	evn_i = (yi_ptr [k0] - yi_ptr [j0]) * h;
+		const DataType	odd_r = (yi_ptr [k0] + yi_ptr [j0]) * h;
+		const DataType	odd_i = (yr_ptr [j0] - yr_ptr [k0]) * h;
+		const DataType	c = tw_ptr [k * 2    ];
+		const DataType	s = tw_ptr [k * 2 + 1];
+
+		f [k] = evn_r + c * odd_r + s * odd_i;
+		if (k > 0 && k < fft_len)
+		{
+			f [fft_len + k] = - (evn_i + c * odd_i - s * odd_r);
+		}
+	}
+}
+
+
+
+template <class DT>
+void	FFTRealAnyLen <DT>::do_ifft (const DataType f [], DataType x []) const
+{
+	do_ifft (f, x, use_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_ifft
+Description:
+	Compute the inverse FFT of the spectrum in the FFTReal format, without
+	scaling. Call rescale() to get back the original signal.
+Input parameters:
+	- f: pointer on the source array (frequencies).
+Output parameters:
+	- x: pointer on the destination array (time), distinct from f.
+Input/output parameters:
+	- ws: workspace, get_workspace_len() values at least.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealAnyLen <DT>::do_ifft (const DataType f [], DataType x [], DataType ws []) const
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (ws != 0);
+	assert (f != x);
+
+	const long		fft_len = _fft.get_length ();
+	DataType * const	zr_ptr = ws;
+	DataType * const	zi_ptr = ws + fft_len;
+	DataType * const	yr_ptr = ws + fft_len * 2;
+	DataType * const	yi_ptr = ws + fft_len * 3;
+	DataType * const	fft_ws_ptr = ws + fft_len * 4;
+
+	if (! _even_flag)
+	{
+		// Full Hermitian spectrum
+		const long		half = _length >> 1;
+		yr_ptr [0] = f [0];
+		yi_ptr [0] = 0;
+		for (long k = 1; k <= half; ++k)
+		{
+			yr_ptr [k          ] =   f [k];
+			yi_ptr [k          ] = - f [half + k];
+			yr_ptr [_length - k] =   f [k];
+			yi_ptr [_length - k] =   f [half + k];
+		}
+		_fft.do_ifft (yr_ptr, yi_ptr, zr_ptr, zi_ptr, fft_ws_ptr);
+
+		for (long pos = 0; pos < _length; ++pos)
+		{
+			x [pos] = zr_ptr [pos];
+		}
+
+		return;
+	}
+
+	// Rebuilds the spectrum of the packed samples, twice as large as the
+	// direct transform, so the half-length inverse gives the scale of the
+	// full-length one:
+	// Z [k] = E [k] + i * O [k]
+	// E [k] = X [k] + conj (X [m-k])
+	// O [k] = (X [k] - conj (X [m-k])) * exp (2*PI*i*k/length)
+	const DataType * const	tw_ptr = &_twiddle_lut [0];
+	for (long k = 0; k < fft_len; ++k)
+	{
+		const long		j = fft_len - k;
+		const DataType	xr = f [k];
+		const DataType	xi = (k == 0) ? DataType (0) : -f [fft_len + k];
+		const DataType	jr = f [j];
+		const DataType	ji = (j == fft_len) ? DataType (0) : -f [fft_len + j];
+		const DataType	c = tw_ptr [k * 2    ];
+		const DataType	s = tw_ptr [k * 2 + 1];
+
+		const DataType	evn_r = xr + jr;
+		const DataType	evn_i = xi - ji;
+		const DataType	dr = xr - jr;
+		const DataType	di = xi + ji;
+		const DataType	odd_r = dr * c - di * s;
+		const DataType	odd_i = dr * s + di * c;
+
+		yr_ptr [k] = evn_r - odd_i;
+		yi_ptr [k] = evn_i + odd_r;
+	}
+	_fft.do_ifft (yr_ptr, yi_ptr, zr_ptr, zi_ptr, fft_ws_ptr);
+
+	for (long pos = 0; pos < fft_len; ++pos)
+	{
+		x [pos * 2    ] = zr_ptr [pos];
+		x [pos * 2 + 1] = zi_ptr [pos];
+	}
+}
+
+
+
+template <class DT>
+void	FFTRealAnyLen <DT>::rescale (DataType x []) const
+{
+	assert (x != 0);
+
+	const DataType	mul = DataType (1.0 / _length);
+	for (long pos = 0; pos < _length; ++pos)
+	{
+		x [pos] *= mul;
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <class DT>
+long	FFTRealAnyLen <DT>::compute_fft_len (long length)
+{
+	assert (length >= 1);
+
+	return (((length & 1) == 0) ? length >> 1 : length);
+}
+
+
+
+template <class DT>
+void	FFTRealAnyLen <DT>::init_twiddles ()
+{
+	const long		half = _length >> 1;
+	_twiddle_lut.resize ((half + 1) * 2);
+
+	const double	mul = 2 * PI / _length;
+	for (long k = 0; k <= half; ++k)
+	{
+		_twiddle_lut [k * 2    ] = DataType (cos (k * mul));
+		_twiddle_lut [k * 2 + 1] = DataType (sin (k * mul));
+	}
+}
+
+
+
+template <class DT>
+typename FFTRealAnyLen <DT>::DataType *	FFTRealAnyLen <DT>::use_buffer () const
+{
+	if (_buffer.size () == 0)
+	{
+		_buffer.resize (get_workspace_len ());
+	}
+
+	return (&_buffer [0]);
+}
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_FFTRealAnyLen_CODEHEADER_INCLUDED
+
+#undef ffft_FFTRealAnyLen_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,131 @@
+/*****************************************************************************
+
+        FFTRealDct.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_FFTRealDct_HEADER_INCLUDED)
+#define	ffft_FFTRealDct_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/AllocatorHeap.h"
+#include	"ffft/DynArray.h"
+
+
+
+namespace ffft
+{
+
+
+
+// Type-II and type-III DCT and DST, unnormalized:
+// DCT-II:  f [k] = sum (x [n] * cos (PI*(2n+1)*k / (2*length)))
+// DCT-III: x [n] = f [0] / 2 + sum (f [k] * cos (PI*(2n+1)*k / (2*length))), k >= 1
+// DST-II:  f [k] = sum (x [n] * sin (PI*(2n+1)*(k+1) / (2*length)))
+// DST-III: x [n] = (-1)^n * f [length-1] / 2
+//                  + sum (f [k] * sin (PI*(2n+1)*(k+1) / (2*length))), k < length-1
+// Type III is the inverse of type II, scaled by length/2.
+// Each one is a real FFT of the same length, with O(length) reordering and
+// twiddling around it (Makhoul). The DST is the DCT of the sequence with
+// the odd samples negated, in reverse order.
+// FO is the FFT: FFTReal <DT>, FFTRealFixLen <LL2, DT> or
+// FFTRealFixLenIface. It is not owned and can be shared, only its const
+// functions are called.
+template <class FO>
+class FFTRealDct
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	FO	FftType;
+	typedef	typename FftType::DataType	DataType;
+
+	explicit			FFTRealDct (const FftType &fft, Allocator &allocator = AllocatorHeap::use_instance ());
+	virtual			~FFTRealDct () {}
+
+	long				get_length () const;
+	long				get_workspace_len () const;
+	void				do_dct2 (DataType f [], const DataType x []) const;
+	void				do_dct2 (DataType f [], const DataType x [], DataType ws []) const;
+	void				do_dct3 (const DataType f [], DataType x []) const;
+	void				do_dct3 (const DataType f [], DataType x [], DataType ws []) const;
+	void				do_dst2 (DataType f [], const DataType x []) const;
+	void				do_dst2 (DataType f [], const DataType x [], DataType ws []) const;
+	void				do_dst3 (const DataType f [], DataType x []) const;
+	void				do_dst3 (const DataType f [], DataType x [], DataType ws []) const;
+	void				rescale (DataType x []) const;
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	void				compute_type_2 (DataType f [], const DataType x [], DataType ws [], DataType odd_sign) const;
+	void				compute_type_3 (const DataType f [], DataType x [], DataType ws [], DataType odd_sign) const;
+	DataType *		use_buffer () const;
+
+	const FftType &	_fft;
+	const long		_length;
+	DynArray <DataType>
+							_cos_lut;		// cos (PI * k / (2 * length)), k in [0 ; length/2]
+	DynArray <DataType>
+							_sin_lut;		// sin (PI * k / (2 * length)), k in [0 ; length/2]
+	mutable DynArray <DataType>
+							_buffer;			// Workspace for the functions called without one
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+							FFTRealDct ();
+							FFTRealDct (const FFTRealDct &other);
+	FFTRealDct &	operator = (const FFTRealDct &other);
+	bool				operator == (const FFTRealDct &other);
+	bool				operator != (const FFTRealDct &other);
+
+};	// class FFTRealDct
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/FFTRealDct.hpp"
+
+
+
+#endif	// ffft_FFTRealDct_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,392 @@
+/*****************************************************************************
+
+        FFTRealDct.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_FFTRealDct_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealDct code header.
+#endif
+#define	ffft_FFTRealDct_CURRENT_CODEHEADER
+
+#if ! defined (ffft_FFTRealDct_CODEHEADER_INCLUDED)
+#define	ffft_FFTRealDct_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/def.h"
+#include	"ffft/FFTRealSimd.h"
+#include	"ffft/FFTRealSplit.h"
+
+#include	<algorithm>
+
+#include	<cassert>
+#include	<cmath>
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: ctor
+Input parameters:
+	- fft: transform of the length of the DCT, power of 2, 2 or more. It
+		must outlive this object.
+	- allocator: provides the tables and the buffer.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <class FO>
+FFTRealDct <FO>::FFTRealDct (const FftType &fft, Allocator &allocator)
+:	_fft (fft)
+,	_length (fft.get_length ())
+,	_cos_lut ((_length >> 1) + 1, allocator)
+,	_sin_lut ((_length >> 1) + 1, allocator)
+,	_buffer (allocator)
+{
+	assert (_length >= 2);
+	assert ((_length & (_length - 1)) == 0);
+
+	const long		half = _length >> 1;
+	const double	mul = PI / (2 * _length);
+	for (long k = 0; k <= half; ++k)
+	{
+		_cos_lut [k] = DataType (cos (k * mul));
+		_sin_lut [k] = DataType (sin (k * mul));
+	}
+}
+
+
+
+template <class FO>
+long	FFTRealDct <FO>::get_length () const
+{
+	return (_length);
+}
+
+
+
+// Two buffers of the length, plus the workspace of the FFT
+template <class FO>
+long	FFTRealDct <FO>::get_workspace_len () const
+{
+	return (_length * 2 + _fft.get_workspace_len ());
+}
+
+
+
+template <class FO>
+void	FFTRealDct <FO>::do_dct2 (DataType f [], const DataType x []) const
+{
+	do_dct2 (f, x, use_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_dct2
+Description:
+	Compute the type-II DCT of x.
+	f may be x: the input is reordered before anything is written.
+Input parameters:
+	- x: source array, length values.
+Output parameters:
+	- f: coefficients, length values.
+Input/output parameters:
+	- ws: workspace, get_workspace_len() values at least.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class FO>
+void	FFTRealDct <FO>::do_dct2 (DataType f [], const DataType x [], DataType ws []) const
+{
+	compute_type_2 (f, x, ws, DataType (1));
+}
+
+
+
+template <class FO>
+void	FFTRealDct <FO>::do_dct3 (const DataType f [], DataType x []) const
+{
+	do_dct3 (f, x, use_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_dct3
+Description:
+	Compute the type-III DCT of f, which is the inverse of do_dct2() scaled
+	by length/2. Call rescale() to get back the original signal.
+	x may be f.
+Input parameters:
+	- f: coefficients, length values.
+Output parameters:
+	- x: destination array, length values.
+Input/output parameters:
+	- ws: workspace, get_workspace_len() values at least.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class FO>
+void	FFTRealDct <FO>::do_dct3 (const DataType f [], DataType x [], DataType ws []) const
+{
+	compute_type_3 (f, x, ws, DataType (1));
+}
+
+
+
+template <class FO>
+void	FFTRealDct <FO>::do_dst2 (DataType f [], const DataType x []) const
+{
+	do_dst2 (f, x, use_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_dst2
+Description:
+	Compute the type-II DST of x. Same as do_dct2() with the odd samples of
+	x negated, and the coefficients in reverse order.
+	f may be x.
+Input parameters:
+	- x: source array, length values.
+Output parameters:
+	- f: coefficients, length values.
+Input/output parameters:
+	- ws: workspace, get_workspace_len() values at least.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class FO>
+void	FFTRealDct <FO>::do_dst2 (DataType f [], const DataType x [], DataType ws []) const
+{
+	compute_type_2 (f, x, ws, DataType (-1));
+	std::reverse (f, f + _length);
+}
+
+
+
+template <class FO>
+void	FFTRealDct <FO>::do_dst3 (const DataType f [], DataType x []) const
+{
+	do_dst3 (f, x, use_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_dst3
+Description:
+	Compute the type-III DST of f, which is the inverse of do_dst2() scaled
+	by length/2. Call rescale() to get back the original signal.
+	x may be f.
+Input parameters:
+	- f: coefficients, length values.
+Output parameters:
+	- x: destination array, length values.
+Input/output parameters:
+	- ws: workspace, get_workspace_len() values at least.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class FO>
+void	FFTRealDct <FO>::do_dst3 (const DataType f [], DataType x [], DataType ws []) const
+{
+	// The reversed coefficients go to the second buffer, compute_type_3()
+	// reads them before using it.
+	DataType * const	rev_ptr = ws + _length;
+	for (long k = 0; k < _length; ++k)
+	{
+		rev_ptr [k] = f [_length - 1 - k];
+	}
+
+	compute_type_3 (rev_ptr, x, ws, DataType (-1));
+}
+
+
+
+// Multiplies by 2/length, after a type II and a type III transform
+template <class FO>
+void	FFTRealDct <FO>::rescale (DataType x []) const
+{
+	assert (x != 0);
+
+	const DataType	mul = DataType (2.0 / _length);
+	for (long pos = 0; pos < _length; ++pos)
+	{
+		x [pos] *= mul;
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// The even samples in order, then the odd samples in reverse order. The
+// FFT V of this sequence gives the DCT as:
+// f [k] = Re (exp (-i*PI*k / (2*length)) * V [k])
+// Bins k and length-k share V [k], which is conjugate for length-k.
+// odd_sign is -1 to negate the odd samples (DST).
+template <class FO>
+void	FFTRealDct <FO>::compute_type_2 (DataType f [], const DataType x [], DataType ws [], DataType odd_sign) const
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (ws != 0);
+
+	const long		half = _length >> 1;
+	DataType * const	v_ptr = ws;
+	DataType * const	vf_ptr = ws + _length;
+	const DataType * const	cos_ptr = &_cos_lut [0];
+	const DataType * const	sin_ptr = &_sin_lut [0];
+
+	for (long n = 0; n < half; ++n)
+	{
+		v_ptr [n               ] = x [n * 2];
+		v_ptr [_length - 1 - n] = x [n * 2 + 1] * odd_sign;
+	}
+
+	_fft.do_fft (vf_ptr, v_ptr, ws + _length * 2);
+
+	const FFTRealSplit <const DataType>	split (vf_ptr, _length);
+	const DataType * const	re_ptr = split.get_re_ptr ();
+	const DataType * const	im_ptr = split.get_neg_im_ptr ();
+
+	if (! FFTRealSimd <DataType>::dct_post (
+		FFTRealSimd <DataType>::get_level (),
+		f,
+		vf_ptr,
+		cos_ptr,
+		sin_ptr,
+		_length
+	))
+	{
+		for (long k = 1; k < half; ++k)
+		{
+			const DataType	c = cos_ptr [k];
+			const DataType	s = sin_ptr [k];
+			f [k          ] = c * re_ptr [k] - s * im_ptr [k];
+			f [_length - k] = s * re_ptr [k] + c * im_ptr [k];
+		}
+	}
+
+	f [0] = re_ptr [0];
+	f [half] = re_ptr [half] * cos_ptr [half];
+}
+
+
+
+// Builds V back from the coefficients, then goes through the inverse FFT:
+// V [k] = exp (i*PI*k / (2*length)) * (f [k] - i * f [length-k]) / 2
+// odd_sign is -1 to negate the odd samples of the result (DST).
+template <class FO>
+void	FFTRealDct <FO>::compute_type_3 (const DataType f [], DataType x [], DataType ws [], DataType odd_sign) const
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (ws != 0);
+
+	const long		half = _length >> 1;
+	DataType * const	vf_ptr = ws;
+	DataType * const	v_ptr = ws + _length;
+	const DataType * const	cos_ptr = &_cos_lut [0];
+	const DataType * const	sin_ptr = &_sin_lut [0];
+
+	if (! FFTRealSimd <DataType>::dct_pre (
+		FFTRealSimd <DataType>::get_level (),
+		vf_ptr,
+		f,
+		cos_ptr,
+		sin_ptr,
+		_length
+	))
+	{
+		const DataType	h = DataType (0.5);
+		for (long k = 1; k < half; ++k)
+		{
+			const DataType	c = cos_ptr [k] * h;
+			const DataType	s = sin_ptr [k] * h;
+			const DataType	a = f [k];
+			const DataType	b = f [_length - k];
+			vf_ptr [k       ] = c * a + s * b;
+			vf_ptr [half + k] = c * b - s * a;
+		}
+	}
+
+	// f is read completely before v_ptr gets written: f may be the second
+	// buffer (do_dst3).
+	vf_ptr [0] = f [0] * DataType (0.5);
+	vf_ptr [half] = f [half] * cos_ptr [half];
+
+	_fft.do_ifft (vf_ptr, v_ptr, ws + _length * 2);
+
+	for (long n = 0; n < half; ++n)
+	{
+		x [n * 2    ] = v_ptr [n];
+		x [n * 2 + 1] = v_ptr [_length - 1 - n] * odd_sign;
+	}
+}
+
+
+
+template <class FO>
+typename FFTRealDct <FO>::DataType *	FFTRealDct <FO>::use_buffer () const
+{
+	if (_buffer.size () == 0)
+	{
+		_buffer.resize (get_workspace_len ());
+	}
+
+	return (&_buffer [0]);
+}
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_FFTRealDct_CODEHEADER_INCLUDED
+
+#undef ffft_FFTRealDct_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
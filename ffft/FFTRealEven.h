@@ -0,0 +1,113 @@
+/*****************************************************************************
+
+        FFTRealEven.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_FFTRealEven_HEADER_INCLUDED)
+#define	ffft_FFTRealEven_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/AllocatorHeap.h"
+#include	"ffft/DynArray.h"
+#include	"ffft/FFTReal.h"
+
+
+
+namespace ffft
+{
+
+
+
+// FFT of an even real sequence, x [k] = x [length - k], given by its first
+// half. The spectrum is real and even too, so only its first bins are
+// computed, and only their real parts (the imaginary parts are 0).
+// This is a type-I DCT of the length/2 + 1 input values. It runs on a real
+// FFT of half the length, plus a pre- and a post-processing loop.
+template <class DT>
+class FFTRealEven
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	DT	DataType;
+
+	explicit			FFTRealEven (long length, Allocator &allocator = AllocatorHeap::use_instance ());
+	virtual			~FFTRealEven () {}
+
+	long				get_length () const;
+	long				get_workspace_len () const;
+	void				do_fft (DataType f [], const DataType x [], long nbr_bins) const;
+	void				do_fft (DataType f [], const DataType x [], long nbr_bins, DataType ws []) const;
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	DataType *		use_buffer () const;
+
+	const long		_length;
+	FFTReal <DataType>
+							_fft;				// Half the length
+	DynArray <DataType>
+							_sin_lut;		// sin (PI * j / (length / 2)), j in [0 ; length / 4]
+	mutable DynArray <DataType>
+							_buffer;			// Workspace for the function called without one
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+							FFTRealEven ();
+							FFTRealEven (const FFTRealEven &other);
+	FFTRealEven &	operator = (const FFTRealEven &other);
+	bool				operator == (const FFTRealEven &other);
+	bool				operator != (const FFTRealEven &other);
+
+};	// class FFTRealEven
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/FFTRealEven.hpp"
+
+
+
+#endif	// ffft_FFTRealEven_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
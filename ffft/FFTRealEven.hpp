@@ -0,0 +1,214 @@
+/*****************************************************************************
+
+        FFTRealEven.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_FFTRealEven_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealEven code header.
+#endif
+#define	ffft_FFTRealEven_CURRENT_CODEHEADER
+
+#if ! defined (ffft_FFTRealEven_CODEHEADER_INCLUDED)
+#define	ffft_FFTRealEven_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/def.h"
+#include	"ffft/FFTRealSplit.h"
+
+#include	<cassert>
+#include	<cmath>
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: ctor
+Input parameters:
+	- length: length of the whole even sequence, power of 2, 4 or more.
+	- allocator: provides the tables and the FFT of half the length.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <class DT>
+FFTRealEven <DT>::FFTRealEven (long length, Allocator &allocator)
+:	_length (length)
+,	_fft (length >> 1, allocator)
+,	_sin_lut ((length >> 2) + 1, allocator)
+,	_buffer (allocator)
+{
+	assert (length >= 4);
+	assert ((length & (length - 1)) == 0);
+
+	const long		half = length >> 1;
+	const long		quarter = half >> 1;
+	for (long j = 0; j <= quarter; ++j)
+	{
+		_sin_lut [j] = DataType (sin (j * PI / half));
+	}
+}
+
+
+
+template <class DT>
+long	FFTRealEven <DT>::get_length () const
+{
+	return (_length);
+}
+
+
+
+// Two buffers of half the length, plus the workspace of the half FFT
+template <class DT>
+long	FFTRealEven <DT>::get_workspace_len () const
+{
+	return (_length + _fft.get_workspace_len ());
+}
+
+
+
+template <class DT>
+void	FFTRealEven <DT>::do_fft (DataType f [], const DataType x [], long nbr_bins) const
+{
+	do_fft (f, x, nbr_bins, use_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_fft
+Description:
+	Compute the first bins of the FFT of an even sequence:
+	f [n] = x [0] + (-1)^n * x [length/2]
+		+ 2 * sum (x [k] * cos (2*PI*k*n / length)), k in [1 ; length/2 - 1]
+	Even bins are the real parts of the half-length FFT of a folded
+	sequence. Odd bins are built from bin 1 upwards with its imaginary
+	parts, so asking fewer bins only shortens the last loop.
+	f may be x: the input is folded before anything is written.
+Input parameters:
+	- x: first half of the sequence, length/2 + 1 values.
+	- nbr_bins: number of bins to compute, in [1 ; length/2 + 1].
+Output parameters:
+	- f: bins 0 to nbr_bins - 1.
+Input/output parameters:
+	- ws: workspace, get_workspace_len() values at least.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealEven <DT>::do_fft (DataType f [], const DataType x [], long nbr_bins, DataType ws []) const
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (ws != 0);
+	assert (nbr_bins > 0);
+	assert (nbr_bins <= (_length >> 1) + 1);
+
+	const long		half = _length >> 1;
+	const long		quarter = half >> 1;
+	DataType * const	z_ptr = ws;
+	DataType * const	zf_ptr = ws + half;
+	const DataType * const	sin_ptr = &_sin_lut [0];
+
+	// Folds the sum on half the length: z [j] = s [j] - 2 * sin (PI*j/half)
+	// * d [j], with s and d the sum and the difference of x [j] and
+	// x [half - j]. The differences also give bin 1 directly.
+	z_ptr [0] = x [0] + x [half];
+	z_ptr [quarter] = x [quarter] * 2;
+	DataType			bin_1 = x [0] - x [half];
+	for (long j = 1; j < quarter; ++j)
+	{
+		const DataType	s = x [j] + x [half - j];
+		const DataType	d = x [j] - x [half - j];
+		const DataType	w = sin_ptr [j] * 2 * d;
+		z_ptr [j       ] = s - w;
+		z_ptr [half - j] = s + w;
+		bin_1 += sin_ptr [quarter - j] * 2 * d;   // cos (PI * j / half)
+	}
+
+	_fft.do_fft (zf_ptr, z_ptr, ws + _length);
+
+	// Bin 2k is the real part of bin k. Bin 2k+1 is bin 2k-1 minus the
+	// imaginary part of bin k.
+	const FFTRealSplit <const DataType>	split (zf_ptr, half);
+	const DataType * const	re_ptr = split.get_re_ptr ();
+	const DataType * const	im_ptr = split.get_neg_im_ptr ();
+	const long		nbr_pairs = nbr_bins >> 1;
+
+	DataType			odd = bin_1;
+	if (nbr_pairs > 0)
+	{
+		f [0] = re_ptr [0];
+		f [1] = odd;
+	}
+	for (long k = 1; k < nbr_pairs; ++k)
+	{
+		odd += im_ptr [k];
+		f [k * 2    ] = re_ptr [k];
+		f [k * 2 + 1] = odd;
+	}
+	if ((nbr_bins & 1) != 0)
+	{
+		f [nbr_bins - 1] = re_ptr [nbr_pairs];
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <class DT>
+typename FFTRealEven <DT>::DataType *	FFTRealEven <DT>::use_buffer () const
+{
+	if (_buffer.size () == 0)
+	{
+		_buffer.resize (get_workspace_len ());
+	}
+
+	return (&_buffer [0]);
+}
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_FFTRealEven_CODEHEADER_INCLUDED
+
+#undef ffft_FFTRealEven_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
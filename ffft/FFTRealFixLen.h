@@ -27,9 +27,10 @@ http://sam.zoy.org/wtfpl/COPYING for more details.
 
 /*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
-#include	"ffft/Array.h"
+#include	"ffft/AllocatorHeap.h"
 #include	"ffft/DynArray.h"
 #include	"ffft/FFTRealFixLenParam.h"
+#include	"ffft/FFTRealFixLenTables.h"
 #include	"ffft/OscSinCos.h"
 
 
@@ -39,7 +40,9 @@ namespace ffft
 
 
 
-template <int LL2>
+// DT is the data type, float or double. The passes are vectorized for float
+// only, double uses the scalar code.
+template <int LL2, class DT = FFTRealFixLenParam::DataType>
 class FFTRealFixLen
 {
 	typedef	int	CompileTimeCheck1 [(LL2 >=  0) ? 1 : -1];
@@ -49,17 +52,22 @@ class FFTRealFixLen
 
 public:
 
-   typedef	FFTRealFixLenParam::DataType   DataType;
+	typedef	DT	DataType;
 	typedef	OscSinCos <DataType>	OscType;
 
 	enum {			FFT_LEN_L2	= LL2	};
 	enum {			FFT_LEN		= 1 << FFT_LEN_L2	};
 
-						FFTRealFixLen ();
+	explicit			FFTRealFixLen (Allocator &allocator = AllocatorHeap::use_instance ());
 
 	inline long		get_length () const;
+	inline long		get_workspace_len () const;
 	void				do_fft (DataType f [], const DataType x []);
+	void				do_fft (DataType f [], const DataType x [], DataType ws []) const;
 	void				do_ifft (const DataType f [], DataType x []);
+	void				do_ifft (const DataType f [], DataType x [], DataType ws []) const;
+	void				do_power_spectrum (DataType out [], const DataType x [], DataType exponent);
+	void				do_power_spectrum (DataType out [], const DataType x [], DataType exponent, DataType ws []) const;
 	void				rescale (DataType x []) const;
 
 
@@ -74,32 +82,21 @@ protected:
 
 private:
 
-	enum {			TRIGO_BD_LIMIT	= FFTRealFixLenParam::TRIGO_BD_LIMIT	};
+	typedef	FFTRealFixLenTables <LL2, DT>	Tables;
 
-	enum {			BR_ARR_SIZE_L2	= ((FFT_LEN_L2 - 3) < 0) ? 0 : (FFT_LEN_L2 - 2)	};
-	enum {			BR_ARR_SIZE		= 1 << BR_ARR_SIZE_L2	};
+	// Pass where the recursion starts. The lengths below 8 do not use the
+	// passes, it is clipped so they still compile.
+	enum {			LAST_PASS				= (FFT_LEN_L2 >= 3) ? FFT_LEN_L2 - 1 : 2	};
 
-   enum {			TRIGO_BD			=   ((FFT_LEN_L2 - TRIGO_BD_LIMIT) < 0)
-											  ? (int)FFT_LEN_L2
-											  : (int)TRIGO_BD_LIMIT };
-	enum {			TRIGO_TABLE_ARR_SIZE_L2	= (LL2 < 4) ? 0 : (TRIGO_BD - 2)	};
-	enum {			TRIGO_TABLE_ARR_SIZE	= 1 << TRIGO_TABLE_ARR_SIZE_L2	};
+	// Sweeps over the data, see FFTRealPassDirect::process()
+	enum {			NBR_SWEEPS				= (FFT_LEN_L2 <= 3) ? 2 : 3 + (FFT_LEN_L2 - 3) / 2	};
 
-	enum {			NBR_TRIGO_OSC			= FFT_LEN_L2 - TRIGO_BD	};
-	enum {			TRIGO_OSC_ARR_SIZE	=	(NBR_TRIGO_OSC > 0) ? NBR_TRIGO_OSC : 1	};
+	inline DataType *
+						use_buffer ();
 
-	void				build_br_lut ();
-	void				build_trigo_lut ();
-	void				build_trigo_osc ();
-
-	DynArray <DataType>
-						_buffer;
-	DynArray <long>
-						_br_data;
 	DynArray <DataType>
-						_trigo_data;
-   Array <OscType, TRIGO_OSC_ARR_SIZE>
-						_trigo_osc;
+						_buffer;			// Allocated on first use
+	const Tables &	_tables;
 
 
 
@@ -30,12 +30,10 @@ http://sam.zoy.org/wtfpl/COPYING for more details.
 #include	"ffft/def.h"
 #include	"ffft/FFTRealPassDirect.h"
 #include	"ffft/FFTRealPassInverse.h"
+#include	"ffft/FFTRealPower.h"
 #include	"ffft/FFTRealSelect.h"
 
 #include	<cassert>
-#include	<cmath>
-
-namespace std { }
 
 
 
@@ -48,169 +46,236 @@ namespace ffft
 
 
 
-template <int LL2>
-FFTRealFixLen <LL2>::FFTRealFixLen ()
-:	_buffer (FFT_LEN)
-,	_br_data (BR_ARR_SIZE)
-,	_trigo_data (TRIGO_TABLE_ARR_SIZE)
-,	_trigo_osc ()
+// The tables are shared by all the objects of this length and data type, so
+// there is nothing to compute here. The allocator is only used by the
+// functions called without a workspace.
+template <int LL2, class DT>
+FFTRealFixLen <LL2, DT>::FFTRealFixLen (Allocator &allocator)
+:	_buffer (allocator)
+,	_tables (Tables::use_instance ())
 {
-	build_br_lut ();
-	build_trigo_lut ();
-	build_trigo_osc ();
+	// Nothing
 }
 
 
 
-template <int LL2>
-long	FFTRealFixLen <LL2>::get_length () const
+template <int LL2, class DT>
+long	FFTRealFixLen <LL2, DT>::get_length () const
 {
 	return (FFT_LEN);
 }
 
 
 
-// General case
-template <int LL2>
-void	FFTRealFixLen <LL2>::do_fft (DataType f [], const DataType x [])
+// Size of ws for the reentrant functions
+template <int LL2, class DT>
+long	FFTRealFixLen <LL2, DT>::get_workspace_len () const
 {
-	assert (f != 0);
-	assert (x != 0);
-	assert (x != f);
-	assert (FFT_LEN_L2 >= 3);
-
-	// Do the transform in several passes
-	const DataType	*	cos_ptr = &_trigo_data [0];
-	const long *	br_ptr = &_br_data [0];
-
-	FFTRealPassDirect <FFT_LEN_L2 - 1>::process (
-		FFT_LEN,
-		f,
-		&_buffer [0],
-		x,
-		cos_ptr,
-		TRIGO_TABLE_ARR_SIZE,
-		br_ptr,
-		&_trigo_osc [0]
-	);
+	return (FFT_LEN);
 }
 
-// 4-point FFT
-template <>
-inline void	FFTRealFixLen <2>::do_fft (DataType f [], const DataType x [])
-{
-	assert (f != 0);
-	assert (x != 0);
-	assert (x != f);
 
-	f [1] = x [0] - x [2];
-	f [3] = x [1] - x [3];
 
-	const DataType	b_0 = x [0] + x [2];
-	const DataType	b_2 = x [1] + x [3];
-	
-	f [0] = b_0 + b_2;
-	f [2] = b_0 - b_2;
+template <int LL2, class DT>
+void	FFTRealFixLen <LL2, DT>::do_fft (DataType f [], const DataType x [])
+{
+	do_fft (f, x, use_buffer ());
 }
 
-// 2-point FFT
-template <>
-inline void	FFTRealFixLen <1>::do_fft (DataType f [], const DataType x [])
+
+
+// Reentrant version: the temporary data goes to ws (FFT_LEN values) and the
+// oscillators are copied, so the object is only read. The lengths below 8
+// are computed directly and do not use ws.
+template <int LL2, class DT>
+void	FFTRealFixLen <LL2, DT>::do_fft (DataType f [], const DataType x [], DataType ws []) const
 {
 	assert (f != 0);
 	assert (x != 0);
 	assert (x != f);
 
-	f [0] = x [0] + x [1];
-	f [1] = x [0] - x [1];
-}
+	// General case
+	if (FFT_LEN_L2 >= 3)
+	{
+		assert (ws != 0);
+		assert (ws != f);
+		assert (ws != x);
+
+		// Do the transform in several passes
+		const DataType	*	cos_ptr = _tables.get_trigo_ptr ();
+		const long *	br_ptr = _tables.get_br_ptr ();
+		OscType			osc_arr [Tables::TRIGO_OSC_ARR_SIZE];
+		_tables.copy_trigo_osc (osc_arr);
+
+		FFTRealPassDirect <LAST_PASS, DT>::process (
+			FFT_LEN,
+			f,
+			ws,
+			x,
+			cos_ptr,
+			Tables::TRIGO_TABLE_ARR_SIZE,
+			br_ptr,
+			osc_arr
+		);
+	}
 
-// 1-point FFT
-template <>
-inline void	FFTRealFixLen <0>::do_fft (DataType f [], const DataType x [])
-{
-	assert (f != 0);
-	assert (x != 0);
+	// 4-point FFT
+	else if (FFT_LEN_L2 == 2)
+	{
+		f [1] = x [0] - x [2];
+		f [3] = x [1] - x [3];
+
+		const DataType	b_0 = x [0] + x [2];
+		const DataType	b_2 = x [1] + x [3];
+
+		f [0] = b_0 + b_2;
+		f [2] = b_0 - b_2;
+	}
+
+	// 2-point FFT
+	else if (FFT_LEN_L2 == 1)
+	{
+		f [0] = x [0] + x [1];
+		f [1] = x [0] - x [1];
+	}
 
-	f [0] = x [0];
+	// 1-point FFT
+	else
+	{
+		f [0] = x [0];
+	}
 }
 
 
 
-// General case
-template <int LL2>
-void	FFTRealFixLen <LL2>::do_ifft (const DataType f [], DataType x [])
+template <int LL2, class DT>
+void	FFTRealFixLen <LL2, DT>::do_ifft (const DataType f [], DataType x [])
 {
-	assert (f != 0);
-	assert (x != 0);
-	assert (x != f);
-	assert (FFT_LEN_L2 >= 3);
-
-	// Do the transform in several passes
-	DataType *		s_ptr =
-		FFTRealSelect <FFT_LEN_L2 & 1>::sel_bin (&_buffer [0], x);
-	DataType *		d_ptr =
-		FFTRealSelect <FFT_LEN_L2 & 1>::sel_bin (x, &_buffer [0]);
-	const DataType	*	cos_ptr = &_trigo_data [0];
-	const long *	br_ptr = &_br_data [0];
-
-	FFTRealPassInverse <FFT_LEN_L2 - 1>::process (
-		FFT_LEN,
-		d_ptr,
-		s_ptr,
-		f,
-		cos_ptr,
-		TRIGO_TABLE_ARR_SIZE,
-		br_ptr,
-		&_trigo_osc [0]
-	);
+	do_ifft (f, x, use_buffer ());
 }
 
-// 4-point IFFT
-template <>
-inline void	FFTRealFixLen <2>::do_ifft (const DataType f [], DataType x [])
+
+
+// Reentrant version, see do_fft()
+template <int LL2, class DT>
+void	FFTRealFixLen <LL2, DT>::do_ifft (const DataType f [], DataType x [], DataType ws []) const
 {
 	assert (f != 0);
 	assert (x != 0);
 	assert (x != f);
 
-	const DataType	b_0 = f [0] + f [2];
-	const DataType	b_2 = f [0] - f [2];
+	// General case
+	if (FFT_LEN_L2 >= 3)
+	{
+		assert (ws != 0);
+		assert (ws != f);
+		assert (ws != x);
+
+		// Do the transform in several passes. The last one must write in x.
+		DataType *		s_ptr =
+			FFTRealSelect <(NBR_SWEEPS & 1) ^ 1>::sel_bin (ws, x);
+		DataType *		d_ptr =
+			FFTRealSelect <(NBR_SWEEPS & 1) ^ 1>::sel_bin (x, ws);
+		const DataType	*	cos_ptr = _tables.get_trigo_ptr ();
+		const long *	br_ptr = _tables.get_br_ptr ();
+		OscType			osc_arr [Tables::TRIGO_OSC_ARR_SIZE];
+		_tables.copy_trigo_osc (osc_arr);
+
+		FFTRealPassInverse <LAST_PASS, DT>::process (
+			FFT_LEN,
+			d_ptr,
+			s_ptr,
+			f,
+			cos_ptr,
+			Tables::TRIGO_TABLE_ARR_SIZE,
+			br_ptr,
+			osc_arr
+		);
+	}
+
+	// 4-point IFFT
+	else if (FFT_LEN_L2 == 2)
+	{
+		const DataType	b_0 = f [0] + f [2];
+		const DataType	b_2 = f [0] - f [2];
+
+		x [0] = b_0 + f [1] * 2;
+		x [2] = b_0 - f [1] * 2;
+		x [1] = b_2 + f [3] * 2;
+		x [3] = b_2 - f [3] * 2;
+	}
+
+	// 2-point IFFT
+	else if (FFT_LEN_L2 == 1)
+	{
+		x [0] = f [0] + f [1];
+		x [1] = f [0] - f [1];
+	}
 
-	x [0] = b_0 + f [1] * 2;
-	x [2] = b_0 - f [1] * 2;
-	x [1] = b_2 + f [3] * 2;
-	x [3] = b_2 - f [3] * 2;
+	// 1-point IFFT
+	else
+	{
+		x [0] = f [0];
+	}
 }
 
-// 2-point IFFT
-template <>
-inline void	FFTRealFixLen <1>::do_ifft (const DataType f [], DataType x [])
-{
-	assert (f != 0);
-	assert (x != 0);
-	assert (x != f);
 
-	x [0] = f [0] + f [1];
-	x [1] = f [0] - f [1];
+
+template <int LL2, class DT>
+void	FFTRealFixLen <LL2, DT>::do_power_spectrum (DataType out [], const DataType x [], DataType exponent)
+{
+	do_power_spectrum (out, x, exponent, use_buffer ());
 }
 
-// 1-point IFFT
-template <>
-inline void	FFTRealFixLen <0>::do_ifft (const DataType f [], DataType x [])
+
+
+// Power of the bins raised to the exponent, as in FFTRealPower::compute().
+// From 64 points, the last sweep computes it instead of storing the
+// spectrum. out: FFT_LEN values. Bins 0 to FFT_LEN/2 get the powers, the
+// other values are overwritten.
+template <int LL2, class DT>
+void	FFTRealFixLen <LL2, DT>::do_power_spectrum (DataType out [], const DataType x [], DataType exponent, DataType ws []) const
 {
-	assert (f != 0);
+	assert (out != 0);
 	assert (x != 0);
-	assert (x != f);
+	assert (x != out);
+	assert (exponent > 0);
 
-	x [0] = f [0];
-}
+	if (FFT_LEN_L2 >= 3)
+	{
+		assert (ws != 0);
+		assert (ws != out);
+		assert (ws != x);
+
+		const DataType	*	cos_ptr = _tables.get_trigo_ptr ();
+		const long *	br_ptr = _tables.get_br_ptr ();
+		OscType			osc_arr [Tables::TRIGO_OSC_ARR_SIZE];
+		_tables.copy_trigo_osc (osc_arr);
+
+		FFTRealPassDirect <LAST_PASS, DT>::process_power (
+			FFT_LEN,
+			out,
+			ws,
+			x,
+			cos_ptr,
+			Tables::TRIGO_TABLE_ARR_SIZE,
+			br_ptr,
+			osc_arr,
+			exponent
+		);
+	}
 
+	else
+	{
+		do_fft (out, x, ws);
+		FFTRealPower <DT>::compute (out, out, FFT_LEN, exponent);
+	}
+}
 
 
 
-template <int LL2>
-void	FFTRealFixLen <LL2>::rescale (DataType x []) const
+template <int LL2, class DT>
+void	FFTRealFixLen <LL2, DT>::rescale (DataType x []) const
 {
 	assert (x != 0);
 
@@ -255,57 +320,16 @@ void	FFTRealFixLen <LL2>::rescale (DataType x []) const
 
 
 
-template <int LL2>
-void	FFTRealFixLen <LL2>::build_br_lut ()
+// Workspace for the functions called without one, allocated on first use
+template <int LL2, class DT>
+typename FFTRealFixLen <LL2, DT>::DataType *	FFTRealFixLen <LL2, DT>::use_buffer ()
 {
-	_br_data [0] = 0;
-	for (long cnt = 1; cnt < BR_ARR_SIZE; ++cnt)
+	if (_buffer.size () == 0)
 	{
-		long				index = cnt << 2;
-		long				br_index = 0;
-
-		int				bit_cnt = FFT_LEN_L2;
-		do
-		{
-			br_index <<= 1;
-			br_index += (index & 1);
-			index >>= 1;
-
-			-- bit_cnt;
-		}
-		while (bit_cnt > 0);
-
-		_br_data [cnt] = br_index;
-	}
-}
-
-
-
-template <int LL2>
-void	FFTRealFixLen <LL2>::build_trigo_lut ()
-{
-	const double	mul = (0.5 * PI) / TRIGO_TABLE_ARR_SIZE;
-	for (long i = 0; i < TRIGO_TABLE_ARR_SIZE; ++ i)
-	{
-		using namespace std;
-
-		_trigo_data [i] = DataType (cos (i * mul));
+		_buffer.resize (FFT_LEN);
 	}
-}
-
 
-
-template <int LL2>
-void	FFTRealFixLen <LL2>::build_trigo_osc ()
-{
-	for (int i = 0; i < NBR_TRIGO_OSC; ++i)
-	{
-		OscType &		osc = _trigo_osc [i];
-
-		const long		len = static_cast <long> (TRIGO_TABLE_ARR_SIZE) << (i + 1);
-		const double	mul = (0.5 * PI) / len;
-		osc.set_step (mul);
-	}
+	return (&_buffer [0]);
 }
 
 
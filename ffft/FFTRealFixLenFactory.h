@@ -0,0 +1,103 @@
+/*****************************************************************************
+
+        FFTRealFixLenFactory.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_FFTRealFixLenFactory_HEADER_INCLUDED)
+#define	ffft_FFTRealFixLenFactory_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/AllocatorHeap.h"
+#include	"ffft/FFTRealFixLenIface.h"
+
+
+
+namespace ffft
+{
+
+
+
+class FFTRealFixLenFactory
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	// Range of the pre-instantiated lengths, log2
+	enum {			MIN_LEN_L2	= 9	};
+	enum {			MAX_LEN_L2	= 14	};
+
+	static inline bool
+						is_supported (int len_l2);
+	static inline FFTRealFixLenIface *
+						create (int len_l2, Allocator &allocator = AllocatorHeap::use_instance ());
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	typedef	FFTRealFixLenIface * (*CreateFnc) (Allocator &allocator);
+
+	template <int LL2>
+	static FFTRealFixLenIface *
+						create_fixlen (Allocator &allocator);
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealFixLenFactory ();
+						~FFTRealFixLenFactory ();
+						FFTRealFixLenFactory (const FFTRealFixLenFactory &other);
+	FFTRealFixLenFactory &
+						operator = (const FFTRealFixLenFactory &other);
+	bool				operator == (const FFTRealFixLenFactory &other);
+	bool				operator != (const FFTRealFixLenFactory &other);
+
+};	// class FFTRealFixLenFactory
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/FFTRealFixLenFactory.hpp"
+
+
+
+#endif	// ffft_FFTRealFixLenFactory_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
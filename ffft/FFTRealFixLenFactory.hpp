@@ -0,0 +1,118 @@
+/*****************************************************************************
+
+        FFTRealFixLenFactory.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_FFTRealFixLenFactory_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealFixLenFactory code header.
+#endif
+#define	ffft_FFTRealFixLenFactory_CURRENT_CODEHEADER
+
+#if ! defined (ffft_FFTRealFixLenFactory_CODEHEADER_INCLUDED)
+#define	ffft_FFTRealFixLenFactory_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/FFTRealFixLenImpl.h"
+
+#include	<cassert>
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+bool	FFTRealFixLenFactory::is_supported (int len_l2)
+{
+	return (len_l2 >= MIN_LEN_L2 && len_l2 <= MAX_LEN_L2);
+}
+
+
+
+/*
+==============================================================================
+Name: create
+Description:
+	Builds a fixed-length FFT object whose length is chosen at run-time.
+	The caller owns the returned object.
+Input parameters:
+	- len_l2: base-2 logarithm of the FFT length.
+		Range: [MIN_LEN_L2 ; MAX_LEN_L2]
+	- allocator: source of the object tables and buffers. Must outlive the
+		object.
+Returns: The FFT object, or 0 if the length is out of range.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+FFTRealFixLenIface *	FFTRealFixLenFactory::create (int len_l2, Allocator &allocator)
+{
+	static const CreateFnc	fnc_arr [MAX_LEN_L2 - MIN_LEN_L2 + 1] =
+	{
+		&create_fixlen < 9>,
+		&create_fixlen <10>,
+		&create_fixlen <11>,
+		&create_fixlen <12>,
+		&create_fixlen <13>,
+		&create_fixlen <14>
+	};
+
+	assert (is_supported (len_l2));
+
+	FFTRealFixLenIface *	fft_ptr = 0;
+	if (is_supported (len_l2))
+	{
+		fft_ptr = fnc_arr [len_l2 - MIN_LEN_L2] (allocator);
+	}
+
+	return (fft_ptr);
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <int LL2>
+FFTRealFixLenIface *	FFTRealFixLenFactory::create_fixlen (Allocator &allocator)
+{
+	return (new FFTRealFixLenImpl <LL2> (allocator));
+}
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_FFTRealFixLenFactory_CODEHEADER_INCLUDED
+
+#undef ffft_FFTRealFixLenFactory_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,109 @@
+/*****************************************************************************
+
+        FFTRealFixLenIface.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_FFTRealFixLenIface_HEADER_INCLUDED)
+#define	ffft_FFTRealFixLenIface_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/FFTRealFixLenParam.h"
+
+
+
+namespace ffft
+{
+
+
+
+// Common interface for FFTRealFixLen objects of any length, so the length can
+// be chosen at run-time (see FFTRealFixLenFactory). The implementations are
+// the regular fully unrolled FFTRealFixLen objects; the only overhead is one
+// virtual call per transform.
+// The const functions taking a workspace (get_workspace_len() values) leave
+// the object untouched, so one object can serve several threads at once.
+class FFTRealFixLenIface
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	FFTRealFixLenParam::DataType	DataType;
+
+	virtual			~FFTRealFixLenIface () {}
+
+	virtual long	get_length () const = 0;
+	virtual long	get_workspace_len () const = 0;
+	virtual void	do_fft (DataType f [], const DataType x []) = 0;
+	virtual void	do_fft (DataType f [], const DataType x [], DataType ws []) const = 0;
+	virtual void	do_ifft (const DataType f [], DataType x []) = 0;
+	virtual void	do_ifft (const DataType f [], DataType x [], DataType ws []) const = 0;
+	virtual void	do_power_spectrum (DataType out [], const DataType x [], DataType exponent) = 0;
+	virtual void	do_power_spectrum (DataType out [], const DataType x [], DataType exponent, DataType ws []) const = 0;
+	virtual void	do_fft_batch (DataType f [], const DataType x [], long nbr_frames) = 0;
+	virtual void	do_fft_batch (DataType f [], const DataType x [], long nbr_frames, DataType ws []) const = 0;
+	virtual void	rescale (DataType x []) const = 0;
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+						FFTRealFixLenIface () {}
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealFixLenIface (const FFTRealFixLenIface &other);
+	FFTRealFixLenIface &
+						operator = (const FFTRealFixLenIface &other);
+	bool				operator == (const FFTRealFixLenIface &other);
+	bool				operator != (const FFTRealFixLenIface &other);
+
+};	// class FFTRealFixLenIface
+
+
+
+}	// namespace ffft
+
+
+
+//#include	"ffft/FFTRealFixLenIface.hpp"
+
+
+
+#endif	// ffft_FFTRealFixLenIface_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,118 @@
+/*****************************************************************************
+
+        FFTRealFixLenImpl.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_FFTRealFixLenImpl_HEADER_INCLUDED)
+#define	ffft_FFTRealFixLenImpl_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/FFTRealFixLen.h"
+#include	"ffft/FFTRealFixLenIface.h"
+#include	"ffft/FFTReal.h"
+#include	"ffft/FFTRealSharedPlan.h"
+
+
+
+namespace ffft
+{
+
+
+
+template <int LL2>
+class FFTRealFixLenImpl
+:	public FFTRealFixLenIface
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	FFTRealFixLen <LL2>	FftType;
+
+	explicit			FFTRealFixLenImpl (Allocator &allocator = AllocatorHeap::use_instance ());
+	virtual			~FFTRealFixLenImpl () {}
+
+	// FFTRealFixLenIface
+	virtual long	get_length () const;
+	virtual long	get_workspace_len () const;
+	virtual void	do_fft (DataType f [], const DataType x []);
+	virtual void	do_fft (DataType f [], const DataType x [], DataType ws []) const;
+	virtual void	do_ifft (const DataType f [], DataType x []);
+	virtual void	do_ifft (const DataType f [], DataType x [], DataType ws []) const;
+	virtual void	do_power_spectrum (DataType out [], const DataType x [], DataType exponent);
+	virtual void	do_power_spectrum (DataType out [], const DataType x [], DataType exponent, DataType ws []) const;
+	virtual void	do_fft_batch (DataType f [], const DataType x [], long nbr_frames);
+	virtual void	do_fft_batch (DataType f [], const DataType x [], long nbr_frames, DataType ws []) const;
+	virtual void	rescale (DataType x []) const;
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	typedef	FFTRealSharedPlan <FFTReal <DataType> >	BatchType;
+
+	DataType *		use_batch_buffer ();
+
+	FftType			_fft;
+	const BatchType &
+						_batch_fft;		// Shared plan for the multi-frame passes
+	DynArray <DataType>
+						_batch_buffer;	// Allocated on first use
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealFixLenImpl (const FFTRealFixLenImpl &other);
+	FFTRealFixLenImpl &
+						operator = (const FFTRealFixLenImpl &other);
+	bool				operator == (const FFTRealFixLenImpl &other);
+	bool				operator != (const FFTRealFixLenImpl &other);
+
+};	// class FFTRealFixLenImpl
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/FFTRealFixLenImpl.hpp"
+
+
+
+#endif	// ffft_FFTRealFixLenImpl_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,228 @@
+/*****************************************************************************
+
+        FFTRealFixLenImpl.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_FFTRealFixLenImpl_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealFixLenImpl code header.
+#endif
+#define	ffft_FFTRealFixLenImpl_CURRENT_CODEHEADER
+
+#if ! defined (ffft_FFTRealFixLenImpl_CODEHEADER_INCLUDED)
+#define	ffft_FFTRealFixLenImpl_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/FFTRealPlanCache.h"
+
+#include	<algorithm>
+
+#include	<cassert>
+
+
+
+namespace ffft
+{
+
+
+
+// FFTRealPlanCache.h also includes this file, through FFTRealFixLenFactory.h.
+// When it comes first, the cache is not declared yet at this point: it is
+// only named with a dependent type below.
+template <class DT>
+class FFTRealPlanCache;
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// The FFTReal of the same length is taken from the plan cache, so its tables
+// are shared with the other users of this length.
+template <int LL2>
+FFTRealFixLenImpl <LL2>::FFTRealFixLenImpl (Allocator &allocator)
+:	_fft (allocator)
+,	_batch_fft (
+		FFTRealPlanCache <typename FftType::DataType>::use_plan (FftType::FFT_LEN)
+	)
+,	_batch_buffer (allocator)
+{
+	// Nothing
+}
+
+
+
+template <int LL2>
+long	FFTRealFixLenImpl <LL2>::get_length () const
+{
+	return (_fft.get_length ());
+}
+
+
+
+// Enough for the batches too
+template <int LL2>
+long	FFTRealFixLenImpl <LL2>::get_workspace_len () const
+{
+	return (std::max (_fft.get_workspace_len (), _batch_fft.get_workspace_len ()));
+}
+
+
+
+template <int LL2>
+void	FFTRealFixLenImpl <LL2>::do_fft (DataType f [], const DataType x [])
+{
+	_fft.do_fft (f, x);
+}
+
+
+
+template <int LL2>
+void	FFTRealFixLenImpl <LL2>::do_fft (DataType f [], const DataType x [], DataType ws []) const
+{
+	_fft.do_fft (f, x, ws);
+}
+
+
+
+template <int LL2>
+void	FFTRealFixLenImpl <LL2>::do_ifft (const DataType f [], DataType x [])
+{
+	_fft.do_ifft (f, x);
+}
+
+
+
+template <int LL2>
+void	FFTRealFixLenImpl <LL2>::do_ifft (const DataType f [], DataType x [], DataType ws []) const
+{
+	_fft.do_ifft (f, x, ws);
+}
+
+
+
+template <int LL2>
+void	FFTRealFixLenImpl <LL2>::do_power_spectrum (DataType out [], const DataType x [], DataType exponent)
+{
+	_fft.do_power_spectrum (out, x, exponent);
+}
+
+
+
+template <int LL2>
+void	FFTRealFixLenImpl <LL2>::do_power_spectrum (DataType out [], const DataType x [], DataType exponent, DataType ws []) const
+{
+	_fft.do_power_spectrum (out, x, exponent, ws);
+}
+
+
+
+/*
+==============================================================================
+Name: do_fft_batch
+Description:
+	Transforms nbr_frames consecutive frames. Whole groups of vector lanes go
+	through FFTReal::do_fft_batch(), the remaining frames through the
+	unrolled FFT.
+Input parameters:
+	- x: nbr_frames * length source values, one frame after the other.
+	- nbr_frames: number of frames, >= 0.
+Output parameters:
+	- f: nbr_frames * length destination values, same layout.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <int LL2>
+void	FFTRealFixLenImpl <LL2>::do_fft_batch (DataType f [], const DataType x [], long nbr_frames)
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (nbr_frames >= 0);
+
+	do_fft_batch (f, x, nbr_frames, use_batch_buffer ());
+}
+
+
+
+// Reentrant version, ws holds get_workspace_len() values.
+template <int LL2>
+void	FFTRealFixLenImpl <LL2>::do_fft_batch (DataType f [], const DataType x [], long nbr_frames, DataType ws []) const
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (nbr_frames >= 0);
+	assert (ws != 0);
+
+	typedef	FFTRealLanes <DataType>	Lanes;
+
+	const long		len = _fft.get_length ();
+	long				frame = 0;
+	if (Lanes::is_usable (FFTRealSimd <DataType>::get_level ()))
+	{
+		frame = nbr_frames - nbr_frames % Lanes::NBR_LANES;
+		_batch_fft.do_fft_batch (f, x, frame, ws);
+	}
+
+	for ( ; frame < nbr_frames; ++frame)
+	{
+		_fft.do_fft (f + frame * len, x + frame * len, ws);
+	}
+}
+
+
+
+template <int LL2>
+void	FFTRealFixLenImpl <LL2>::rescale (DataType x []) const
+{
+	_fft.rescale (x);
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <int LL2>
+typename FFTRealFixLenImpl <LL2>::DataType *	FFTRealFixLenImpl <LL2>::use_batch_buffer ()
+{
+	if (_batch_buffer.size () == 0)
+	{
+		_batch_buffer.resize (get_workspace_len ());
+	}
+
+	return (&_batch_buffer [0]);
+}
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_FFTRealFixLenImpl_CODEHEADER_INCLUDED
+
+#undef ffft_FFTRealFixLenImpl_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,137 @@
+/*****************************************************************************
+
+        FFTRealFixLenTables.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_FFTRealFixLenTables_HEADER_INCLUDED)
+#define	ffft_FFTRealFixLenTables_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/def.h"
+#include	"ffft/Array.h"
+#include	"ffft/FFTRealFixLenParam.h"
+#include	"ffft/OscSinCos.h"
+
+
+
+namespace ffft
+{
+
+
+
+// Bit-reversal and trigonometric tables of FFTRealFixLen <LL2, DT>. There is
+// a single object per length and data type, in static storage, built on first
+// use and read-only afterwards. All the FFT objects of this length share it.
+template <int LL2, class DT>
+class FFTRealFixLenTables
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	DT	DataType;
+	typedef	OscSinCos <DataType>	OscType;
+
+	enum {			FFT_LEN_L2	= LL2	};
+
+	enum {			TRIGO_BD_LIMIT	= FFTRealFixLenParam::TRIGO_BD_LIMIT	};
+
+	enum {			BR_ARR_SIZE_L2	= ((FFT_LEN_L2 - 3) < 0) ? 0 : (FFT_LEN_L2 - 2)	};
+	enum {			BR_ARR_SIZE		= 1 << BR_ARR_SIZE_L2	};
+
+	enum {			TRIGO_BD			=   ((FFT_LEN_L2 - TRIGO_BD_LIMIT) < 0)
+												  ? (int)FFT_LEN_L2
+												  : (int)TRIGO_BD_LIMIT };
+	// One table per pass, stored one after the other (see build_trigo_lut()).
+	// There is one more than the passes using them, for the radix-4 sweep
+	// that starts at the last one.
+	enum {			TRIGO_TABLE_BD			= ((int)TRIGO_BD < (int)FFT_LEN_L2) ? TRIGO_BD + 1 : TRIGO_BD	};
+	enum {			TRIGO_TABLE_ARR_SIZE	= (LL2 < 4) ? 1 : (1 << (TRIGO_TABLE_BD - 1)) - 4	};
+
+	enum {			NBR_TRIGO_OSC			= FFT_LEN_L2 - TRIGO_BD	};
+	enum {			TRIGO_OSC_ARR_SIZE	=	(NBR_TRIGO_OSC > 0) ? NBR_TRIGO_OSC : 1	};
+
+	static const FFTRealFixLenTables &
+							use_instance ();
+
+	inline const long *
+							get_br_ptr () const;
+	inline const DataType *
+							get_trigo_ptr () const;
+	inline void	copy_trigo_osc (OscType osc_arr []) const;
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+							FFTRealFixLenTables ();
+							~FFTRealFixLenTables () {}
+
+	void				build_br_lut ();
+	void				build_trigo_lut ();
+	void				build_trigo_osc ();
+
+	Array <long, BR_ARR_SIZE>
+							_br_data;
+	Array <DataType, TRIGO_TABLE_ARR_SIZE>
+							_trigo_data;
+	Array <OscType, TRIGO_OSC_ARR_SIZE>
+							_trigo_osc;
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+							FFTRealFixLenTables (const FFTRealFixLenTables &other);
+	FFTRealFixLenTables &
+							operator = (const FFTRealFixLenTables &other);
+	bool				operator == (const FFTRealFixLenTables &other);
+	bool				operator != (const FFTRealFixLenTables &other);
+
+};	// class FFTRealFixLenTables
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/FFTRealFixLenTables.hpp"
+
+
+
+#endif	// ffft_FFTRealFixLenTables_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
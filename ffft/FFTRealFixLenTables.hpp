@@ -0,0 +1,182 @@
+/*****************************************************************************
+
+        FFTRealFixLenTables.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_FFTRealFixLenTables_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealFixLenTables code header.
+#endif
+#define	ffft_FFTRealFixLenTables_CURRENT_CODEHEADER
+
+#if ! defined (ffft_FFTRealFixLenTables_CODEHEADER_INCLUDED)
+#define	ffft_FFTRealFixLenTables_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+#include	<cmath>
+
+namespace std { }
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// The object is built by the first caller. C++11 compilers make this
+// thread-safe, GCC and Clang do it for older standards too.
+template <int LL2, class DT>
+const FFTRealFixLenTables <LL2, DT> &	FFTRealFixLenTables <LL2, DT>::use_instance ()
+{
+	static const FFTRealFixLenTables	instance;
+
+	return (instance);
+}
+
+
+
+template <int LL2, class DT>
+const long *	FFTRealFixLenTables <LL2, DT>::get_br_ptr () const
+{
+	return (&_br_data [0]);
+}
+
+
+
+template <int LL2, class DT>
+const typename FFTRealFixLenTables <LL2, DT>::DataType *	FFTRealFixLenTables <LL2, DT>::get_trigo_ptr () const
+{
+	return (&_trigo_data [0]);
+}
+
+
+
+// The oscillators are modified during the transform, so each call works on
+// its own copy.
+template <int LL2, class DT>
+void	FFTRealFixLenTables <LL2, DT>::copy_trigo_osc (OscType osc_arr []) const
+{
+	assert (osc_arr != 0);
+
+	for (int i = 0; i < NBR_TRIGO_OSC; ++i)
+	{
+		osc_arr [i] = _trigo_osc [i];
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <int LL2, class DT>
+FFTRealFixLenTables <LL2, DT>::FFTRealFixLenTables ()
+:	_br_data ()
+,	_trigo_data ()
+,	_trigo_osc ()
+{
+	build_br_lut ();
+	build_trigo_lut ();
+	build_trigo_osc ();
+}
+
+
+
+template <int LL2, class DT>
+void	FFTRealFixLenTables <LL2, DT>::build_br_lut ()
+{
+	_br_data [0] = 0;
+	for (long cnt = 1; cnt < BR_ARR_SIZE; ++cnt)
+	{
+		long				index = cnt << 2;
+		long				br_index = 0;
+
+		int				bit_cnt = FFT_LEN_L2;
+		do
+		{
+			br_index <<= 1;
+			br_index += (index & 1);
+			index >>= 1;
+
+			-- bit_cnt;
+		}
+		while (bit_cnt > 0);
+
+		_br_data [cnt] = br_index;
+	}
+}
+
+
+
+// Pass p (3 <= p < TRIGO_TABLE_BD) uses cos (i * PI / (1 << p)), i in
+// [0 ; 1 << (p - 1)[, at offset (1 << (p - 1)) - 4. Each pass reads its
+// table contiguously, which the vectorized passes need.
+template <int LL2, class DT>
+void	FFTRealFixLenTables <LL2, DT>::build_trigo_lut ()
+{
+	for (int pass = 3; pass < TRIGO_TABLE_BD; ++ pass)
+	{
+		const long		level_len = 1L << (pass - 1);
+		DataType * const	level_ptr = &_trigo_data [level_len - 4];
+		const double	mul = PI / (level_len << 1);
+		for (long i = 0; i < level_len; ++ i)
+		{
+			using namespace std;
+
+			level_ptr [i] = DataType (cos (i * mul));
+		}
+	}
+}
+
+
+
+template <int LL2, class DT>
+void	FFTRealFixLenTables <LL2, DT>::build_trigo_osc ()
+{
+	for (int i = 0; i < NBR_TRIGO_OSC; ++i)
+	{
+		OscType &		osc = _trigo_osc [i];
+
+		const long		len = 1L << (TRIGO_BD - 1 + i);
+		const double	mul = (0.5 * PI) / len;
+		osc.set_step (mul);
+	}
+}
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_FFTRealFixLenTables_CODEHEADER_INCLUDED
+
+#undef ffft_FFTRealFixLenTables_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
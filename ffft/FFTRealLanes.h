@@ -0,0 +1,178 @@
+/*****************************************************************************
+
+        FFTRealLanes.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_FFTRealLanes_HEADER_INCLUDED)
+#define	ffft_FFTRealLanes_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/def.h"
+
+#if defined (ffft_SIMD_SSE2)
+    #include	<emmintrin.h>
+#endif
+
+
+
+namespace ffft
+{
+
+
+
+// Vector type used by FFTReal::do_fft_batch(). Each lane of a vector carries
+// the same coefficient of a different frame, so the batched passes are the
+// scalar ones with DataType replaced by VectorType: the twiddle factors and
+// bit-reversed indexes are fetched once for NBR_LANES frames.
+// Generic version: one lane, the batch functions fall back to a loop.
+template <class DT>
+class FFTRealLanes
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	DT	DataType;
+	typedef	DT	VectorType;
+
+	enum {			NBR_LANES	= 1	};
+
+	static inline bool
+						is_usable (int simd_level);
+	static inline void
+						interleave (VectorType dst [], const DataType src [], long len, const long index_ptr []);
+	static inline void
+						deinterleave (DataType dst [], const VectorType src [], long len, const long index_ptr []);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealLanes ();
+						~FFTRealLanes ();
+						FFTRealLanes (const FFTRealLanes &other);
+	FFTRealLanes &
+						operator = (const FFTRealLanes &other);
+	bool				operator == (const FFTRealLanes &other);
+	bool				operator != (const FFTRealLanes &other);
+
+};	// class FFTRealLanes
+
+
+
+#if defined (ffft_SIMD_SSE2)
+
+// float: 4 frames per SSE2 register.
+template <>
+class FFTRealLanes <float>
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	float	DataType;
+
+	class VectorType
+	{
+	public:
+							VectorType () {}
+		explicit			VectorType (__m128 v) : _v (v) {}
+		__m128			_v;
+	};
+
+	enum {			NBR_LANES	= 4	};
+
+	static inline bool
+						is_usable (int simd_level);
+	static inline void
+						interleave (VectorType dst [], const DataType src [], long len, const long index_ptr []);
+	static inline void
+						deinterleave (DataType dst [], const VectorType src [], long len, const long index_ptr []);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealLanes ();
+						~FFTRealLanes ();
+						FFTRealLanes (const FFTRealLanes &other);
+	FFTRealLanes &
+						operator = (const FFTRealLanes &other);
+	bool				operator == (const FFTRealLanes &other);
+	bool				operator != (const FFTRealLanes &other);
+
+};	// class FFTRealLanes <float>
+
+ffft_FORCEINLINE FFTRealLanes <float>::VectorType
+						operator + (FFTRealLanes <float>::VectorType a, FFTRealLanes <float>::VectorType b);
+ffft_FORCEINLINE FFTRealLanes <float>::VectorType
+						operator - (FFTRealLanes <float>::VectorType a, FFTRealLanes <float>::VectorType b);
+ffft_FORCEINLINE FFTRealLanes <float>::VectorType
+						operator * (FFTRealLanes <float>::VectorType a, float b);
+
+#endif	// ffft_SIMD_SSE2
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/FFTRealLanes.hpp"
+
+
+
+#endif	// ffft_FFTRealLanes_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
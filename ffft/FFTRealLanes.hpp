@@ -0,0 +1,231 @@
+/*****************************************************************************
+
+        FFTRealLanes.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_FFTRealLanes_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealLanes code header.
+#endif
+#define	ffft_FFTRealLanes_CURRENT_CODEHEADER
+
+#if ! defined (ffft_FFTRealLanes_CODEHEADER_INCLUDED)
+#define	ffft_FFTRealLanes_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <class DT>
+bool	FFTRealLanes <DT>::is_usable (int simd_level)
+{
+	(void) simd_level;
+
+	return (false);
+}
+
+
+
+/*
+==============================================================================
+Name: interleave
+Description:
+	Gathers NBR_LANES consecutive frames into one vector array: lane k of
+	dst [index_ptr [i]] is src [k * len + i].
+Input parameters:
+	- src: NBR_LANES frames of len samples each, one after the other.
+	- len: length of a frame, > 0. Multiple of 4 for the vector versions.
+	- index_ptr: destination of each element (a permutation of 0...len-1,
+		like the bit-reversal table), or 0 to keep the order.
+Output parameters:
+	- dst: len vectors.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealLanes <DT>::interleave (VectorType dst [], const DataType src [], long len, const long index_ptr [])
+{
+	assert (dst != 0);
+	assert (src != 0);
+	assert (len > 0);
+
+	for (long i = 0; i < len; ++i)
+	{
+		const long		pos = (index_ptr != 0) ? index_ptr [i] : i;
+		dst [pos] = src [i];
+	}
+}
+
+
+
+// Reverse of interleave(): lane k of src [index_ptr [i]] goes to
+// dst [k * len + i].
+template <class DT>
+void	FFTRealLanes <DT>::deinterleave (DataType dst [], const VectorType src [], long len, const long index_ptr [])
+{
+	assert (dst != 0);
+	assert (src != 0);
+	assert (len > 0);
+
+	for (long i = 0; i < len; ++i)
+	{
+		const long		pos = (index_ptr != 0) ? index_ptr [i] : i;
+		dst [i] = src [pos];
+	}
+}
+
+
+
+#if defined (ffft_SIMD_SSE2)
+
+bool	FFTRealLanes <float>::is_usable (int simd_level)
+{
+	return (simd_level >= SimdLevel_SSE2);
+}
+
+
+
+// 4x4 transposes
+void	FFTRealLanes <float>::interleave (VectorType dst [], const DataType src [], long len, const long index_ptr [])
+{
+	assert (dst != 0);
+	assert (src != 0);
+	assert (len >= 4);
+	assert ((len & 3) == 0);
+
+	const DataType * const	src_1 = src + len;
+	const DataType * const	src_2 = src_1 + len;
+	const DataType * const	src_3 = src_2 + len;
+	for (long i = 0; i < len; i += 4)
+	{
+		__m128			r0 = _mm_loadu_ps (src + i);
+		__m128			r1 = _mm_loadu_ps (src_1 + i);
+		__m128			r2 = _mm_loadu_ps (src_2 + i);
+		__m128			r3 = _mm_loadu_ps (src_3 + i);
+		_MM_TRANSPOSE4_PS (r0, r1, r2, r3);
+		if (index_ptr != 0)
+		{
+			dst [index_ptr [i    ]]._v = r0;
+			dst [index_ptr [i + 1]]._v = r1;
+			dst [index_ptr [i + 2]]._v = r2;
+			dst [index_ptr [i + 3]]._v = r3;
+		}
+		else
+		{
+			dst [i    ]._v = r0;
+			dst [i + 1]._v = r1;
+			dst [i + 2]._v = r2;
+			dst [i + 3]._v = r3;
+		}
+	}
+}
+
+
+
+void	FFTRealLanes <float>::deinterleave (DataType dst [], const VectorType src [], long len, const long index_ptr [])
+{
+	assert (dst != 0);
+	assert (src != 0);
+	assert (len >= 4);
+	assert ((len & 3) == 0);
+
+	DataType * const	dst_1 = dst + len;
+	DataType * const	dst_2 = dst_1 + len;
+	DataType * const	dst_3 = dst_2 + len;
+	for (long i = 0; i < len; i += 4)
+	{
+		__m128			r0;
+		__m128			r1;
+		__m128			r2;
+		__m128			r3;
+		if (index_ptr != 0)
+		{
+			r0 = src [index_ptr [i    ]]._v;
+			r1 = src [index_ptr [i + 1]]._v;
+			r2 = src [index_ptr [i + 2]]._v;
+			r3 = src [index_ptr [i + 3]]._v;
+		}
+		else
+		{
+			r0 = src [i    ]._v;
+			r1 = src [i + 1]._v;
+			r2 = src [i + 2]._v;
+			r3 = src [i + 3]._v;
+		}
+		_MM_TRANSPOSE4_PS (r0, r1, r2, r3);
+		_mm_storeu_ps (dst + i, r0);
+		_mm_storeu_ps (dst_1 + i, r1);
+		_mm_storeu_ps (dst_2 + i, r2);
+		_mm_storeu_ps (dst_3 + i, r3);
+	}
+}
+
+
+
+FFTRealLanes <float>::VectorType	operator + (FFTRealLanes <float>::VectorType a, FFTRealLanes <float>::VectorType b)
+{
+	return (FFTRealLanes <float>::VectorType (_mm_add_ps (a._v, b._v)));
+}
+
+
+
+FFTRealLanes <float>::VectorType	operator - (FFTRealLanes <float>::VectorType a, FFTRealLanes <float>::VectorType b)
+{
+	return (FFTRealLanes <float>::VectorType (_mm_sub_ps (a._v, b._v)));
+}
+
+
+
+// Same scalar for all the lanes (twiddle factors)
+FFTRealLanes <float>::VectorType	operator * (FFTRealLanes <float>::VectorType a, float b)
+{
+	return (FFTRealLanes <float>::VectorType (_mm_mul_ps (a._v, _mm_set1_ps (b))));
+}
+
+#endif	// ffft_SIMD_SSE2
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_FFTRealLanes_CODEHEADER_INCLUDED
+
+#undef ffft_FFTRealLanes_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,183 @@
+/*****************************************************************************
+
+        FFTRealLarge.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_FFTRealLarge_HEADER_INCLUDED)
+#define	ffft_FFTRealLarge_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/AllocatorHeap.h"
+#include	"ffft/DynArray.h"
+#include	"ffft/FFTReal.h"
+#include	"ffft/ThreadPool.h"
+
+
+
+namespace ffft
+{
+
+
+
+// Real FFT for the lengths that do not fit in the cache, in four steps.
+// The data is seen as a matrix of N1 columns and N2 rows, x [n1 + N1 * n2]:
+// 1. Real FFT of length N2 of each column,
+// 2. Multiplication by the twiddle factors,
+// 3. Complex FFT of length N1 of the rows k2 = 0...N2/2. The other rows are
+//    the conjugates of these ones.
+// 4. Transposition to the FFTReal output order, X [k1 * N2 + k2].
+// Each sub-transform fits in the cache and runs on FFTReal. The columns and
+// the rows go through the main memory by blocks of consecutive positions, a
+// cache line wide. The output format and scale are the same as FFTReal.
+// With a thread pool, the columns and the rows of each step are shared
+// between the threads.
+// Below about 2^19 samples, FFTReal itself is faster.
+template <class DT>
+class FFTRealLarge
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	DT	DataType;
+
+	explicit			FFTRealLarge (long length, Allocator &allocator = AllocatorHeap::use_instance ());
+	virtual			~FFTRealLarge () {}
+
+	void				set_thread_pool (ThreadPool *pool_ptr);
+	long				get_length () const;
+	long				get_workspace_len () const;
+	void				do_fft (DataType f [], const DataType x []) const;
+	void				do_fft (DataType f [], const DataType x [], DataType ws []) const;
+	void				do_ifft (const DataType f [], DataType x []) const;
+	void				do_ifft (const DataType f [], DataType x [], DataType ws []) const;
+	void				rescale (DataType x []) const;
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	// Columns or rows moved together, one cache line
+	enum {			BLOCK_LEN = 64 / sizeof (DT)	};
+
+	// Shorter transforms stay on the calling thread, waking up the workers
+	// would cost more than it saves.
+	enum {			PAR_LEN_L2 = 16	};
+
+	// Parts per thread, to balance the load when some threads are late
+	enum {			PARTS_PER_THREAD = 4	};
+
+	enum Step
+	{
+		Step_FWD_COLUMNS = 0,
+		Step_FWD_ROWS,
+		Step_INV_ROWS,
+		Step_INV_COLUMNS
+	};
+
+	// One step of a transform, split in parts of whole blocks
+	class StepTask
+	:	public ThreadPool::Task
+	{
+	public:
+		virtual void	process (int part, int thread);
+
+		const FFTRealLarge *
+							_obj_ptr;
+		Step				_step;
+		const DataType *
+							_src_ptr;
+		DataType *		_dst_ptr;
+		DataType *		_ws_ptr;
+		long				_part_len;
+		long				_nbr_pos;
+	};
+
+	friend class StepTask;
+
+	static long		compute_len_1 (long length);
+	void				fwd_columns (const DataType x [], DataType mat_ptr [], DataType loc_ptr [], long n1_beg, long n1_end) const;
+	void				fwd_rows (DataType f [], DataType mat_ptr [], DataType loc_ptr [], long k2_beg, long k2_end) const;
+	void				inv_rows (const DataType f [], DataType mat_ptr [], DataType loc_ptr [], long k2_beg, long k2_end) const;
+	void				inv_columns (DataType x [], DataType mat_ptr [], DataType loc_ptr [], long n1_beg, long n1_end) const;
+	inline void		rotate_row (DataType row_ptr [], long k2, DataType dir) const;
+	inline void		get_twiddle (DataType &c, DataType &s, long lo, long hi) const;
+	int				get_nbr_threads () const;
+	void				run_step (Step step, const DataType src_ptr [], DataType dst_ptr [], DataType ws [], long nbr_pos) const;
+	void				run_part (Step step, const DataType src_ptr [], DataType dst_ptr [], DataType ws [], long beg, long end, int thread) const;
+	DataType *		use_buffer () const;
+
+	const long		_length;
+	const long		_len_1;			// N1, number of columns
+	const long		_len_2;			// N2, number of rows
+	const long		_nbr_rows;		// Rows actually computed, N2/2 + 1
+	const long		_row_stride;	// Complex rows of N1 values, padded: a power of 2 stride thrashes the cache
+	const long		_col_stride;	// Columns of N2 values, padded too
+	FFTReal <DataType>
+							_fft_1;			// Rows
+	FFTReal <DataType>
+							_fft_2;			// Columns
+	const long		_local_len;		// Workspace of a column or a row step
+	DynArray <DataType>
+							_trigo_lut;		// exp (2*PI*i*m/length), see the ctor
+	mutable DynArray <DataType>
+							_buffer;			// Workspace for the functions called without one
+	ThreadPool *	_pool_ptr;		// 0: single thread
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+							FFTRealLarge ();
+							FFTRealLarge (const FFTRealLarge &other);
+	FFTRealLarge &	operator = (const FFTRealLarge &other);
+	bool				operator == (const FFTRealLarge &other);
+	bool				operator != (const FFTRealLarge &other);
+
+};	// class FFTRealLarge
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/FFTRealLarge.hpp"
+
+
+
+#endif	// ffft_FFTRealLarge_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
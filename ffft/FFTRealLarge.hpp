@@ -0,0 +1,759 @@
+/*****************************************************************************
+
+        FFTRealLarge.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_FFTRealLarge_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealLarge code header.
+#endif
+#define	ffft_FFTRealLarge_CURRENT_CODEHEADER
+
+#if ! defined (ffft_FFTRealLarge_CODEHEADER_INCLUDED)
+#define	ffft_FFTRealLarge_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/def.h"
+
+#include	<algorithm>
+
+#include	<cassert>
+#include	<cmath>
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: ctor
+Input parameters:
+	- length: length of the FFT, power of 2, 4 or more.
+	- allocator: provides the tables, the buffer and the sub-transforms.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <class DT>
+FFTRealLarge <DT>::FFTRealLarge (long length, Allocator &allocator)
+:	_length (length)
+,	_len_1 (compute_len_1 (length))
+,	_len_2 (length / _len_1)
+,	_nbr_rows ((_len_2 >> 1) + 1)
+,	_row_stride (_len_1 * 2 + BLOCK_LEN)
+,	_col_stride (_len_2 + BLOCK_LEN)
+,	_fft_1 (_len_1, allocator)
+,	_fft_2 (_len_2, allocator)
+,	_local_len (std::max (
+		BLOCK_LEN * _col_stride + _len_2 + _fft_2.get_workspace_len (),
+		(BLOCK_LEN + 1) * _row_stride + _fft_1.get_workspace_len ()
+))
+,	_trigo_lut ((_len_1 + _nbr_rows * (BLOCK_LEN + 1)) * 2, allocator)
+,	_buffer (allocator)
+,	_pool_ptr (0)
+{
+	assert (length >= 4);
+	assert ((length & (length - 1)) == 0);
+
+	// Three tables, with cos and sin for each m:
+	// - m in [0 ; N1[,
+	// - m = j * N1, j in [0 ; N2/2],
+	// - For each row k2 in [0 ; N2/2], m = k2 * l, l in [0 ; BLOCK_LEN[.
+	//   All the cos, then all the sin, as they are used by rotate_row().
+	DataType * const	fine_ptr = &_trigo_lut [0];
+	DataType * const	coarse_ptr = fine_ptr + _len_1 * 2;
+	DataType * const	block_ptr = coarse_ptr + _nbr_rows * 2;
+	const double	mul = 2 * PI / _length;
+	for (long m = 0; m < _len_1; ++m)
+	{
+		fine_ptr [m * 2    ] = DataType (cos (m * mul));
+		fine_ptr [m * 2 + 1] = DataType (sin (m * mul));
+	}
+	for (long j = 0; j < _nbr_rows; ++j)
+	{
+		coarse_ptr [j * 2    ] = DataType (cos (j * _len_1 * mul));
+		coarse_ptr [j * 2 + 1] = DataType (sin (j * _len_1 * mul));
+	}
+	for (long k2 = 0; k2 < _nbr_rows; ++k2)
+	{
+		DataType * const	row_ptr = block_ptr + k2 * BLOCK_LEN * 2;
+		for (long l = 0; l < BLOCK_LEN; ++l)
+		{
+			row_ptr [            l] = DataType (cos (k2 * l * mul));
+			row_ptr [BLOCK_LEN + l] = DataType (sin (k2 * l * mul));
+		}
+	}
+}
+
+
+
+/*
+==============================================================================
+Name: set_thread_pool
+Description:
+	Shares the next transforms between the threads of a pool, from 2^16
+	samples. The workspace grows with the number of threads, the buffers
+	given to do_fft() and do_ifft() must follow get_workspace_len().
+	The pool may be shared with other objects and threads, their transforms
+	then take turns on it.
+Input parameters:
+	- pool_ptr: the pool, or 0 to stay on the calling thread. The pool
+		must outlive its use by the object.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealLarge <DT>::set_thread_pool (ThreadPool *pool_ptr)
+{
+	_pool_ptr = pool_ptr;
+}
+
+
+
+template <class DT>
+long	FFTRealLarge <DT>::get_length () const
+{
+	return (_length);
+}
+
+
+
+// The intermediate matrix, N2/2 + 1 complex rows, then the local workspace
+// of each thread
+template <class DT>
+long	FFTRealLarge <DT>::get_workspace_len () const
+{
+	return (_nbr_rows * _row_stride + _local_len * get_nbr_threads ());
+}
+
+
+
+template <class DT>
+void	FFTRealLarge <DT>::do_fft (DataType f [], const DataType x []) const
+{
+	do_fft (f, x, use_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_fft
+Description:
+	Compute the FFT of the array, same output as FFTReal::do_fft().
+Input parameters:
+	- x: pointer on the source array (time).
+Output parameters:
+	- f: pointer on the destination array (frequencies).
+		f [0...length(x)/2] = real values,
+		f [length(x)/2+1...length(x)-1] = negative imaginary values of
+		coefficents 1...length(x)/2-1.
+Input/output parameters:
+	- ws: workspace, get_workspace_len() values at least.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealLarge <DT>::do_fft (DataType f [], const DataType x [], DataType ws []) const
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (ws != 0);
+	assert (f != x);
+
+	run_step (Step_FWD_COLUMNS, x, 0, ws, _len_1);
+	run_step (Step_FWD_ROWS, 0, f, ws, _nbr_rows);
+}
+
+
+
+template <class DT>
+void	FFTRealLarge <DT>::do_ifft (const DataType f [], DataType x []) const
+{
+	do_ifft (f, x, use_buffer ());
+}
+
+
+
+/*
+==============================================================================
+Name: do_ifft
+Description:
+	Compute the inverse FFT of the array, same output as FFTReal::do_ifft().
+	Data is not rescaled.
+Input parameters:
+	- f: pointer on the source array (frequencies).
+Output parameters:
+	- x: pointer on the destination array (time).
+Input/output parameters:
+	- ws: workspace, get_workspace_len() values at least.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealLarge <DT>::do_ifft (const DataType f [], DataType x [], DataType ws []) const
+{
+	assert (f != 0);
+	assert (x != 0);
+	assert (ws != 0);
+	assert (f != x);
+
+	run_step (Step_INV_ROWS, f, 0, ws, _nbr_rows);
+	run_step (Step_INV_COLUMNS, 0, x, ws, _len_1);
+}
+
+
+
+template <class DT>
+void	FFTRealLarge <DT>::rescale (DataType x []) const
+{
+	assert (x != 0);
+
+	const DataType	mul = DataType (1.0 / _length);
+	for (long i = 0; i < _length; ++i)
+	{
+		x [i] *= mul;
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <class DT>
+void	FFTRealLarge <DT>::StepTask::process (int part, int thread)
+{
+	const long		beg = part * _part_len;
+	const long		end = std::min (beg + _part_len, _nbr_pos);
+	_obj_ptr->run_part (_step, _src_ptr, _dst_ptr, _ws_ptr, beg, end, thread);
+}
+
+
+
+// Largest power of 2 whose square is not above the length
+template <class DT>
+long	FFTRealLarge <DT>::compute_len_1 (long length)
+{
+	long				len_1 = 1;
+	while (len_1 * len_1 * 4 <= length)
+	{
+		len_1 *= 2;
+	}
+
+	return (len_1);
+}
+
+
+
+// Columns [n1_beg ; n1_end[, step 1. Row k2 of the matrix holds the real
+// parts then the imaginary parts of bin k2 of all the columns. The columns
+// of a block share the same cache lines of the matrix.
+template <class DT>
+void	FFTRealLarge <DT>::fwd_columns (const DataType x [], DataType mat_ptr [], DataType loc_ptr [], long n1_beg, long n1_end) const
+{
+	const long		half_2 = _len_2 >> 1;
+	DataType * const	col_ptr = loc_ptr;
+	DataType * const	spec_ptr = col_ptr + BLOCK_LEN * _col_stride;
+	DataType * const	fft_ws_ptr = spec_ptr + _len_2;
+
+	for (long blk_beg = n1_beg; blk_beg < n1_end; blk_beg += BLOCK_LEN)
+	{
+		const long	blk_len = std::min (long (BLOCK_LEN), n1_end - blk_beg);
+
+		// Transposes the block, reading the input by rows
+		for (long n2 = 0; n2 < _len_2; ++n2)
+		{
+			const DataType * const	src_ptr = x + blk_beg + n2 * _len_1;
+			for (long b = 0; b < blk_len; ++b)
+			{
+				col_ptr [b * _col_stride + n2] = src_ptr [b];
+			}
+		}
+
+		for (long b = 0; b < blk_len; ++b)
+		{
+			_fft_2.do_fft (spec_ptr, col_ptr + b * _col_stride, fft_ws_ptr);
+
+			// Bins 0 and N2/2 are real
+			DataType * const	dst_ptr = mat_ptr + blk_beg + b;
+			dst_ptr [0      ] = spec_ptr [0];
+			dst_ptr [_len_1] = 0;
+			for (long k2 = 1; k2 < half_2; ++k2)
+			{
+				DataType * const	cell_ptr = dst_ptr + k2 * _row_stride;
+				cell_ptr [0      ] = spec_ptr [         k2];
+				cell_ptr [_len_1] = spec_ptr [half_2 + k2];
+			}
+			DataType * const	last_ptr = dst_ptr + half_2 * _row_stride;
+			last_ptr [0      ] = spec_ptr [half_2];
+			last_ptr [_len_1] = 0;
+		}
+	}
+}
+
+
+
+// Rows [k2_beg ; k2_end[, steps 2 and 3. The complex FFT of a row is made of the
+// real FFTs of its real and imaginary parts, a and b:
+// Z [k] = A [k] + i * B [k], Z [N1 - k] = conj (A [k]) + i * conj (B [k])
+// Bin k2 + N2 * k1 goes to the output if it is in the first half of the
+// spectrum, else its conjugate goes to bin N - k2 - N2 * k1. The output is
+// written by blocks of rows, so the writes are consecutive.
+template <class DT>
+void	FFTRealLarge <DT>::fwd_rows (DataType f [], DataType mat_ptr [], DataType loc_ptr [], long k2_beg, long k2_end) const
+{
+	const long		half = _length >> 1;
+	const long		half_1 = _len_1 >> 1;
+	const long		half_2 = _len_2 >> 1;
+	const long		row_len = _row_stride;
+	DataType * const	z_ptr = loc_ptr;
+	DataType * const	fa_ptr = z_ptr + BLOCK_LEN * row_len;
+	DataType * const	fb_ptr = fa_ptr + _len_1;
+	DataType * const	fft_ws_ptr = fb_ptr + _len_1;
+
+	for (long blk_beg = k2_beg; blk_beg < k2_end; blk_beg += BLOCK_LEN)
+	{
+		const long	blk_len = std::min (long (BLOCK_LEN), k2_end - blk_beg);
+
+		for (long b = 0; b < blk_len; ++b)
+		{
+			const long	k2 = blk_beg + b;
+			DataType * const	row_ptr = mat_ptr + k2 * row_len;
+			DataType * const	zr_ptr = z_ptr + b * row_len;
+			DataType * const	zi_ptr = zr_ptr + _len_1;
+
+			// Row 0 has no twiddle
+			if (k2 > 0)
+			{
+				rotate_row (row_ptr, k2, 1);
+			}
+
+			_fft_1.do_fft (fa_ptr, row_ptr, fft_ws_ptr);
+			if (k2 == 0)
+			{
+				// Real row, only the first half is used
+				zr_ptr [0] = fa_ptr [0];
+				zi_ptr [0] = 0;
+				for (long k = 1; k < half_1; ++k)
+				{
+					zr_ptr [k] = fa_ptr [k];
+					zi_ptr [k] = fa_ptr [half_1 + k];
+				}
+				zr_ptr [half_1] = fa_ptr [half_1];
+			}
+			else
+			{
+				_fft_1.do_fft (fb_ptr, row_ptr + _len_1, fft_ws_ptr);
+				zr_ptr [0] = fa_ptr [0];
+				zi_ptr [0] = fb_ptr [0];
+				for (long k = 1; k < half_1; ++k)
+				{
+					const DataType	ar = fa_ptr [k];
+					const DataType	ai = fa_ptr [half_1 + k];
+					const DataType	br = fb_ptr [k];
+					const DataType	bi = fb_ptr [half_1 + k];
+					zr_ptr [k          ] = ar - bi;
+					zi_ptr [k          ] = ai + br;
+					zr_ptr [_len_1 - k] = ar + bi;
+					zi_ptr [_len_1 - k] = br - ai;
+				}
+				zr_ptr [half_1] = fa_ptr [half_1];
+				zi_ptr [half_1] = fb_ptr [half_1];
+			}
+		}
+
+		// First half of the spectrum, k1 < N1/2
+		for (long k1 = 0; k1 < half_1; ++k1)
+		{
+			DataType * const	re_ptr = f + blk_beg + k1 * _len_2;
+			DataType * const	im_ptr = re_ptr + half;
+			for (long b = 0; b < blk_len; ++b)
+			{
+				re_ptr [b] = z_ptr [b * row_len          + k1];
+				im_ptr [b] = z_ptr [b * row_len + _len_1 + k1];
+			}
+		}
+
+		// Bin 0 has no imaginary part, f [half] is the last bin. Row 0 is
+		// real, so its first half gives the whole row.
+		if (blk_beg == 0)
+		{
+			f [half] = z_ptr [half_1];
+		}
+
+		// Conjugates of the second half of the rows. Rows N2/2 gives the
+		// same bins as its first half.
+		const long		b_beg = (blk_beg == 0) ? 1 : 0;
+		const long		b_end = std::min (blk_len, half_2 - blk_beg);
+		for (long k1 = half_1; k1 < _len_1; ++k1)
+		{
+			DataType * const	re_ptr = f + _length - blk_beg - k1 * _len_2;
+			DataType * const	im_ptr = re_ptr + half;
+			for (long b = b_beg; b < b_end; ++b)
+			{
+				re_ptr [-b] =  z_ptr [b * row_len          + k1];
+				im_ptr [-b] = -z_ptr [b * row_len + _len_1 + k1];
+			}
+		}
+	}
+}
+
+
+
+// Rows [k2_beg ; k2_end[, inverse of steps 3 and 2. The real and
+// imaginary parts of the inverse FFT of a row Z are the inverse real FFTs
+// of its hermitian and anti-hermitian parts:
+// A [k] = (Z [k] + conj (Z [N1 - k])) / 2
+// B [k] = (Z [k] - conj (Z [N1 - k])) / (2 * i)
+template <class DT>
+void	FFTRealLarge <DT>::inv_rows (const DataType f [], DataType mat_ptr [], DataType loc_ptr [], long k2_beg, long k2_end) const
+{
+	const long		half = _length >> 1;
+	const long		half_1 = _len_1 >> 1;
+	const long		half_2 = _len_2 >> 1;
+	const long		row_len = _row_stride;
+	DataType * const	z_ptr = loc_ptr;
+	DataType * const	fa_ptr = z_ptr + BLOCK_LEN * row_len;
+	DataType * const	fb_ptr = fa_ptr + _len_1;
+	DataType * const	fft_ws_ptr = fb_ptr + _len_1;
+	const DataType	mul = DataType (0.5);
+
+	for (long blk_beg = k2_beg; blk_beg < k2_end; blk_beg += BLOCK_LEN)
+	{
+		const long	blk_len = std::min (long (BLOCK_LEN), k2_end - blk_beg);
+
+		// Gathers the rows of the block, same bin order as fwd_rows()
+		for (long k1 = 0; k1 < half_1; ++k1)
+		{
+			const DataType * const	re_ptr = f + blk_beg + k1 * _len_2;
+			const DataType * const	im_ptr = re_ptr + half;
+			for (long b = 0; b < blk_len; ++b)
+			{
+				z_ptr [b * row_len          + k1] = re_ptr [b];
+				z_ptr [b * row_len + _len_1 + k1] = im_ptr [b];
+			}
+		}
+		if (blk_beg == 0)
+		{
+			z_ptr [_len_1] = 0;
+			z_ptr [half_1] = f [half];
+		}
+
+		// Row N2/2 is read twice here, its second half is needed.
+		const long		b_beg = (blk_beg == 0) ? 1 : 0;
+		const long		b_end = std::min (blk_len, half_2 + 1 - blk_beg);
+		for (long k1 = half_1; k1 < _len_1; ++k1)
+		{
+			const DataType * const	re_ptr = f + _length - blk_beg - k1 * _len_2;
+			const DataType * const	im_ptr = re_ptr + half;
+			for (long b = b_beg; b < b_end; ++b)
+			{
+				z_ptr [b * row_len          + k1] =  re_ptr [-b];
+				z_ptr [b * row_len + _len_1 + k1] = -im_ptr [-b];
+			}
+		}
+
+		for (long b = 0; b < blk_len; ++b)
+		{
+			const long	k2 = blk_beg + b;
+			DataType * const	row_ptr = mat_ptr + k2 * row_len;
+			const DataType * const	zr_ptr = z_ptr + b * row_len;
+			const DataType * const	zi_ptr = zr_ptr + _len_1;
+
+			fa_ptr [0     ] = zr_ptr [0];
+			fa_ptr [half_1] = zr_ptr [half_1];
+			if (k2 == 0)
+			{
+				// Hermitian row, the output is real and needs no twiddle.
+				for (long k = 1; k < half_1; ++k)
+				{
+					fa_ptr [k         ] = zr_ptr [k];
+					fa_ptr [half_1 + k] = zi_ptr [k];
+				}
+				_fft_1.do_ifft (fa_ptr, row_ptr, fft_ws_ptr);
+				for (long n1 = 0; n1 < _len_1; ++n1)
+				{
+					row_ptr [_len_1 + n1] = 0;
+				}
+			}
+			else
+			{
+				fb_ptr [0     ] = zi_ptr [0];
+				fb_ptr [half_1] = zi_ptr [half_1];
+				for (long k = 1; k < half_1; ++k)
+				{
+					const DataType	zr_p = zr_ptr [k];
+					const DataType	zi_p = zi_ptr [k];
+					const DataType	zr_n = zr_ptr [_len_1 - k];
+					const DataType	zi_n = zi_ptr [_len_1 - k];
+					fa_ptr [k         ] = (zr_p + zr_n) * mul;
+					fa_ptr [half_1 + k] = (zi_p - zi_n) * mul;
+					fb_ptr [k         ] = (zi_p + zi_n) * mul;
+					fb_ptr [half_1 + k] = (zr_n - zr_p) * mul;
+				}
+				_fft_1.do_ifft (fa_ptr, row_ptr, fft_ws_ptr);
+				_fft_1.do_ifft (fb_ptr, row_ptr + _len_1, fft_ws_ptr);
+
+				rotate_row (row_ptr, k2, -1);
+			}
+		}
+	}
+}
+
+
+
+// Columns [n1_beg ; n1_end[, inverse of step 1
+template <class DT>
+void	FFTRealLarge <DT>::inv_columns (DataType x [], DataType mat_ptr [], DataType loc_ptr [], long n1_beg, long n1_end) const
+{
+	const long		half_2 = _len_2 >> 1;
+	DataType * const	col_ptr = loc_ptr;
+	DataType * const	spec_ptr = col_ptr + BLOCK_LEN * _col_stride;
+	DataType * const	fft_ws_ptr = spec_ptr + _len_2;
+
+	for (long blk_beg = n1_beg; blk_beg < n1_end; blk_beg += BLOCK_LEN)
+	{
+		const long	blk_len = std::min (long (BLOCK_LEN), n1_end - blk_beg);
+
+		// Transposes the spectra of the block, reading the matrix by rows
+		const DataType * const	src_ptr = mat_ptr + blk_beg;
+		for (long b = 0; b < blk_len; ++b)
+		{
+			col_ptr [b * _col_stride] = src_ptr [b];
+		}
+		for (long k2 = 1; k2 < half_2; ++k2)
+		{
+			const DataType * const	cell_ptr = src_ptr + k2 * _row_stride;
+			for (long b = 0; b < blk_len; ++b)
+			{
+				col_ptr [b * _col_stride          + k2] = cell_ptr [         b];
+				col_ptr [b * _col_stride + half_2 + k2] = cell_ptr [_len_1 + b];
+			}
+		}
+		const DataType * const	last_ptr = src_ptr + half_2 * _row_stride;
+		for (long b = 0; b < blk_len; ++b)
+		{
+			col_ptr [b * _col_stride + half_2] = last_ptr [b];
+		}
+
+		// A column replaces its spectrum
+		for (long b = 0; b < blk_len; ++b)
+		{
+			DataType * const	c_ptr = col_ptr + b * _col_stride;
+			_fft_2.do_ifft (c_ptr, spec_ptr, fft_ws_ptr);
+			for (long n2 = 0; n2 < _len_2; ++n2)
+			{
+				c_ptr [n2] = spec_ptr [n2];
+			}
+		}
+
+		// Transposes the block back, writing the output by rows
+		for (long n2 = 0; n2 < _len_2; ++n2)
+		{
+			DataType * const	dst_ptr = x + blk_beg + n2 * _len_1;
+			for (long b = 0; b < blk_len; ++b)
+			{
+				dst_ptr [b] = col_ptr [b * _col_stride + n2];
+			}
+		}
+	}
+}
+
+
+
+// Multiplies row k2 by exp (dir * 2*PI*i * k2*n1 / length), dir = +/-1.
+// n1 = j * BLOCK_LEN + l: the twiddle of j comes from get_twiddle(), the
+// twiddles of l from the table of the row, so the inner loop can be
+// vectorized.
+template <class DT>
+void	FFTRealLarge <DT>::rotate_row (DataType row_ptr [], long k2, DataType dir) const
+{
+	assert (k2 > 0);
+	assert (k2 < _nbr_rows);
+
+	const DataType * const	lc_ptr =
+		&_trigo_lut [(_len_1 + _nbr_rows + k2 * BLOCK_LEN) * 2];
+	const DataType * const	ls_ptr = lc_ptr + BLOCK_LEN;
+	const long		nbr_l = std::min (long (BLOCK_LEN), _len_1);
+	const long		step_lo = (k2 * BLOCK_LEN) % _len_1;
+	const long		step_hi = (k2 * BLOCK_LEN) / _len_1;
+	long				lo = 0;
+	long				hi = 0;
+	for (long n1_beg = 0; n1_beg < _len_1; n1_beg += BLOCK_LEN)
+	{
+		DataType			bc;
+		DataType			bs;
+		get_twiddle (bc, bs, lo, hi);
+		lo += step_lo;
+		hi += step_hi;
+		if (lo >= _len_1)
+		{
+			lo -= _len_1;
+			++ hi;
+		}
+
+		DataType * const	re_ptr = row_ptr + n1_beg;
+		DataType * const	im_ptr = re_ptr + _len_1;
+		for (long l = 0; l < nbr_l; ++l)
+		{
+			const DataType	c = bc * lc_ptr [l] - bs * ls_ptr [l];
+			const DataType	s = (bs * lc_ptr [l] + bc * ls_ptr [l]) * dir;
+			const DataType	re = re_ptr [l];
+			const DataType	im = im_ptr [l];
+			re_ptr [l] = re * c - im * s;
+			im_ptr [l] = re * s + im * c;
+		}
+	}
+}
+
+
+
+// exp (2*PI*i * (hi*N1 + lo) / length)
+template <class DT>
+void	FFTRealLarge <DT>::get_twiddle (DataType &c, DataType &s, long lo, long hi) const
+{
+	assert (lo >= 0);
+	assert (lo < _len_1);
+	assert (hi >= 0);
+	assert (hi < _nbr_rows);
+
+	const DataType * const	fine_ptr = &_trigo_lut [lo * 2];
+	const DataType * const	coarse_ptr = &_trigo_lut [(_len_1 + hi) * 2];
+	c = coarse_ptr [0] * fine_ptr [0] - coarse_ptr [1] * fine_ptr [1];
+	s = coarse_ptr [1] * fine_ptr [0] + coarse_ptr [0] * fine_ptr [1];
+}
+
+
+
+// Threads sharing the transforms, 1 without pool or for short lengths
+template <class DT>
+int	FFTRealLarge <DT>::get_nbr_threads () const
+{
+	if (_pool_ptr == 0 || _length < (1L << PAR_LEN_L2))
+	{
+		return (1);
+	}
+
+	return (_pool_ptr->get_nbr_threads ());
+}
+
+
+
+// Runs a step over the positions [0 ; nbr_pos[, columns or rows. The parts
+// are made of whole blocks so two threads never write the same cache line
+// of the matrix.
+template <class DT>
+void	FFTRealLarge <DT>::run_step (Step step, const DataType src_ptr [], DataType dst_ptr [], DataType ws [], long nbr_pos) const
+{
+	const int		nbr_threads = get_nbr_threads ();
+	if (nbr_threads == 1)
+	{
+		run_part (step, src_ptr, dst_ptr, ws, 0, nbr_pos, 0);
+	}
+
+	else
+	{
+		const long		nbr_blocks = (nbr_pos + BLOCK_LEN - 1) / BLOCK_LEN;
+		const long		blk_per_part = std::max (
+			nbr_blocks / (nbr_threads * PARTS_PER_THREAD),
+			1L
+		);
+
+		StepTask			task;
+		task._obj_ptr = this;
+		task._step = step;
+		task._src_ptr = src_ptr;
+		task._dst_ptr = dst_ptr;
+		task._ws_ptr = ws;
+		task._part_len = blk_per_part * BLOCK_LEN;
+		task._nbr_pos = nbr_pos;
+
+		const long		nbr_parts = (nbr_pos + task._part_len - 1) / task._part_len;
+		_pool_ptr->run (task, int (nbr_parts));
+	}
+}
+
+
+
+// Positions [beg ; end[ of a step, with the local workspace of the thread
+template <class DT>
+void	FFTRealLarge <DT>::run_part (Step step, const DataType src_ptr [], DataType dst_ptr [], DataType ws [], long beg, long end, int thread) const
+{
+	DataType * const	loc_ptr = ws + _nbr_rows * _row_stride + thread * _local_len;
+
+	switch (step)
+	{
+	case Step_FWD_COLUMNS:
+		fwd_columns (src_ptr, ws, loc_ptr, beg, end);
+		break;
+	case Step_FWD_ROWS:
+		fwd_rows (dst_ptr, ws, loc_ptr, beg, end);
+		break;
+	case Step_INV_ROWS:
+		inv_rows (src_ptr, ws, loc_ptr, beg, end);
+		break;
+	case Step_INV_COLUMNS:
+		inv_columns (dst_ptr, ws, loc_ptr, beg, end);
+		break;
+	default:
+		assert (false);
+		break;
+	}
+}
+
+
+
+template <class DT>
+typename FFTRealLarge <DT>::DataType *	FFTRealLarge <DT>::use_buffer () const
+{
+	// Grows when a thread pool has been set since the last call
+	if (_buffer.size () < get_workspace_len ())
+	{
+		_buffer.resize (get_workspace_len ());
+	}
+
+	return (&_buffer [0]);
+}
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_FFTRealLarge_CODEHEADER_INCLUDED
+
+#undef ffft_FFTRealLarge_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -27,8 +27,12 @@ http://sam.zoy.org/wtfpl/COPYING for more details.
 
 /*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
+#include	"ffft/FFTRealPower.h"
+#include	"ffft/FFTRealSimd.h"
 #include	"ffft/FFTRealUseTrigo.h"
 
+#include	<cassert>
+
 
 
 namespace ffft
@@ -40,14 +44,20 @@ namespace ffft
 
 
 
-template <>
-inline void	FFTRealPassDirect <1>::process (long len, DataType dest_ptr [], DataType src_ptr [], const DataType x_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
+// First and second pass at once
+template <class DT>
+void	FFTRealPassDirect <1, DT>::process (long len, DataType dest_ptr [], DataType src_ptr [], const DataType x_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
 {
-    (void) src_ptr;
-    (void) cos_ptr;
-    (void) cos_len;
-    (void) osc_list;
-	// First and second pass at once
+	(void) src_ptr;
+	(void) cos_ptr;
+	(void) cos_len;
+	(void) osc_list;
+
+	if (FFTRealSimd <DataType>::direct_pass_1_2 (FFTRealSimd <DataType>::get_level (), dest_ptr, x_ptr, br_ptr, 1, len))
+	{
+		return;
+	}
+
 	const long		qlen = len >> 2;
 
 	long				coef_index = 0;
@@ -74,11 +84,11 @@ inline void	FFTRealPassDirect <1>::process (long len, DataType dest_ptr [], Data
 	while (coef_index < len);
 }
 
-template <>
-inline void	FFTRealPassDirect <2>::process (long len, DataType dest_ptr [], DataType src_ptr [], const DataType x_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
+template <class DT>
+void	FFTRealPassDirect <2, DT>::process (long len, DataType dest_ptr [], DataType src_ptr [], const DataType x_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
 {
 	// Executes "previous" passes first. Inverts source and destination buffers
-	FFTRealPassDirect <1>::process (
+	FFTRealPassDirect <1, DT>::process (
 		len,
 		src_ptr,
 		dest_ptr,
@@ -90,6 +100,11 @@ inline void	FFTRealPassDirect <2>::process (long len, DataType dest_ptr [], Data
 	);
 
 	// Third pass
+	if (FFTRealSimd <DataType>::direct_pass_3 (FFTRealSimd <DataType>::get_level (), dest_ptr, src_ptr, len))
+	{
+		return;
+	}
+
 	const DataType	sqrt2_2 = DataType (SQRT2 * 0.5);
 
 	long				coef_index = 0;
@@ -115,11 +130,24 @@ inline void	FFTRealPassDirect <2>::process (long len, DataType dest_ptr [], Data
 	while (coef_index < len);
 }
 
-template <int PASS>
-void	FFTRealPassDirect <PASS>::process (long len, DataType dest_ptr [], DataType src_ptr [], const DataType x_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
+// Too short for a sweep of two passes
+template <class DT>
+void	FFTRealPassDirect <2, DT>::process_power (long len, DataType out [], DataType src_ptr [], const DataType x_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [], DataType exponent)
+{
+	process (len, out, src_ptr, x_ptr, cos_ptr, cos_len, br_ptr, osc_list);
+	FFTRealPower <DT>::compute (out, out, len, exponent);
+}
+
+// Two passes per sweep (radix 4), except the third one, which is too short
+// for the vector code (8 coefficients), and the fourth one when the number
+// of passes left is odd.
+template <int PASS, class DT>
+void	FFTRealPassDirect <PASS, DT>::process (long len, DataType dest_ptr [], DataType src_ptr [], const DataType x_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
 {
+	enum {	STEP = (PASS >= 5) ? 2 : 1	};
+
 	// Executes "previous" passes first. Inverts source and destination buffers
-	FFTRealPassDirect <PASS - 1>::process (
+	FFTRealPassDirect <PASS - STEP, DT>::process (
 		len,
 		src_ptr,
 		dest_ptr,
@@ -130,17 +158,82 @@ void	FFTRealPassDirect <PASS>::process (long len, DataType dest_ptr [], DataType
 		osc_list
 	);
 
+	if (STEP == 2)
+	{
+		process_internal_n2 (len, dest_ptr, src_ptr, cos_ptr, cos_len, osc_list, 0);
+	}
+	else
+	{
+		process_internal (len, dest_ptr, src_ptr, cos_ptr, cos_len, osc_list);
+	}
+}
+
+
+
+// Same as process(), giving the power of the bins raised to the exponent,
+// see FFTRealPower. A last sweep of two passes computes it directly
+// instead of storing the spectrum.
+template <int PASS, class DT>
+void	FFTRealPassDirect <PASS, DT>::process_power (long len, DataType out [], DataType src_ptr [], const DataType x_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [], DataType exponent)
+{
+	assert (exponent > 0);
+
+	enum {	STEP = (PASS >= 5) ? 2 : 1	};
+
+	if (STEP == 2)
+	{
+		FFTRealPassDirect <PASS - STEP, DT>::process (
+			len,
+			src_ptr,
+			out,
+			x_ptr,
+			cos_ptr,
+			cos_len,
+			br_ptr,
+			osc_list
+		);
+		process_internal_n2 (len, out, src_ptr, cos_ptr, cos_len, osc_list, exponent);
+	}
+	else
+	{
+		process (len, out, src_ptr, x_ptr, cos_ptr, cos_len, br_ptr, osc_list);
+		FFTRealPower <DT>::compute (out, out, len, exponent);
+	}
+}
+
+
+
+template <int PASS, class DT>
+void	FFTRealPassDirect <PASS, DT>::process_internal (long len, DataType dest_ptr [], const DataType src_ptr [], const DataType cos_ptr [], long cos_len, OscType osc_list [])
+{
 	const long		dist = 1L << (PASS - 1);
 	const long		c1_r = 0;
 	const long		c1_i = dist;
 	const long		c2_r = dist * 2;
 	const long		c2_i = dist * 3;
 	const long		cend = dist * 4;
-	const long		table_step = cos_len >> (PASS - 1);
 
    enum {	TRIGO_OSC		= PASS - FFTRealFixLenParam::TRIGO_BD_LIMIT	};
 	enum {	TRIGO_DIRECT	= (TRIGO_OSC >= 0) ? 1 : 0	};
 
+	// Table of this pass, see FFTRealFixLen::build_trigo_lut()
+	const long		table_pos = (TRIGO_DIRECT == 0) ? dist - 4 : 0;
+	const DataType	* const	pass_cos_ptr = cos_ptr + table_pos;
+	assert (TRIGO_DIRECT != 0 || table_pos + dist <= cos_len);
+	(void) cos_len;
+
+	if (FFTRealUseTrigo <TRIGO_DIRECT, DT>::direct_pass_simd (
+		dest_ptr,
+		src_ptr,
+		dist * 2,
+		len,
+		pass_cos_ptr,
+		osc_list [TRIGO_OSC]
+	))
+	{
+		return;
+	}
+
 	long				coef_index = 0;
 	do
 	{
@@ -153,20 +246,20 @@ void	FFTRealPassDirect <PASS>::process (long len, DataType dest_ptr [], DataType
 		df [c1_i] = sf [c1_i];
 		df [c2_i] = sf [c2_i];
 
-		FFTRealUseTrigo <TRIGO_DIRECT>::prepare (osc_list [TRIGO_OSC]);
+		FFTRealUseTrigo <TRIGO_DIRECT, DT>::prepare (osc_list [TRIGO_OSC]);
 
 		// Others are conjugate complex numbers
 		for (long i = 1; i < dist; ++ i)
 		{
 			DataType			c;
 			DataType			s;
-			FFTRealUseTrigo <TRIGO_DIRECT>::iterate (
+			FFTRealUseTrigo <TRIGO_DIRECT, DT>::iterate (
 				osc_list [TRIGO_OSC],
 				c,
 				s,
-				cos_ptr,
-				i * table_step,
-				(dist - i) * table_step
+				pass_cos_ptr,
+				i,
+				dist - i
 			);
 
 			const DataType	sf_r_i = sf [c1_r + i];
@@ -188,6 +281,59 @@ void	FFTRealPassDirect <PASS>::process (long len, DataType dest_ptr [], DataType
 
 
 
+// Passes PASS - 1 and PASS, see FFTRealRadix4. With an exponent > 0, they
+// are the last ones and give the power of the bins, see process_power().
+template <int PASS, class DT>
+void	FFTRealPassDirect <PASS, DT>::process_internal_n2 (long len, DataType dest_ptr [], const DataType src_ptr [], const DataType cos_ptr [], long cos_len, OscType osc_list [], DataType exponent)
+{
+	// Only called for PASS >= 5, but compiled for all
+	enum {	DIST_L2	= (PASS >= 2) ? PASS - 2 : 0	};
+	const long		dist = 1L << DIST_L2;
+
+	// Trigonometric method of the first pass
+	enum {	TRIGO_OSC		= PASS - 1 - FFTRealFixLenParam::TRIGO_BD_LIMIT	};
+	enum {	TRIGO_DIRECT	= (TRIGO_OSC >= 0) ? 1 : 0	};
+
+	// Tables of both passes, see FFTRealFixLen::build_trigo_lut()
+	const long		table_pos_1 = (TRIGO_DIRECT == 0) ? dist - 4 : 0;
+	const long		table_pos_2 = (TRIGO_DIRECT == 0) ? dist * 2 - 4 : 0;
+	const DataType	* const	cos1_ptr = cos_ptr + table_pos_1;
+	const DataType	* const	cos2_ptr = cos_ptr + table_pos_2;
+	assert (TRIGO_DIRECT != 0 || table_pos_2 + dist * 2 <= cos_len);
+	(void) cos_len;
+
+	if (exponent > 0)
+	{
+		assert (dist * 8 == len);
+
+		FFTRealUseTrigo <TRIGO_DIRECT, DT>::power_pass_n2 (
+			dest_ptr,
+			src_ptr,
+			dist * 2,
+			cos1_ptr,
+			cos2_ptr,
+			osc_list [TRIGO_OSC],
+			osc_list [TRIGO_OSC + 1],
+			exponent
+		);
+	}
+	else
+	{
+		FFTRealUseTrigo <TRIGO_DIRECT, DT>::direct_pass_n2 (
+			dest_ptr,
+			src_ptr,
+			dist * 2,
+			len,
+			cos1_ptr,
+			cos2_ptr,
+			osc_list [TRIGO_OSC],
+			osc_list [TRIGO_OSC + 1]
+		);
+	}
+}
+
+
+
 /*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
 
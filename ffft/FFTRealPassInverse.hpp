@@ -27,8 +27,11 @@ http://sam.zoy.org/wtfpl/COPYING for more details.
 
 /*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
+#include	"ffft/FFTRealSimd.h"
 #include	"ffft/FFTRealUseTrigo.h"
 
+#include	<cassert>
+
 
 
 namespace ffft
@@ -40,19 +43,38 @@ namespace ffft
 
 
 
-template <int PASS>
-void	FFTRealPassInverse <PASS>::process (long len, DataType dest_ptr [], DataType src_ptr [], const DataType f_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
+// Two passes per sweep (radix 4), except the third one, which is too short
+// for the vector code (8 coefficients), and the fourth one when the number
+// of passes left is odd.
+template <int PASS, class DT>
+void	FFTRealPassInverse <PASS, DT>::process (long len, DataType dest_ptr [], DataType src_ptr [], const DataType f_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
 {
-	process_internal (
-		len,
-		dest_ptr,
-		f_ptr,
-		cos_ptr,
-		cos_len,
-		br_ptr,
-		osc_list
-	);
-	FFTRealPassInverse <PASS - 1>::process_rec (
+	enum {	STEP = (PASS >= 5) ? 2 : 1	};
+
+	if (STEP == 2)
+	{
+		process_internal_n2 (
+			len,
+			dest_ptr,
+			f_ptr,
+			cos_ptr,
+			cos_len,
+			osc_list
+		);
+	}
+	else
+	{
+		process_internal (
+			len,
+			dest_ptr,
+			f_ptr,
+			cos_ptr,
+			cos_len,
+			br_ptr,
+			osc_list
+		);
+	}
+	FFTRealPassInverse <PASS - STEP, DT>::process_rec (
 		len,
 		src_ptr,
 		dest_ptr,
@@ -65,19 +87,35 @@ void	FFTRealPassInverse <PASS>::process (long len, DataType dest_ptr [], DataTyp
 
 
 
-template <int PASS>
-void	FFTRealPassInverse <PASS>::process_rec (long len, DataType dest_ptr [], DataType src_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
+template <int PASS, class DT>
+void	FFTRealPassInverse <PASS, DT>::process_rec (long len, DataType dest_ptr [], DataType src_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
 {
-	process_internal (
-		len,
-		dest_ptr,
-		src_ptr,
-		cos_ptr,
-		cos_len,
-		br_ptr,
-		osc_list
-	);
-	FFTRealPassInverse <PASS - 1>::process_rec (
+	enum {	STEP = (PASS >= 5) ? 2 : 1	};
+
+	if (STEP == 2)
+	{
+		process_internal_n2 (
+			len,
+			dest_ptr,
+			src_ptr,
+			cos_ptr,
+			cos_len,
+			osc_list
+		);
+	}
+	else
+	{
+		process_internal (
+			len,
+			dest_ptr,
+			src_ptr,
+			cos_ptr,
+			cos_len,
+			br_ptr,
+			osc_list
+		);
+	}
+	FFTRealPassInverse <PASS - STEP, DT>::process_rec (
 		len,
 		src_ptr,
 		dest_ptr,
@@ -88,23 +126,10 @@ void	FFTRealPassInverse <PASS>::process_rec (long len, DataType dest_ptr [], Dat
 	);
 }
 
-template <>
-inline void	FFTRealPassInverse <0>::process_rec (long len, DataType dest_ptr [], DataType src_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
-{
-	// Stops recursion
-    (void) len;
-    (void) dest_ptr;
-    (void) src_ptr;
-    (void) cos_ptr;
-    (void) cos_len;
-    (void) br_ptr;
-    (void) osc_list;
-}
-
 
 
-template <int PASS>
-void	FFTRealPassInverse <PASS>::process_internal (long len, DataType dest_ptr [], const DataType src_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
+template <int PASS, class DT>
+void	FFTRealPassInverse <PASS, DT>::process_internal (long len, DataType dest_ptr [], const DataType src_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
 {
 	const long		dist = 1L << (PASS - 1);
 	const long		c1_r = 0;
@@ -112,11 +137,28 @@ void	FFTRealPassInverse <PASS>::process_internal (long len, DataType dest_ptr []
 	const long		c2_r = dist * 2;
 	const long		c2_i = dist * 3;
 	const long		cend = dist * 4;
-	const long		table_step = cos_len >> (PASS - 1);
 
    enum {	TRIGO_OSC		= PASS - FFTRealFixLenParam::TRIGO_BD_LIMIT	};
 	enum {	TRIGO_DIRECT	= (TRIGO_OSC >= 0) ? 1 : 0	};
 
+	// Table of this pass, see FFTRealFixLen::build_trigo_lut()
+	const long		table_pos = (TRIGO_DIRECT == 0) ? dist - 4 : 0;
+	const DataType	* const	pass_cos_ptr = cos_ptr + table_pos;
+	assert (TRIGO_DIRECT != 0 || table_pos + dist <= cos_len);
+	(void) cos_len;
+
+	if (FFTRealUseTrigo <TRIGO_DIRECT, DT>::inverse_pass_simd (
+		dest_ptr,
+		src_ptr,
+		dist * 2,
+		len,
+		pass_cos_ptr,
+		osc_list [TRIGO_OSC]
+	))
+	{
+		return;
+	}
+
 	long				coef_index = 0;
 	do
 	{
@@ -129,7 +171,7 @@ void	FFTRealPassInverse <PASS>::process_internal (long len, DataType dest_ptr []
 		df [c1_i] = sf [c1_i] * 2;
 		df [c2_i] = sf [c2_i] * 2;
 
-		FFTRealUseTrigo <TRIGO_DIRECT>::prepare (osc_list [TRIGO_OSC]);
+		FFTRealUseTrigo <TRIGO_DIRECT, DT>::prepare (osc_list [TRIGO_OSC]);
 
 		// Others are conjugate complex numbers
 		for (long i = 1; i < dist; ++ i)
@@ -139,13 +181,13 @@ void	FFTRealPassInverse <PASS>::process_internal (long len, DataType dest_ptr []
 
 			DataType			c;
 			DataType			s;
-			FFTRealUseTrigo <TRIGO_DIRECT>::iterate (
+			FFTRealUseTrigo <TRIGO_DIRECT, DT>::iterate (
 				osc_list [TRIGO_OSC],
 				c,
 				s,
-				cos_ptr,
-				i * table_step,
-				(dist - i) * table_step
+				pass_cos_ptr,
+				i,
+				dist - i
 			);
 
 			const DataType	vr = sf [c1_r + i] - sf [c2_r - i];
@@ -160,48 +202,53 @@ void	FFTRealPassInverse <PASS>::process_internal (long len, DataType dest_ptr []
 	while (coef_index < len);
 }
 
-template <>
-inline void	FFTRealPassInverse <2>::process_internal (long len, DataType dest_ptr [], const DataType src_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
+// Passes PASS and PASS - 1, see FFTRealRadix4
+template <int PASS, class DT>
+void	FFTRealPassInverse <PASS, DT>::process_internal_n2 (long len, DataType dest_ptr [], const DataType src_ptr [], const DataType cos_ptr [], long cos_len, OscType osc_list [])
 {
-    (void) len;
-    (void) dest_ptr;
-    (void) src_ptr;
-    (void) cos_ptr;
-    (void) cos_len;
-    (void) br_ptr;
-    (void) osc_list;
-	// Antepenultimate pass
-	const DataType	sqrt2_2 = DataType (SQRT2 * 0.5);
+	// Only called for PASS >= 5, but compiled for all
+	enum {	DIST_L2	= (PASS >= 2) ? PASS - 2 : 0	};
+	const long		dist = 1L << DIST_L2;
 
-	long				coef_index = 0;
-	do
-	{
-		dest_ptr [coef_index    ] = src_ptr [coef_index] + src_ptr [coef_index + 4];
-		dest_ptr [coef_index + 4] = src_ptr [coef_index] - src_ptr [coef_index + 4];
-		dest_ptr [coef_index + 2] = src_ptr [coef_index + 2] * 2;
-		dest_ptr [coef_index + 6] = src_ptr [coef_index + 6] * 2;
+	// Trigonometric method of the pass PASS - 1
+	enum {	TRIGO_OSC		= PASS - 1 - FFTRealFixLenParam::TRIGO_BD_LIMIT	};
+	enum {	TRIGO_DIRECT	= (TRIGO_OSC >= 0) ? 1 : 0	};
 
-		dest_ptr [coef_index + 1] = src_ptr [coef_index + 1] + src_ptr [coef_index + 3];
-		dest_ptr [coef_index + 3] = src_ptr [coef_index + 5] - src_ptr [coef_index + 7];
+	// Tables of both passes, see FFTRealFixLen::build_trigo_lut()
+	const long		table_pos_1 = (TRIGO_DIRECT == 0) ? dist - 4 : 0;
+	const long		table_pos_2 = (TRIGO_DIRECT == 0) ? dist * 2 - 4 : 0;
+	const DataType	* const	cos1_ptr = cos_ptr + table_pos_1;
+	const DataType	* const	cos2_ptr = cos_ptr + table_pos_2;
+	assert (TRIGO_DIRECT != 0 || table_pos_2 + dist * 2 <= cos_len);
+	(void) cos_len;
 
-		const DataType	vr = src_ptr [coef_index + 1] - src_ptr [coef_index + 3];
-		const DataType	vi = src_ptr [coef_index + 5] + src_ptr [coef_index + 7];
+	FFTRealUseTrigo <TRIGO_DIRECT, DT>::inverse_pass_n2 (
+		dest_ptr,
+		src_ptr,
+		dist * 2,
+		len,
+		cos1_ptr,
+		cos2_ptr,
+		osc_list [TRIGO_OSC],
+		osc_list [TRIGO_OSC + 1]
+	);
+}
 
-		dest_ptr [coef_index + 5] = (vr + vi) * sqrt2_2;
-		dest_ptr [coef_index + 7] = (vi - vr) * sqrt2_2;
 
-		coef_index += 8;
-	}
-	while (coef_index < len);
-}
 
-template <>
-inline void	FFTRealPassInverse <1>::process_internal (long len, DataType dest_ptr [], const DataType src_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
+// Penultimate and last pass at once, writes the bit-reversed result
+template <class DT>
+void	FFTRealPassInverse <1, DT>::process_rec (long len, DataType dest_ptr [], DataType src_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
 {
-    (void) cos_ptr;
-    (void) cos_len;
-    (void) osc_list;
-	// Penultimate and last pass at once
+	(void) cos_ptr;
+	(void) cos_len;
+	(void) osc_list;
+
+	if (FFTRealSimd <DataType>::inverse_pass_1_2 (FFTRealSimd <DataType>::get_level (), dest_ptr, src_ptr, br_ptr, 1, len))
+	{
+		return;
+	}
+
 	const long		qlen = len >> 2;
 
 	long				coef_index = 0;
@@ -226,6 +273,75 @@ inline void	FFTRealPassInverse <1>::process_internal (long len, DataType dest_pt
 
 
 
+// Antepenultimate pass, then the last two ones
+template <class DT>
+void	FFTRealPassInverse <2, DT>::process (long len, DataType dest_ptr [], DataType src_ptr [], const DataType f_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
+{
+	process_internal (len, dest_ptr, f_ptr);
+	FFTRealPassInverse <1, DT>::process_rec (
+		len,
+		src_ptr,
+		dest_ptr,
+		cos_ptr,
+		cos_len,
+		br_ptr,
+		osc_list
+	);
+}
+
+
+
+template <class DT>
+void	FFTRealPassInverse <2, DT>::process_rec (long len, DataType dest_ptr [], DataType src_ptr [], const DataType cos_ptr [], long cos_len, const long br_ptr [], OscType osc_list [])
+{
+	process_internal (len, dest_ptr, src_ptr);
+	FFTRealPassInverse <1, DT>::process_rec (
+		len,
+		src_ptr,
+		dest_ptr,
+		cos_ptr,
+		cos_len,
+		br_ptr,
+		osc_list
+	);
+}
+
+
+
+template <class DT>
+void	FFTRealPassInverse <2, DT>::process_internal (long len, DataType dest_ptr [], const DataType src_ptr [])
+{
+	if (FFTRealSimd <DataType>::inverse_pass_3 (FFTRealSimd <DataType>::get_level (), dest_ptr, src_ptr, len))
+	{
+		return;
+	}
+
+	const DataType	sqrt2_2 = DataType (SQRT2 * 0.5);
+
+	long				coef_index = 0;
+	do
+	{
+		dest_ptr [coef_index    ] = src_ptr [coef_index] + src_ptr [coef_index + 4];
+		dest_ptr [coef_index + 4] = src_ptr [coef_index] - src_ptr [coef_index + 4];
+		dest_ptr [coef_index + 2] = src_ptr [coef_index + 2] * 2;
+		dest_ptr [coef_index + 6] = src_ptr [coef_index + 6] * 2;
+
+		dest_ptr [coef_index + 1] = src_ptr [coef_index + 1] + src_ptr [coef_index + 3];
+		dest_ptr [coef_index + 3] = src_ptr [coef_index + 5] - src_ptr [coef_index + 7];
+
+		const DataType	vr = src_ptr [coef_index + 1] - src_ptr [coef_index + 3];
+		const DataType	vi = src_ptr [coef_index + 5] + src_ptr [coef_index + 7];
+
+		dest_ptr [coef_index + 5] = (vr + vi) * sqrt2_2;
+		dest_ptr [coef_index + 7] = (vi - vr) * sqrt2_2;
+
+		coef_index += 8;
+	}
+	while (coef_index < len);
+}
+
+
+
 /*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
 
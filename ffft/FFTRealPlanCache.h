@@ -0,0 +1,143 @@
+/*****************************************************************************
+
+        FFTRealPlanCache.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_FFTRealPlanCache_HEADER_INCLUDED)
+#define	ffft_FFTRealPlanCache_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/def.h"
+#include	"ffft/FFTReal.h"
+#include	"ffft/FFTRealEven.h"
+#include	"ffft/FFTRealFixLenFactory.h"
+#include	"ffft/FFTRealSharedPlan.h"
+
+
+
+namespace ffft
+{
+
+
+
+// Process-wide registry of FFT plans, one per length and data type. Plans
+// are built on first request and never modified afterwards, they are never
+// destroyed either. Only the functions taking a workspace are reachable from
+// the returned objects, so the plans can be used by several threads at once.
+// All functions are thread-safe and lock-free. When two threads ask for a
+// missing plan at the same time, both build it and one copy is dropped.
+// The atomic operations are the MSVC or GCC intrinsics, other compilers are
+// rejected at compile time.
+template <class DT>
+class FFTRealPlanCache
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	DT	DataType;
+	typedef	FFTRealSharedPlan <FFTReal <DataType> >	PlanType;
+	typedef	FFTRealSharedPlan <FFTRealEven <DataType> >	EvenPlanType;
+
+	static const PlanType &
+							use_plan (long length);
+	static const FFTRealFixLenIface &
+							use_fixlen_plan (int len_l2);
+	static const EvenPlanType &
+							use_even_plan (long length);
+
+	static long		get_nbr_hits ();
+	static long		get_nbr_misses ();
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	enum {			NBR_SLOTS			= FFTReal <DataType>::MAX_BIT_DEPTH + 1	};
+	enum {			NBR_FIXLEN_SLOTS	= FFTRealFixLenFactory::MAX_LEN_L2 + 1	};
+
+	template <class P>
+	static P *			use_slot (P * volatile &slot_ptr);
+	template <class P>
+	static P *			publish (P * volatile &slot_ptr, P *plan_ptr);
+
+	static inline void *
+							load_ptr (void * volatile &ptr);
+	static inline void *
+							cas_ptr (void * volatile &ptr, void *new_ptr);
+	static inline void
+							increment (long volatile &val);
+	static inline long
+							load_long (long volatile &val);
+
+	// Zero-initialised before any code runs
+	static PlanType * volatile
+							_plan_arr [NBR_SLOTS];
+	static FFTRealFixLenIface * volatile
+							_fixlen_arr [NBR_FIXLEN_SLOTS];
+	static EvenPlanType * volatile
+							_even_arr [NBR_SLOTS];
+	static long volatile
+							_nbr_hits;
+	static long volatile
+							_nbr_misses;
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+							FFTRealPlanCache ();
+							~FFTRealPlanCache ();
+							FFTRealPlanCache (const FFTRealPlanCache &other);
+	FFTRealPlanCache &
+							operator = (const FFTRealPlanCache &other);
+	bool				operator == (const FFTRealPlanCache &other);
+	bool				operator != (const FFTRealPlanCache &other);
+
+};	// class FFTRealPlanCache
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/FFTRealPlanCache.hpp"
+
+
+
+#endif	// ffft_FFTRealPlanCache_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
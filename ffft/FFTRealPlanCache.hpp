@@ -0,0 +1,326 @@
+/*****************************************************************************
+
+        FFTRealPlanCache.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_FFTRealPlanCache_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealPlanCache code header.
+#endif
+#define	ffft_FFTRealPlanCache_CURRENT_CODEHEADER
+
+#if ! defined (ffft_FFTRealPlanCache_CODEHEADER_INCLUDED)
+#define	ffft_FFTRealPlanCache_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#if defined (_MSC_VER)
+    #include	<intrin.h>
+#endif
+
+#include	<cassert>
+
+
+
+namespace ffft
+{
+
+
+
+// Compile-time check for use_fixlen_plan()
+template <class A, class B>
+class FFTRealPlanCache_SameType
+{
+};
+
+template <class A>
+class FFTRealPlanCache_SameType <A, A>
+{
+public:
+	enum {			YES	= 1	};
+};
+
+
+
+template <class DT>
+typename FFTRealPlanCache <DT>::PlanType * volatile
+	FFTRealPlanCache <DT>::_plan_arr [NBR_SLOTS];
+
+template <class DT>
+FFTRealFixLenIface * volatile
+	FFTRealPlanCache <DT>::_fixlen_arr [NBR_FIXLEN_SLOTS];
+
+template <class DT>
+typename FFTRealPlanCache <DT>::EvenPlanType * volatile
+	FFTRealPlanCache <DT>::_even_arr [NBR_SLOTS];
+
+template <class DT>
+long volatile	FFTRealPlanCache <DT>::_nbr_hits = 0;
+
+template <class DT>
+long volatile	FFTRealPlanCache <DT>::_nbr_misses = 0;
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: use_plan
+Description:
+	Returns the shared FFTReal object for this length, building it if this is
+	the first request. The FFTReal functions taking a workspace are available
+	through it.
+Input parameters:
+	- length: FFT length, power of 2, > 0.
+Returns: The plan, valid until the end of the process.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <class DT>
+const typename FFTRealPlanCache <DT>::PlanType &	FFTRealPlanCache <DT>::use_plan (long length)
+{
+	assert (length > 0);
+	assert ((length & -length) == length);
+
+	int				nbr_bits = 0;
+	while ((1L << nbr_bits) < length)
+	{
+		++ nbr_bits;
+	}
+	assert (nbr_bits < NBR_SLOTS);
+
+	PlanType * volatile &	slot_ptr = _plan_arr [nbr_bits];
+	PlanType *		plan_ptr = use_slot (slot_ptr);
+	if (plan_ptr == 0)
+	{
+		plan_ptr = publish (slot_ptr, new PlanType (length));
+	}
+
+	return (*plan_ptr);
+}
+
+
+
+/*
+==============================================================================
+Name: use_fixlen_plan
+Description:
+	Same as use_plan(), for the unrolled fixed-length FFTs. Only available
+	when DT is the FFTRealFixLen data type.
+Input parameters:
+	- len_l2: base-2 logarithm of the FFT length.
+		Range: [FFTRealFixLenFactory::MIN_LEN_L2 ; MAX_LEN_L2]
+Returns: The plan, valid until the end of the process.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <class DT>
+const FFTRealFixLenIface &	FFTRealPlanCache <DT>::use_fixlen_plan (int len_l2)
+{
+	enum {			TYPE_CHECK	=
+		FFTRealPlanCache_SameType <DataType, FFTRealFixLenIface::DataType>::YES
+	};
+
+	assert (FFTRealFixLenFactory::is_supported (len_l2));
+
+	FFTRealFixLenIface * volatile &	slot_ptr = _fixlen_arr [len_l2];
+	FFTRealFixLenIface *	plan_ptr = use_slot (slot_ptr);
+	if (plan_ptr == 0)
+	{
+		plan_ptr = publish (slot_ptr, FFTRealFixLenFactory::create (len_l2));
+	}
+
+	return (*plan_ptr);
+}
+
+
+
+/*
+==============================================================================
+Name: use_even_plan
+Description:
+	Same as use_plan(), for the FFTs of even sequences.
+Input parameters:
+	- length: length of the even sequence, power of 2, 4 or more.
+Returns: The plan, valid until the end of the process.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <class DT>
+const typename FFTRealPlanCache <DT>::EvenPlanType &	FFTRealPlanCache <DT>::use_even_plan (long length)
+{
+	assert (length >= 4);
+	assert ((length & -length) == length);
+
+	int				nbr_bits = 0;
+	while ((1L << nbr_bits) < length)
+	{
+		++ nbr_bits;
+	}
+	assert (nbr_bits < NBR_SLOTS);
+
+	EvenPlanType * volatile &	slot_ptr = _even_arr [nbr_bits];
+	EvenPlanType *	plan_ptr = use_slot (slot_ptr);
+	if (plan_ptr == 0)
+	{
+		plan_ptr = publish (slot_ptr, new EvenPlanType (length));
+	}
+
+	return (*plan_ptr);
+}
+
+
+
+// Requests answered with an existing plan, all kinds together
+template <class DT>
+long	FFTRealPlanCache <DT>::get_nbr_hits ()
+{
+	return (load_long (_nbr_hits));
+}
+
+
+
+// Plans built, including copies dropped after a race
+template <class DT>
+long	FFTRealPlanCache <DT>::get_nbr_misses ()
+{
+	return (load_long (_nbr_misses));
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// Returns the stored plan and counts a hit, or 0
+template <class DT>
+template <class P>
+P *	FFTRealPlanCache <DT>::use_slot (P * volatile &slot_ptr)
+{
+	P *					plan_ptr = static_cast <P *> (
+		load_ptr (reinterpret_cast <void * volatile &> (slot_ptr))
+	);
+	if (plan_ptr != 0)
+	{
+		increment (_nbr_hits);
+	}
+
+	return (plan_ptr);
+}
+
+
+
+// Stores a freshly built plan, unless another thread was faster. Returns
+// the plan that made it into the slot.
+template <class DT>
+template <class P>
+P *	FFTRealPlanCache <DT>::publish (P * volatile &slot_ptr, P *plan_ptr)
+{
+	assert (plan_ptr != 0);
+
+	increment (_nbr_misses);
+	P *					old_ptr = static_cast <P *> (
+		cas_ptr (reinterpret_cast <void * volatile &> (slot_ptr), plan_ptr)
+	);
+	if (old_ptr != 0)
+	{
+		delete plan_ptr;
+		plan_ptr = old_ptr;
+	}
+
+	return (plan_ptr);
+}
+
+
+
+template <class DT>
+void *	FFTRealPlanCache <DT>::load_ptr (void * volatile &ptr)
+{
+#if defined (_MSC_VER)
+	return (_InterlockedCompareExchangePointer (&ptr, 0, 0));
+#elif defined (__GNUC__)
+	return (__atomic_load_n (&ptr, __ATOMIC_ACQUIRE));
+#else
+	#error No atomic operations for this compiler
+#endif
+}
+
+
+
+// Stores new_ptr if ptr is 0. Returns the previous value.
+template <class DT>
+void *	FFTRealPlanCache <DT>::cas_ptr (void * volatile &ptr, void *new_ptr)
+{
+#if defined (_MSC_VER)
+	return (_InterlockedCompareExchangePointer (&ptr, new_ptr, 0));
+#elif defined (__GNUC__)
+	return (__sync_val_compare_and_swap (&ptr, static_cast <void *> (0), new_ptr));
+#else
+	#error No atomic operations for this compiler
+#endif
+}
+
+
+
+template <class DT>
+void	FFTRealPlanCache <DT>::increment (long volatile &val)
+{
+#if defined (_MSC_VER)
+	_InterlockedIncrement (&val);
+#elif defined (__GNUC__)
+	__sync_fetch_and_add (&val, 1L);
+#else
+	#error No atomic operations for this compiler
+#endif
+}
+
+
+
+template <class DT>
+long	FFTRealPlanCache <DT>::load_long (long volatile &val)
+{
+#if defined (_MSC_VER)
+	return (_InterlockedCompareExchange (&val, 0, 0));
+#elif defined (__GNUC__)
+	return (__atomic_load_n (&val, __ATOMIC_RELAXED));
+#else
+	#error No atomic operations for this compiler
+#endif
+}
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_FFTRealPlanCache_CODEHEADER_INCLUDED
+
+#undef ffft_FFTRealPlanCache_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,115 @@
+/*****************************************************************************
+
+        FFTRealPower.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_FFTRealPower_HEADER_INCLUDED)
+#define	ffft_FFTRealPower_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/def.h"
+#include	"ffft/OscSinCos.h"
+
+
+
+namespace ffft
+{
+
+
+
+// Power spectrum raised to an exponent, (re^2 + im^2) ^ exponent, read from
+// the output of FFTReal::do_fft() or FFTRealFixLen::do_fft().
+// Exponents 1 (power) and 0.5 (magnitude) are exact. 1/3 (compressed power,
+// as used by the enhanced autocorrelation) goes through fast_cbrt(), which
+// is vectorized for float. Other exponents use std::pow().
+// compute_pass_lut() and compute_pass_osc() do the same as the last radix-4
+// sweep of the transform, in place of FFTRealRadix4::direct_pass_lut() and
+// direct_pass_osc(), so the spectrum itself is never stored.
+template <class DT>
+class FFTRealPower
+{
+	// fast_cbrt() works on the bits of a float
+	typedef	int	CompileTimeCheck1 [(sizeof (int) == sizeof (float)) ? 1 : -1];
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	DT	DataType;
+	typedef	OscSinCos <DataType>	OscType;
+
+	static void	compute (DataType out [], const DataType f [], long len, DataType exponent);
+	static void	compute_pass_lut (DataType out [], const DataType sf [], long nbr_coef, const DataType cos1_ptr [], const DataType cos2_ptr [], DataType exponent);
+	static void	compute_pass_osc (DataType out [], const DataType sf [], long nbr_coef, OscType &osc1, OscType &osc2, DataType exponent);
+	static inline DataType
+							fast_cbrt (DataType x);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	static inline DataType
+							raise (DataType power, DataType exponent);
+	static inline void
+							store_extremes (DataType out [], const DataType sf [], long nbr_coef, DataType exponent);
+	static inline void
+							store_butterfly (DataType out [], const DataType sf [], long nbr_coef, long i, DataType c1, DataType s1, DataType c2, DataType s2, DataType exponent);
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+							FFTRealPower ();
+							~FFTRealPower ();
+							FFTRealPower (const FFTRealPower &other);
+	FFTRealPower &
+							operator = (const FFTRealPower &other);
+	bool				operator == (const FFTRealPower &other);
+	bool				operator != (const FFTRealPower &other);
+
+};	// class FFTRealPower
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/FFTRealPower.hpp"
+
+
+
+#endif	// ffft_FFTRealPower_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
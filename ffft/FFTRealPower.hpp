@@ -0,0 +1,344 @@
+/*****************************************************************************
+
+        FFTRealPower.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_FFTRealPower_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealPower code header.
+#endif
+#define	ffft_FFTRealPower_CURRENT_CODEHEADER
+
+#if ! defined (ffft_FFTRealPower_CODEHEADER_INCLUDED)
+#define	ffft_FFTRealPower_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/FFTRealRadix4.h"
+#include	"ffft/FFTRealSimd.h"
+#include	"ffft/FFTRealSplit.h"
+
+#include	<cassert>
+#include	<cfloat>
+#include	<cmath>
+#include	<cstring>
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: compute
+Description:
+	Raise the power of each bin of a spectrum to the given exponent:
+	out [k] = (re [k] ^ 2 + im [k] ^ 2) ^ exponent.
+	out may be f: each bin is read before its value is overwritten.
+Input parameters:
+	- f: spectrum computed by do_fft(), len values.
+	- len: length of the transform, power of 2, 2 or more.
+	- exponent: > 0.
+Output parameters:
+	- out: bins 0 to len/2, len/2 + 1 values.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealPower <DT>::compute (DataType out [], const DataType f [], long len, DataType exponent)
+{
+	assert (out != 0);
+	assert (f != 0);
+	assert (len >= 2);
+	assert ((len & (len - 1)) == 0);
+	assert (exponent > 0);
+
+	const FFTRealSplit <const DataType>	split (f, len);
+	const DataType * const	re_ptr = split.get_re_ptr ();
+	const DataType * const	im_ptr = split.get_neg_im_ptr ();	// Sign is lost
+	const long		half = split.get_nbr_bins ();
+
+	// The extreme bins are real and share the slots of bin 0
+	const DataType	re_0 = re_ptr [0];
+	const DataType	re_half = re_ptr [half];
+
+	if (exponent == DataType (1))
+	{
+		for (long bin = 1; bin < half; ++bin)
+		{
+			out [bin] = re_ptr [bin] * re_ptr [bin] + im_ptr [bin] * im_ptr [bin];
+		}
+	}
+
+	else if (exponent == DataType (0.5))
+	{
+		for (long bin = 1; bin < half; ++bin)
+		{
+			out [bin] = DataType (sqrt (
+				re_ptr [bin] * re_ptr [bin] + im_ptr [bin] * im_ptr [bin]
+			));
+		}
+	}
+
+	else if (exponent == DataType (1.0 / 3))
+	{
+		if (! FFTRealSimd <DataType>::power_cbrt (
+			FFTRealSimd <DataType>::get_level (),
+			out,
+			f,
+			len
+		))
+		{
+			for (long bin = 1; bin < half; ++bin)
+			{
+				out [bin] = fast_cbrt (
+					re_ptr [bin] * re_ptr [bin] + im_ptr [bin] * im_ptr [bin]
+				);
+			}
+		}
+	}
+
+	else
+	{
+		for (long bin = 1; bin < half; ++bin)
+		{
+			out [bin] = raise (
+				re_ptr [bin] * re_ptr [bin] + im_ptr [bin] * im_ptr [bin],
+				exponent
+			);
+		}
+	}
+
+	out [0] = raise (re_0 * re_0, exponent);
+	out [half] = raise (re_half * re_half, exponent);
+}
+
+
+
+/*
+==============================================================================
+Name: compute_pass_lut
+Description:
+	Last sweep of a forward transform, two passes at once, with the bins
+	raised to the exponent as in compute() instead of stored. The twiddle
+	factors come from tables, see FFTRealRadix4::direct_pass_lut().
+Input parameters:
+	- sf: output of the previous sweep, len values.
+	- nbr_coef: size of the first pass of the sweep, len / 4, 8 or more.
+	- cos1_ptr: cosine table of the first pass.
+	- cos2_ptr: cosine table of the second pass.
+	- exponent: > 0.
+Output parameters:
+	- out: bins 0 to len/2, len/2 + 1 values. Must not be sf.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealPower <DT>::compute_pass_lut (DataType out [], const DataType sf [], long nbr_coef, const DataType cos1_ptr [], const DataType cos2_ptr [], DataType exponent)
+{
+	assert (out != 0);
+	assert (sf != 0);
+	assert (out != sf);
+	assert (nbr_coef >= 8);
+	assert (cos1_ptr != 0);
+	assert (cos2_ptr != 0);
+	assert (exponent > 0);
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+
+	store_extremes (out, sf, nbr_coef, exponent);
+	for (long i = 1; i < h_nbr_coef; ++ i)
+	{
+		store_butterfly (
+			out, sf, nbr_coef, i,
+			cos1_ptr [i], cos1_ptr [h_nbr_coef - i],
+			cos2_ptr [i], cos2_ptr [nbr_coef - i],
+			exponent
+		);
+	}
+}
+
+
+
+/*
+==============================================================================
+Name: compute_pass_osc
+Description:
+	Same as compute_pass_lut(), with the twiddle factors coming from
+	oscillators, see FFTRealRadix4::direct_pass_osc().
+Input parameters:
+	- sf: output of the previous sweep, len values.
+	- nbr_coef: size of the first pass of the sweep, len / 4, 8 or more.
+	- exponent: > 0.
+Output parameters:
+	- out: bins 0 to len/2, len/2 + 1 values. Must not be sf.
+Input/output parameters:
+	- osc1: oscillator of the first pass.
+	- osc2: oscillator of the second pass.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealPower <DT>::compute_pass_osc (DataType out [], const DataType sf [], long nbr_coef, OscType &osc1, OscType &osc2, DataType exponent)
+{
+	assert (out != 0);
+	assert (sf != 0);
+	assert (out != sf);
+	assert (nbr_coef >= 8);
+	assert (exponent > 0);
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+
+	osc1.clear_buffers ();
+	osc2.clear_buffers ();
+
+	store_extremes (out, sf, nbr_coef, exponent);
+	for (long i = 1; i < h_nbr_coef; ++ i)
+	{
+		osc1.step ();
+		osc2.step ();
+		store_butterfly (
+			out, sf, nbr_coef, i,
+			osc1.get_cos (), osc1.get_sin (),
+			osc2.get_cos (), osc2.get_sin (),
+			exponent
+		);
+	}
+}
+
+
+
+// Cube root of x >= 0. Not approximated for this type.
+template <class DT>
+typename FFTRealPower <DT>::DataType	FFTRealPower <DT>::fast_cbrt (DataType x)
+{
+	assert (x >= 0);
+
+	return (DataType (pow (double (x), 1.0 / 3)));
+}
+
+
+
+// Cube root of x >= 0, relative error below 1.5e-6. The first guess divides
+// the exponent by 3 in the bit pattern, two Newton steps refine it.
+// Denormals are flushed to 0.
+// Same computation as FFTRealSimdSse2::cbrt(), keep them in sync.
+template <>
+inline float	FFTRealPower <float>::fast_cbrt (float x)
+{
+	assert (x >= 0);
+
+	const float	third = float (1.0 / 3);
+
+	int				bits;
+	memcpy (&bits, &x, sizeof (bits));
+	bits = int (float (bits) * third + 0.5f) + 0x2A5119F2;
+	float		y;
+	memcpy (&y, &bits, sizeof (y));
+
+	y = (y + y + x / (y * y)) * third;
+	y = (y + y + x / (y * y)) * third;
+
+	return ((x >= FLT_MIN) ? y : 0.0f);
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// Exponents handled like in compute(), for a single bin
+template <class DT>
+typename FFTRealPower <DT>::DataType	FFTRealPower <DT>::raise (DataType power, DataType exponent)
+{
+	if (exponent == DataType (1))
+	{
+		return (power);
+	}
+	else if (exponent == DataType (0.5))
+	{
+		return (DataType (sqrt (power)));
+	}
+	else if (exponent == DataType (1.0 / 3))
+	{
+		return (fast_cbrt (power));
+	}
+
+	return (DataType (pow (power, exponent)));
+}
+
+
+
+template <class DT>
+void	FFTRealPower <DT>::store_extremes (DataType out [], const DataType sf [], long nbr_coef, DataType exponent)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+
+	DataType			pw [5];
+	FFTRealRadix4 <DataType>::direct_power_extremes (pw, sf, nbr_coef);
+
+	out [0] = raise (pw [0], exponent);
+	out [h_nbr_coef] = raise (pw [1], exponent);
+	out [nbr_coef] = raise (pw [2], exponent);
+	out [d_nbr_coef - h_nbr_coef] = raise (pw [3], exponent);
+	out [d_nbr_coef] = raise (pw [4], exponent);
+}
+
+
+
+template <class DT>
+void	FFTRealPower <DT>::store_butterfly (DataType out [], const DataType sf [], long nbr_coef, long i, DataType c1, DataType s1, DataType c2, DataType s2, DataType exponent)
+{
+	const long		d_nbr_coef = nbr_coef << 1;
+
+	DataType			pw [4];
+	FFTRealRadix4 <DataType>::direct_power_butterfly (
+		pw, sf, nbr_coef, i, c1, s1, c2, s2
+	);
+
+	out [i] = raise (pw [0], exponent);
+	out [nbr_coef - i] = raise (pw [1], exponent);
+	out [nbr_coef + i] = raise (pw [2], exponent);
+	out [d_nbr_coef - i] = raise (pw [3], exponent);
+}
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_FFTRealPower_CODEHEADER_INCLUDED
+
+#undef ffft_FFTRealPower_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
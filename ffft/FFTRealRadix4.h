@@ -0,0 +1,130 @@
+/*****************************************************************************
+
+        FFTRealRadix4.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_FFTRealRadix4_HEADER_INCLUDED)
+#define	ffft_FFTRealRadix4_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/def.h"
+#include	"ffft/OscSinCos.h"
+
+
+
+namespace ffft
+{
+
+
+
+// Two consecutive FFTReal passes (nbr_coef and nbr_coef * 2) done in a single
+// sweep over the data, as a radix-4 step. Passes nbr_coef at index i of both
+// half-blocks give exactly the 8 values the next pass needs at i and
+// nbr_coef - i, so they stay in registers and the memory traffic of the
+// intermediate buffer is gone.
+// Scalar code, the vectorized versions are in FFTRealSimd. nbr_coef is the
+// size of the first pass. cos1_ptr and osc1 give the twiddle factors of the
+// first pass, cos2_ptr and osc2 the ones of the second pass.
+// Data layout is the same as in FFTReal, passes are out-of-place.
+template <class DT>
+class FFTRealRadix4
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	DT	DataType;
+	typedef	OscSinCos <DataType>	OscType;
+
+	static inline void
+							direct_pass_lut (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr []);
+	static inline void
+							direct_pass_osc (DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc1, OscType &osc2);
+
+	static inline void
+							inverse_pass_lut (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr []);
+	static inline void
+							inverse_pass_osc (DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc1, OscType &osc2);
+
+	// Single steps, also used by the vectorized versions for the extreme
+	// coefficients and the remainders
+	ffft_FORCEINLINE static void
+							direct_extremes (DataType df [], const DataType sf [], long nbr_coef);
+	ffft_FORCEINLINE static void
+							direct_butterfly (DataType df [], const DataType sf [], long nbr_coef, long i, DataType c1, DataType s1, DataType c2, DataType s2);
+
+	// Same steps when they are the last ones of a forward transform
+	// (len = nbr_coef * 4), giving the power of the bins they complete
+	ffft_FORCEINLINE static void
+							direct_power_extremes (DataType pw [5], const DataType sf [], long nbr_coef);
+	ffft_FORCEINLINE static void
+							direct_power_butterfly (DataType pw [4], const DataType sf [], long nbr_coef, long i, DataType c1, DataType s1, DataType c2, DataType s2);
+
+	ffft_FORCEINLINE static void
+							inverse_extremes (DataType df [], const DataType sf [], long nbr_coef);
+	ffft_FORCEINLINE static void
+							inverse_butterfly (DataType df [], const DataType sf [], long nbr_coef, long i, DataType c1, DataType s1, DataType c2, DataType s2);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+							FFTRealRadix4 ();
+							~FFTRealRadix4 ();
+							FFTRealRadix4 (const FFTRealRadix4 &other);
+	FFTRealRadix4 &
+							operator = (const FFTRealRadix4 &other);
+	bool				operator == (const FFTRealRadix4 &other);
+	bool				operator != (const FFTRealRadix4 &other);
+
+};	// class FFTRealRadix4
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/FFTRealRadix4.hpp"
+
+
+
+#endif	// ffft_FFTRealRadix4_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
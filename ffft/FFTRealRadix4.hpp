@@ -0,0 +1,478 @@
+/*****************************************************************************
+
+        FFTRealRadix4.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_FFTRealRadix4_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealRadix4 code header.
+#endif
+#define	ffft_FFTRealRadix4_CURRENT_CODEHEADER
+
+#if ! defined (ffft_FFTRealRadix4_CODEHEADER_INCLUDED)
+#define	ffft_FFTRealRadix4_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <class DT>
+void	FFTRealRadix4 <DT>::direct_pass_lut (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr [])
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (nbr_coef >= 8);
+	assert (len >= nbr_coef * 4);
+	assert (cos1_ptr != 0);
+	assert (cos2_ptr != 0);
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		q_nbr_coef = nbr_coef << 2;
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		direct_extremes (dfb, sfb, nbr_coef);
+
+		for (long i = 1; i < h_nbr_coef; ++ i)
+		{
+			direct_butterfly (
+				dfb, sfb, nbr_coef, i,
+				cos1_ptr [i], cos1_ptr [h_nbr_coef - i],
+				cos2_ptr [i], cos2_ptr [nbr_coef - i]
+			);
+		}
+
+		coef_index += q_nbr_coef;
+	}
+	while (coef_index < len);
+}
+
+
+
+template <class DT>
+void	FFTRealRadix4 <DT>::direct_pass_osc (DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc1, OscType &osc2)
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (nbr_coef >= 8);
+	assert (len >= nbr_coef * 4);
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		q_nbr_coef = nbr_coef << 2;
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		osc1.clear_buffers ();
+		osc2.clear_buffers ();
+
+		direct_extremes (dfb, sfb, nbr_coef);
+
+		for (long i = 1; i < h_nbr_coef; ++ i)
+		{
+			osc1.step ();
+			osc2.step ();
+			direct_butterfly (
+				dfb, sfb, nbr_coef, i,
+				osc1.get_cos (), osc1.get_sin (),
+				osc2.get_cos (), osc2.get_sin ()
+			);
+		}
+
+		coef_index += q_nbr_coef;
+	}
+	while (coef_index < len);
+}
+
+
+
+template <class DT>
+void	FFTRealRadix4 <DT>::inverse_pass_lut (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr [])
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (nbr_coef >= 8);
+	assert (len >= nbr_coef * 4);
+	assert (cos1_ptr != 0);
+	assert (cos2_ptr != 0);
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		q_nbr_coef = nbr_coef << 2;
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		inverse_extremes (dfb, sfb, nbr_coef);
+
+		for (long i = 1; i < h_nbr_coef; ++ i)
+		{
+			inverse_butterfly (
+				dfb, sfb, nbr_coef, i,
+				cos1_ptr [i], cos1_ptr [h_nbr_coef - i],
+				cos2_ptr [i], cos2_ptr [nbr_coef - i]
+			);
+		}
+
+		coef_index += q_nbr_coef;
+	}
+	while (coef_index < len);
+}
+
+
+
+template <class DT>
+void	FFTRealRadix4 <DT>::inverse_pass_osc (DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc1, OscType &osc2)
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (nbr_coef >= 8);
+	assert (len >= nbr_coef * 4);
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		q_nbr_coef = nbr_coef << 2;
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		osc1.clear_buffers ();
+		osc2.clear_buffers ();
+
+		inverse_extremes (dfb, sfb, nbr_coef);
+
+		for (long i = 1; i < h_nbr_coef; ++ i)
+		{
+			osc1.step ();
+			osc2.step ();
+			inverse_butterfly (
+				dfb, sfb, nbr_coef, i,
+				osc1.get_cos (), osc1.get_sin (),
+				osc2.get_cos (), osc2.get_sin ()
+			);
+		}
+
+		coef_index += q_nbr_coef;
+	}
+	while (coef_index < len);
+}
+
+
+
+// Index 0 and h_nbr_coef of the first pass, then 0, h_nbr_coef and
+// nbr_coef of the second one. All the twiddle factors are trivial.
+template <class DT>
+void	FFTRealRadix4 <DT>::direct_extremes (DataType df [], const DataType sf [], long nbr_coef)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	const DataType * const	sfa = sf;
+	const DataType * const	sfb = sf + d_nbr_coef;
+	const DataType	sqrt2_2 = DataType (SQRT2 * 0.5);
+
+	// First pass, both half-blocks
+	const DataType	a_0 = sfa [0] + sfa [nbr_coef];
+	const DataType	a_n = sfa [0] - sfa [nbr_coef];
+	const DataType	a_h = sfa [h_nbr_coef];
+	const DataType	a_nh = sfa [nbr_coef + h_nbr_coef];
+	const DataType	b_0 = sfb [0] + sfb [nbr_coef];
+	const DataType	b_n = sfb [0] - sfb [nbr_coef];
+	const DataType	b_h = sfb [h_nbr_coef];
+	const DataType	b_nh = sfb [nbr_coef + h_nbr_coef];
+
+	// Second pass
+	df [0] = a_0 + b_0;
+	df [d_nbr_coef] = a_0 - b_0;
+	df [nbr_coef] = a_n;
+	df [nbr_coef * 3] = b_n;
+
+	DataType			v;
+
+	v = (b_h - b_nh) * sqrt2_2;
+	df [h_nbr_coef] = a_h + v;
+	df [d_nbr_coef - h_nbr_coef] = a_h - v;
+
+	v = (b_h + b_nh) * sqrt2_2;
+	df [d_nbr_coef + h_nbr_coef] = v + a_nh;
+	df [(d_nbr_coef << 1) - h_nbr_coef] = v - a_nh;
+}
+
+
+
+// c1, s1: cos and sin (i * PI / nbr_coef), first pass
+// c2, s2: cos and sin (i * PI / (nbr_coef * 2)), second pass. The second
+// pass at nbr_coef - i uses the same values, swapped.
+template <class DT>
+void	FFTRealRadix4 <DT>::direct_butterfly (DataType df [], const DataType sf [], long nbr_coef, long i, DataType c1, DataType s1, DataType c2, DataType s2)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	const DataType * const	sfa = sf;
+	const DataType * const	sfb = sf + d_nbr_coef;
+
+	DataType			v;
+
+	// First pass, first half-block. a_ni is [nbr_coef - i], a_dni is
+	// [nbr_coef * 2 - i], etc.
+	v = sfa [nbr_coef + i] * c1 - sfa [nbr_coef + h_nbr_coef + i] * s1;
+	const DataType	a_i = sfa [i] + v;
+	const DataType	a_ni = sfa [i] - v;
+	v = sfa [nbr_coef + i] * s1 + sfa [nbr_coef + h_nbr_coef + i] * c1;
+	const DataType	a_pi = v + sfa [h_nbr_coef + i];
+	const DataType	a_dni = v - sfa [h_nbr_coef + i];
+
+	// First pass, second half-block
+	v = sfb [nbr_coef + i] * c1 - sfb [nbr_coef + h_nbr_coef + i] * s1;
+	const DataType	b_i = sfb [i] + v;
+	const DataType	b_ni = sfb [i] - v;
+	v = sfb [nbr_coef + i] * s1 + sfb [nbr_coef + h_nbr_coef + i] * c1;
+	const DataType	b_pi = v + sfb [h_nbr_coef + i];
+	const DataType	b_dni = v - sfb [h_nbr_coef + i];
+
+	// Second pass at i
+	v = b_i * c2 - b_pi * s2;
+	df [i] = a_i + v;
+	df [d_nbr_coef - i] = a_i - v;
+	v = b_i * s2 + b_pi * c2;
+	df [d_nbr_coef + i] = v + a_pi;
+	df [(d_nbr_coef << 1) - i] = v - a_pi;
+
+	// Second pass at nbr_coef - i
+	v = b_ni * s2 - b_dni * c2;
+	df [nbr_coef - i] = a_ni + v;
+	df [nbr_coef + i] = a_ni - v;
+	v = b_ni * c2 + b_dni * s2;
+	df [nbr_coef * 3 - i] = v + a_dni;
+	df [nbr_coef * 3 + i] = v - a_dni;
+}
+
+
+
+// direct_extremes() on the last sweep. These coefficients are complete bins:
+// pw [0] to pw [4] get the power of bins 0, nbr_coef / 2, nbr_coef,
+// nbr_coef * 3 / 2 and nbr_coef * 2.
+template <class DT>
+void	FFTRealRadix4 <DT>::direct_power_extremes (DataType pw [5], const DataType sf [], long nbr_coef)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	const DataType * const	sfa = sf;
+	const DataType * const	sfb = sf + d_nbr_coef;
+	const DataType	sqrt2_2 = DataType (SQRT2 * 0.5);
+
+	const DataType	a_0 = sfa [0] + sfa [nbr_coef];
+	const DataType	a_n = sfa [0] - sfa [nbr_coef];
+	const DataType	a_h = sfa [h_nbr_coef];
+	const DataType	a_nh = sfa [nbr_coef + h_nbr_coef];
+	const DataType	b_0 = sfb [0] + sfb [nbr_coef];
+	const DataType	b_n = sfb [0] - sfb [nbr_coef];
+	const DataType	b_h = sfb [h_nbr_coef];
+	const DataType	b_nh = sfb [nbr_coef + h_nbr_coef];
+
+	const DataType	r_0 = a_0 + b_0;
+	const DataType	r_d = a_0 - b_0;
+	pw [0] = r_0 * r_0;
+	pw [2] = a_n * a_n + b_n * b_n;
+	pw [4] = r_d * r_d;
+
+	const DataType	vr = (b_h - b_nh) * sqrt2_2;
+	const DataType	vi = (b_h + b_nh) * sqrt2_2;
+	const DataType	r_h = a_h + vr;
+	const DataType	i_h = vi + a_nh;
+	const DataType	r_dh = a_h - vr;
+	const DataType	i_dh = vi - a_nh;
+	pw [1] = r_h * r_h + i_h * i_h;
+	pw [3] = r_dh * r_dh + i_dh * i_dh;
+}
+
+
+
+// direct_butterfly() on the last sweep. pw [0] to pw [3] get the power of
+// bins i, nbr_coef - i, nbr_coef + i and nbr_coef * 2 - i.
+template <class DT>
+void	FFTRealRadix4 <DT>::direct_power_butterfly (DataType pw [4], const DataType sf [], long nbr_coef, long i, DataType c1, DataType s1, DataType c2, DataType s2)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	const DataType * const	sfa = sf;
+	const DataType * const	sfb = sf + d_nbr_coef;
+
+	DataType			v;
+
+	// First pass, both half-blocks
+	v = sfa [nbr_coef + i] * c1 - sfa [nbr_coef + h_nbr_coef + i] * s1;
+	const DataType	a_i = sfa [i] + v;
+	const DataType	a_ni = sfa [i] - v;
+	v = sfa [nbr_coef + i] * s1 + sfa [nbr_coef + h_nbr_coef + i] * c1;
+	const DataType	a_pi = v + sfa [h_nbr_coef + i];
+	const DataType	a_dni = v - sfa [h_nbr_coef + i];
+
+	v = sfb [nbr_coef + i] * c1 - sfb [nbr_coef + h_nbr_coef + i] * s1;
+	const DataType	b_i = sfb [i] + v;
+	const DataType	b_ni = sfb [i] - v;
+	v = sfb [nbr_coef + i] * s1 + sfb [nbr_coef + h_nbr_coef + i] * c1;
+	const DataType	b_pi = v + sfb [h_nbr_coef + i];
+	const DataType	b_dni = v - sfb [h_nbr_coef + i];
+
+	// Second pass at i, real and imaginary parts
+	const DataType	vr_i = b_i * c2 - b_pi * s2;
+	const DataType	vi_i = b_i * s2 + b_pi * c2;
+	const DataType	r_i = a_i + vr_i;
+	const DataType	i_i = vi_i + a_pi;
+	const DataType	r_di = a_i - vr_i;
+	const DataType	i_di = vi_i - a_pi;
+
+	// Second pass at nbr_coef - i
+	const DataType	vr_ni = b_ni * s2 - b_dni * c2;
+	const DataType	vi_ni = b_ni * c2 + b_dni * s2;
+	const DataType	r_ni = a_ni + vr_ni;
+	const DataType	i_ni = vi_ni + a_dni;
+	const DataType	r_pi = a_ni - vr_ni;
+	const DataType	i_pi = vi_ni - a_dni;
+
+	pw [0] = r_i * r_i + i_i * i_i;
+	pw [1] = r_ni * r_ni + i_ni * i_ni;
+	pw [2] = r_pi * r_pi + i_pi * i_pi;
+	pw [3] = r_di * r_di + i_di * i_di;
+}
+
+
+
+template <class DT>
+void	FFTRealRadix4 <DT>::inverse_extremes (DataType df [], const DataType sf [], long nbr_coef)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	DataType * const	dfa = df;
+	DataType * const	dfb = df + d_nbr_coef;
+	const DataType	sqrt2_2 = DataType (SQRT2 * 0.5);
+
+	// First pass (nbr_coef * 2)
+	const DataType	a_0 = sf [0] + sf [d_nbr_coef];
+	const DataType	b_0 = sf [0] - sf [d_nbr_coef];
+	const DataType	a_n = sf [nbr_coef] * 2;
+	const DataType	b_n = sf [nbr_coef * 3] * 2;
+
+	const DataType	a_h = sf [h_nbr_coef] + sf [d_nbr_coef - h_nbr_coef];
+	const DataType	a_nh =
+		sf [d_nbr_coef + h_nbr_coef] - sf [(d_nbr_coef << 1) - h_nbr_coef];
+	const DataType	vr = sf [h_nbr_coef] - sf [d_nbr_coef - h_nbr_coef];
+	const DataType	vi =
+		sf [d_nbr_coef + h_nbr_coef] + sf [(d_nbr_coef << 1) - h_nbr_coef];
+	const DataType	b_h = (vr + vi) * sqrt2_2;
+	const DataType	b_nh = (vi - vr) * sqrt2_2;
+
+	// Second pass (nbr_coef), both half-blocks
+	dfa [0] = a_0 + a_n;
+	dfa [nbr_coef] = a_0 - a_n;
+	dfa [h_nbr_coef] = a_h * 2;
+	dfa [nbr_coef + h_nbr_coef] = a_nh * 2;
+
+	dfb [0] = b_0 + b_n;
+	dfb [nbr_coef] = b_0 - b_n;
+	dfb [h_nbr_coef] = b_h * 2;
+	dfb [nbr_coef + h_nbr_coef] = b_nh * 2;
+}
+
+
+
+// Same twiddle factors as direct_butterfly()
+template <class DT>
+void	FFTRealRadix4 <DT>::inverse_butterfly (DataType df [], const DataType sf [], long nbr_coef, long i, DataType c1, DataType s1, DataType c2, DataType s2)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	DataType * const	dfa = df;
+	DataType * const	dfb = df + d_nbr_coef;
+
+	DataType			vr;
+	DataType			vi;
+
+	// First pass (nbr_coef * 2) at i
+	const DataType	a_i = sf [i] + sf [d_nbr_coef - i];
+	const DataType	a_pi = sf [d_nbr_coef + i] - sf [(d_nbr_coef << 1) - i];
+	vr = sf [i] - sf [d_nbr_coef - i];
+	vi = sf [d_nbr_coef + i] + sf [(d_nbr_coef << 1) - i];
+	const DataType	b_i = vr * c2 + vi * s2;
+	const DataType	b_pi = vi * c2 - vr * s2;
+
+	// First pass at nbr_coef - i
+	const DataType	a_ni = sf [nbr_coef - i] + sf [nbr_coef + i];
+	const DataType	a_dni = sf [nbr_coef * 3 - i] - sf [nbr_coef * 3 + i];
+	vr = sf [nbr_coef - i] - sf [nbr_coef + i];
+	vi = sf [nbr_coef * 3 - i] + sf [nbr_coef * 3 + i];
+	const DataType	b_ni = vr * s2 + vi * c2;
+	const DataType	b_dni = vi * s2 - vr * c2;
+
+	// Second pass (nbr_coef), first half-block
+	dfa [i] = a_i + a_ni;
+	dfa [h_nbr_coef + i] = a_pi - a_dni;
+	vr = a_i - a_ni;
+	vi = a_pi + a_dni;
+	dfa [nbr_coef + i] = vr * c1 + vi * s1;
+	dfa [nbr_coef + h_nbr_coef + i] = vi * c1 - vr * s1;
+
+	// Second pass, second half-block
+	dfb [i] = b_i + b_ni;
+	dfb [h_nbr_coef + i] = b_pi - b_dni;
+	vr = b_i - b_ni;
+	vi = b_pi + b_dni;
+	dfb [nbr_coef + i] = vr * c1 + vi * s1;
+	dfb [nbr_coef + h_nbr_coef + i] = vi * c1 - vr * s1;
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_FFTRealRadix4_CODEHEADER_INCLUDED
+
+#undef ffft_FFTRealRadix4_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -43,8 +43,9 @@ class FFTRealSelect
 
 public:
 
-	ffft_FORCEINLINE static float *
-						sel_bin (float *e_ptr, float *o_ptr);
+	template <class T>
+	ffft_FORCEINLINE static T *
+						sel_bin (T *e_ptr, T *o_ptr);
 
 
 
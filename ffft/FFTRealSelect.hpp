@@ -35,7 +35,8 @@ namespace ffft
 
 
 template <int P>
-float *	FFTRealSelect <P>::sel_bin (float *e_ptr, float *o_ptr)
+template <class T>
+T *	FFTRealSelect <P>::sel_bin (T *e_ptr, T *o_ptr)
 {
 	return (o_ptr);
 }
@@ -43,7 +44,8 @@ float *	FFTRealSelect <P>::sel_bin (float *e_ptr, float *o_ptr)
 
 
 template <>
-inline float *	FFTRealSelect <0>::sel_bin (float *e_ptr, float *o_ptr)
+template <class T>
+T *	FFTRealSelect <0>::sel_bin (T *e_ptr, T *o_ptr)
 {
     (void) o_ptr;
 	return (e_ptr);
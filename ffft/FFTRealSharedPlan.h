@@ -0,0 +1,113 @@
+/*****************************************************************************
+
+        FFTRealSharedPlan.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_FFTRealSharedPlan_HEADER_INCLUDED)
+#define	ffft_FFTRealSharedPlan_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+namespace ffft
+{
+
+
+
+// Read-only access to a plan shared between threads, as handed out by
+// FFTRealPlanCache. Only the functions taking a workspace are forwarded: the
+// other ones would write the plan's own buffer, which is not safe when the
+// plan has several users.
+// P is FFTReal or FFTRealEven. Functions P does not have are declared too,
+// calling them fails to compile.
+template <class P>
+class FFTRealSharedPlan
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	P	PlanType;
+	typedef	typename P::DataType	DataType;
+
+	explicit			FFTRealSharedPlan (long length);
+
+	inline long		get_length () const;
+	inline long		get_workspace_len () const;
+
+	// FFTReal
+	inline void		do_fft (DataType f [], const DataType x [], DataType ws []) const;
+	inline void		do_ifft (const DataType f [], DataType x [], DataType ws []) const;
+	inline void		do_fft_pruned (DataType f [], const DataType x [], long nbr_samples, DataType ws []) const;
+	inline void		do_power_spectrum (DataType out [], const DataType x [], DataType exponent, DataType ws []) const;
+	inline void		do_fft_batch (DataType f [], const DataType x [], long nbr_frames, DataType ws []) const;
+	inline void		do_ifft_batch (const DataType f [], DataType x [], long nbr_frames, DataType ws []) const;
+	inline void		rescale (DataType x []) const;
+
+	// FFTRealEven
+	inline void		do_fft (DataType f [], const DataType x [], long nbr_bins, DataType ws []) const;
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	PlanType		_plan;
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealSharedPlan ();
+						FFTRealSharedPlan (const FFTRealSharedPlan &other);
+	FFTRealSharedPlan &
+						operator = (const FFTRealSharedPlan &other);
+	bool				operator == (const FFTRealSharedPlan &other);
+	bool				operator != (const FFTRealSharedPlan &other);
+
+};	// class FFTRealSharedPlan
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/FFTRealSharedPlan.hpp"
+
+
+
+#endif	// ffft_FFTRealSharedPlan_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,156 @@
+/*****************************************************************************
+
+        FFTRealSharedPlan.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_FFTRealSharedPlan_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealSharedPlan code header.
+#endif
+#define	ffft_FFTRealSharedPlan_CURRENT_CODEHEADER
+
+#if ! defined (ffft_FFTRealSharedPlan_CODEHEADER_INCLUDED)
+#define	ffft_FFTRealSharedPlan_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: ctor
+Input parameters:
+	- length: FFT length, as for the constructor of P.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <class P>
+FFTRealSharedPlan <P>::FFTRealSharedPlan (long length)
+:	_plan (length)
+{
+	// Nothing
+}
+
+
+
+template <class P>
+long	FFTRealSharedPlan <P>::get_length () const
+{
+	return (_plan.get_length ());
+}
+
+
+
+template <class P>
+long	FFTRealSharedPlan <P>::get_workspace_len () const
+{
+	return (_plan.get_workspace_len ());
+}
+
+
+
+template <class P>
+void	FFTRealSharedPlan <P>::do_fft (DataType f [], const DataType x [], DataType ws []) const
+{
+	_plan.do_fft (f, x, ws);
+}
+
+
+
+template <class P>
+void	FFTRealSharedPlan <P>::do_ifft (const DataType f [], DataType x [], DataType ws []) const
+{
+	_plan.do_ifft (f, x, ws);
+}
+
+
+
+template <class P>
+void	FFTRealSharedPlan <P>::do_fft_pruned (DataType f [], const DataType x [], long nbr_samples, DataType ws []) const
+{
+	_plan.do_fft_pruned (f, x, nbr_samples, ws);
+}
+
+
+
+template <class P>
+void	FFTRealSharedPlan <P>::do_power_spectrum (DataType out [], const DataType x [], DataType exponent, DataType ws []) const
+{
+	_plan.do_power_spectrum (out, x, exponent, ws);
+}
+
+
+
+template <class P>
+void	FFTRealSharedPlan <P>::do_fft_batch (DataType f [], const DataType x [], long nbr_frames, DataType ws []) const
+{
+	_plan.do_fft_batch (f, x, nbr_frames, ws);
+}
+
+
+
+template <class P>
+void	FFTRealSharedPlan <P>::do_ifft_batch (const DataType f [], DataType x [], long nbr_frames, DataType ws []) const
+{
+	_plan.do_ifft_batch (f, x, nbr_frames, ws);
+}
+
+
+
+template <class P>
+void	FFTRealSharedPlan <P>::rescale (DataType x []) const
+{
+	_plan.rescale (x);
+}
+
+
+
+template <class P>
+void	FFTRealSharedPlan <P>::do_fft (DataType f [], const DataType x [], long nbr_bins, DataType ws []) const
+{
+	_plan.do_fft (f, x, nbr_bins, ws);
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_FFTRealSharedPlan_CODEHEADER_INCLUDED
+
+#undef ffft_FFTRealSharedPlan_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,169 @@
+/*****************************************************************************
+
+        FFTRealSimd.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_FFTRealSimd_HEADER_INCLUDED)
+#define	ffft_FFTRealSimd_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/def.h"
+#include	"ffft/OscSinCos.h"
+
+#if defined (ffft_SIMD_SSE2)
+	#include	"ffft/FFTRealSimdSse2.h"
+#endif
+#if defined (ffft_SIMD_AVX2)
+	#include	"ffft/FFTRealSimdAvx2.h"
+#endif
+#if defined (ffft_SIMD_AVX512)
+	#include	"ffft/FFTRealSimdAvx512.h"
+#endif
+
+
+
+namespace ffft
+{
+
+
+
+// Picks the vectorized version of a pass for the given SimdLevel. Each
+// function returns false when there is none for this data type, level or
+// size; the caller then runs its scalar code.
+// The CPU is checked once per process. get_level() gives the level to use:
+// the detected one, unless force_level() or ffft_SIMD_FORCE_LEVEL asked for
+// a lower one. FFTReal reads it at construction, FFTRealFixLen at each pass.
+template <class DT>
+class FFTRealSimd
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	DT	DataType;
+	typedef	OscSinCos <DataType>	OscType;
+
+	static inline int
+							detect_level ();
+	static inline int
+							get_level ();
+	static inline void
+							force_level (int level);
+
+	static inline bool
+							direct_pass_1_2 (int level, DataType df [], const DataType x [], const long br_ptr [], long br_step, long len);
+	static inline bool
+							direct_pass_3 (int level, DataType df [], const DataType sf [], long len);
+	static inline bool
+							direct_pass_n_lut (int level, DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr []);
+	static inline bool
+							direct_pass_n_osc (int level, DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc);
+
+	static inline bool
+							inverse_pass_n_lut (int level, DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr []);
+	static inline bool
+							inverse_pass_n_osc (int level, DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc);
+
+	// Two passes at once (FFTRealRadix4). nbr_coef is the size of the first
+	// one.
+	static inline bool
+							direct_pass_n2_lut (int level, DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr []);
+	static inline bool
+							direct_pass_n2_osc (int level, DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc1, OscType &osc2);
+	static inline bool
+							inverse_pass_n2_lut (int level, DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr []);
+	static inline bool
+							inverse_pass_n2_osc (int level, DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc1, OscType &osc2);
+
+	static inline bool
+							inverse_pass_3 (int level, DataType df [], const DataType sf [], long len);
+	static inline bool
+							inverse_pass_1_2 (int level, DataType x [], const DataType sf [], const long br_ptr [], long br_step, long len);
+
+	// Passes of FFTComplex
+	static inline bool
+							complex_pass_4 (int level, DataType dr [], DataType di [], const DataType sr [], const DataType si [], long nbr_coef, long stride, const DataType tw_ptr []);
+	static inline bool
+							complex_pass_2 (int level, DataType dr [], DataType di [], const DataType sr [], const DataType si [], long stride);
+
+	// See FFTRealPower
+	static inline bool
+							power_cbrt (int level, DataType out [], const DataType f [], long len);
+	static inline bool
+							power_pass_n2_lut (int level, DataType out [], const DataType sf [], long nbr_coef, const DataType cos1_ptr [], const DataType cos2_ptr [], DataType exponent);
+	static inline bool
+							power_pass_n2_osc (int level, DataType out [], const DataType sf [], long nbr_coef, OscType &osc1, OscType &osc2, DataType exponent);
+
+	// Twiddles of FFTRealDct, coefficients 1 to len/2 - 1
+	static inline bool
+							dct_post (int level, DataType f [], const DataType vf [], const DataType cos_ptr [], const DataType sin_ptr [], long len);
+	static inline bool
+							dct_pre (int level, DataType vf [], const DataType f [], const DataType cos_ptr [], const DataType sin_ptr [], long len);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	static inline int &
+							use_level ();
+	static inline int
+							clip_level (int level);
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+							FFTRealSimd ();
+							~FFTRealSimd ();
+							FFTRealSimd (const FFTRealSimd &other);
+	FFTRealSimd &	operator = (const FFTRealSimd &other);
+	bool				operator == (const FFTRealSimd &other);
+	bool				operator != (const FFTRealSimd &other);
+
+};	// class FFTRealSimd
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/FFTRealSimd.hpp"
+
+
+
+#endif	// ffft_FFTRealSimd_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,864 @@
+/*****************************************************************************
+
+        FFTRealSimd.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_FFTRealSimd_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealSimd code header.
+#endif
+#define	ffft_FFTRealSimd_CURRENT_CODEHEADER
+
+#if ! defined (ffft_FFTRealSimd_CODEHEADER_INCLUDED)
+#define	ffft_FFTRealSimd_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <class DT>
+int	FFTRealSimd <DT>::get_level ()
+{
+	return (use_level ());
+}
+
+
+
+/*
+==============================================================================
+Name: force_level
+Description:
+	Overrides the detected level, for benchmarking or to reproduce a problem
+	seen on another CPU. FFTReal objects built afterwards and all the
+	FFTRealFixLen transforms use the new level. Levels the CPU doesn't have
+	are clipped to the detected one.
+	This is not thread-safe: call it before starting any transform.
+Input parameters:
+	- level: one of the SimdLevel values, or SimdLevel_AUTO to go back to the
+		detected level.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+void	FFTRealSimd <DT>::force_level (int level)
+{
+	use_level () = clip_level (level);
+}
+
+
+
+// Scalar code only, for any type but float
+
+template <class DT>
+int	FFTRealSimd <DT>::detect_level ()
+{
+	return (SimdLevel_NONE);
+}
+
+
+
+template <class DT>
+bool	FFTRealSimd <DT>::direct_pass_1_2 (int level, DataType df [], const DataType x [], const long br_ptr [], long br_step, long len)
+{
+	(void) level;
+	(void) df;
+	(void) x;
+	(void) br_ptr;
+	(void) br_step;
+	(void) len;
+
+	return (false);
+}
+
+
+
+template <class DT>
+bool	FFTRealSimd <DT>::direct_pass_3 (int level, DataType df [], const DataType sf [], long len)
+{
+	(void) level;
+	(void) df;
+	(void) sf;
+	(void) len;
+
+	return (false);
+}
+
+
+
+template <class DT>
+bool	FFTRealSimd <DT>::direct_pass_n_lut (int level, DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr [])
+{
+	(void) level;
+	(void) df;
+	(void) sf;
+	(void) nbr_coef;
+	(void) len;
+	(void) cos_ptr;
+
+	return (false);
+}
+
+
+
+template <class DT>
+bool	FFTRealSimd <DT>::direct_pass_n_osc (int level, DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc)
+{
+	(void) level;
+	(void) df;
+	(void) sf;
+	(void) nbr_coef;
+	(void) len;
+	(void) osc;
+
+	return (false);
+}
+
+
+
+template <class DT>
+bool	FFTRealSimd <DT>::inverse_pass_n_lut (int level, DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr [])
+{
+	(void) level;
+	(void) df;
+	(void) sf;
+	(void) nbr_coef;
+	(void) len;
+	(void) cos_ptr;
+
+	return (false);
+}
+
+
+
+template <class DT>
+bool	FFTRealSimd <DT>::inverse_pass_n_osc (int level, DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc)
+{
+	(void) level;
+	(void) df;
+	(void) sf;
+	(void) nbr_coef;
+	(void) len;
+	(void) osc;
+
+	return (false);
+}
+
+
+
+template <class DT>
+bool	FFTRealSimd <DT>::direct_pass_n2_lut (int level, DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr [])
+{
+	(void) level;
+	(void) df;
+	(void) sf;
+	(void) nbr_coef;
+	(void) len;
+	(void) cos1_ptr;
+	(void) cos2_ptr;
+
+	return (false);
+}
+
+
+
+template <class DT>
+bool	FFTRealSimd <DT>::direct_pass_n2_osc (int level, DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc1, OscType &osc2)
+{
+	(void) level;
+	(void) df;
+	(void) sf;
+	(void) nbr_coef;
+	(void) len;
+	(void) osc1;
+	(void) osc2;
+
+	return (false);
+}
+
+
+
+template <class DT>
+bool	FFTRealSimd <DT>::inverse_pass_n2_lut (int level, DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr [])
+{
+	(void) level;
+	(void) df;
+	(void) sf;
+	(void) nbr_coef;
+	(void) len;
+	(void) cos1_ptr;
+	(void) cos2_ptr;
+
+	return (false);
+}
+
+
+
+template <class DT>
+bool	FFTRealSimd <DT>::inverse_pass_n2_osc (int level, DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc1, OscType &osc2)
+{
+	(void) level;
+	(void) df;
+	(void) sf;
+	(void) nbr_coef;
+	(void) len;
+	(void) osc1;
+	(void) osc2;
+
+	return (false);
+}
+
+
+
+template <class DT>
+bool	FFTRealSimd <DT>::inverse_pass_3 (int level, DataType df [], const DataType sf [], long len)
+{
+	(void) level;
+	(void) df;
+	(void) sf;
+	(void) len;
+
+	return (false);
+}
+
+
+
+template <class DT>
+bool	FFTRealSimd <DT>::inverse_pass_1_2 (int level, DataType x [], const DataType sf [], const long br_ptr [], long br_step, long len)
+{
+	(void) level;
+	(void) x;
+	(void) sf;
+	(void) br_ptr;
+	(void) br_step;
+	(void) len;
+
+	return (false);
+}
+
+
+
+template <class DT>
+bool	FFTRealSimd <DT>::complex_pass_4 (int level, DataType dr [], DataType di [], const DataType sr [], const DataType si [], long nbr_coef, long stride, const DataType tw_ptr [])
+{
+	(void) level;
+	(void) dr;
+	(void) di;
+	(void) sr;
+	(void) si;
+	(void) nbr_coef;
+	(void) stride;
+	(void) tw_ptr;
+
+	return (false);
+}
+
+
+
+template <class DT>
+bool	FFTRealSimd <DT>::complex_pass_2 (int level, DataType dr [], DataType di [], const DataType sr [], const DataType si [], long stride)
+{
+	(void) level;
+	(void) dr;
+	(void) di;
+	(void) sr;
+	(void) si;
+	(void) stride;
+
+	return (false);
+}
+
+
+
+template <class DT>
+bool	FFTRealSimd <DT>::power_cbrt (int level, DataType out [], const DataType f [], long len)
+{
+	(void) level;
+	(void) out;
+	(void) f;
+	(void) len;
+
+	return (false);
+}
+
+
+
+template <class DT>
+bool	FFTRealSimd <DT>::power_pass_n2_lut (int level, DataType out [], const DataType sf [], long nbr_coef, const DataType cos1_ptr [], const DataType cos2_ptr [], DataType exponent)
+{
+	(void) level;
+	(void) out;
+	(void) sf;
+	(void) nbr_coef;
+	(void) cos1_ptr;
+	(void) cos2_ptr;
+	(void) exponent;
+
+	return (false);
+}
+
+
+
+template <class DT>
+bool	FFTRealSimd <DT>::power_pass_n2_osc (int level, DataType out [], const DataType sf [], long nbr_coef, OscType &osc1, OscType &osc2, DataType exponent)
+{
+	(void) level;
+	(void) out;
+	(void) sf;
+	(void) nbr_coef;
+	(void) osc1;
+	(void) osc2;
+	(void) exponent;
+
+	return (false);
+}
+
+
+
+template <class DT>
+bool	FFTRealSimd <DT>::dct_post (int level, DataType f [], const DataType vf [], const DataType cos_ptr [], const DataType sin_ptr [], long len)
+{
+	(void) level;
+	(void) f;
+	(void) vf;
+	(void) cos_ptr;
+	(void) sin_ptr;
+	(void) len;
+
+	return (false);
+}
+
+
+
+template <class DT>
+bool	FFTRealSimd <DT>::dct_pre (int level, DataType vf [], const DataType f [], const DataType cos_ptr [], const DataType sin_ptr [], long len)
+{
+	(void) level;
+	(void) vf;
+	(void) f;
+	(void) cos_ptr;
+	(void) sin_ptr;
+	(void) len;
+
+	return (false);
+}
+
+
+
+#if defined (ffft_SIMD_SSE2)
+
+// float: SSE2 is always there when the compiler targets it, AVX2 and
+// AVX-512 are checked at run-time.
+
+template <>
+inline int	FFTRealSimd <float>::detect_level ()
+{
+	int					level = SimdLevel_SSE2;
+#if defined (ffft_SIMD_AVX2)
+	if (FFTRealSimdAvx2::is_supported ())
+	{
+		level = SimdLevel_AVX2;
+	}
+#endif
+#if defined (ffft_SIMD_AVX512)
+	if (level == SimdLevel_AVX2 && FFTRealSimdAvx512::is_supported ())
+	{
+		level = SimdLevel_AVX512;
+	}
+#endif
+
+	return (level);
+}
+
+
+
+template <>
+inline bool	FFTRealSimd <float>::direct_pass_1_2 (int level, DataType df [], const DataType x [], const long br_ptr [], long br_step, long len)
+{
+	if (level >= SimdLevel_SSE2 && len >= FFTRealSimdSse2::MIN_LEN_1_2)
+	{
+		FFTRealSimdSse2::direct_pass_1_2 (df, x, br_ptr, br_step, len);
+
+		return (true);
+	}
+
+	return (false);
+}
+
+
+
+template <>
+inline bool	FFTRealSimd <float>::direct_pass_3 (int level, DataType df [], const DataType sf [], long len)
+{
+	if (level >= SimdLevel_SSE2 && len >= FFTRealSimdSse2::MIN_LEN_3)
+	{
+		FFTRealSimdSse2::direct_pass_3 (df, sf, len);
+
+		return (true);
+	}
+
+	return (false);
+}
+
+
+
+template <>
+inline bool	FFTRealSimd <float>::direct_pass_n_lut (int level, DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr [])
+{
+#if defined (ffft_SIMD_AVX512)
+	if (level >= SimdLevel_AVX512 && nbr_coef >= FFTRealSimdAvx512::MIN_NBR_COEF)
+	{
+		FFTRealSimdAvx512::direct_pass_n_lut (df, sf, nbr_coef, len, cos_ptr);
+
+		return (true);
+	}
+#endif
+#if defined (ffft_SIMD_AVX2)
+	if (level >= SimdLevel_AVX2 && nbr_coef >= FFTRealSimdAvx2::MIN_NBR_COEF)
+	{
+		FFTRealSimdAvx2::direct_pass_n_lut (df, sf, nbr_coef, len, cos_ptr);
+
+		return (true);
+	}
+#endif
+	if (level >= SimdLevel_SSE2 && nbr_coef >= FFTRealSimdSse2::MIN_NBR_COEF)
+	{
+		FFTRealSimdSse2::direct_pass_n_lut (df, sf, nbr_coef, len, cos_ptr);
+
+		return (true);
+	}
+
+	return (false);
+}
+
+
+
+template <>
+inline bool	FFTRealSimd <float>::direct_pass_n_osc (int level, DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc)
+{
+#if defined (ffft_SIMD_AVX512)
+	if (level >= SimdLevel_AVX512 && nbr_coef >= FFTRealSimdAvx512::MIN_NBR_COEF)
+	{
+		FFTRealSimdAvx512::direct_pass_n_osc (df, sf, nbr_coef, len, osc);
+
+		return (true);
+	}
+#endif
+#if defined (ffft_SIMD_AVX2)
+	if (level >= SimdLevel_AVX2 && nbr_coef >= FFTRealSimdAvx2::MIN_NBR_COEF)
+	{
+		FFTRealSimdAvx2::direct_pass_n_osc (df, sf, nbr_coef, len, osc);
+
+		return (true);
+	}
+#endif
+	if (level >= SimdLevel_SSE2 && nbr_coef >= FFTRealSimdSse2::MIN_NBR_COEF)
+	{
+		FFTRealSimdSse2::direct_pass_n_osc (df, sf, nbr_coef, len, osc);
+
+		return (true);
+	}
+
+	return (false);
+}
+
+
+
+template <>
+inline bool	FFTRealSimd <float>::inverse_pass_n_lut (int level, DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr [])
+{
+#if defined (ffft_SIMD_AVX512)
+	if (level >= SimdLevel_AVX512 && nbr_coef >= FFTRealSimdAvx512::MIN_NBR_COEF)
+	{
+		FFTRealSimdAvx512::inverse_pass_n_lut (df, sf, nbr_coef, len, cos_ptr);
+
+		return (true);
+	}
+#endif
+#if defined (ffft_SIMD_AVX2)
+	if (level >= SimdLevel_AVX2 && nbr_coef >= FFTRealSimdAvx2::MIN_NBR_COEF)
+	{
+		FFTRealSimdAvx2::inverse_pass_n_lut (df, sf, nbr_coef, len, cos_ptr);
+
+		return (true);
+	}
+#endif
+	if (level >= SimdLevel_SSE2 && nbr_coef >= FFTRealSimdSse2::MIN_NBR_COEF)
+	{
+		FFTRealSimdSse2::inverse_pass_n_lut (df, sf, nbr_coef, len, cos_ptr);
+
+		return (true);
+	}
+
+	return (false);
+}
+
+
+
+template <>
+inline bool	FFTRealSimd <float>::inverse_pass_n_osc (int level, DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc)
+{
+#if defined (ffft_SIMD_AVX512)
+	if (level >= SimdLevel_AVX512 && nbr_coef >= FFTRealSimdAvx512::MIN_NBR_COEF)
+	{
+		FFTRealSimdAvx512::inverse_pass_n_osc (df, sf, nbr_coef, len, osc);
+
+		return (true);
+	}
+#endif
+#if defined (ffft_SIMD_AVX2)
+	if (level >= SimdLevel_AVX2 && nbr_coef >= FFTRealSimdAvx2::MIN_NBR_COEF)
+	{
+		FFTRealSimdAvx2::inverse_pass_n_osc (df, sf, nbr_coef, len, osc);
+
+		return (true);
+	}
+#endif
+	if (level >= SimdLevel_SSE2 && nbr_coef >= FFTRealSimdSse2::MIN_NBR_COEF)
+	{
+		FFTRealSimdSse2::inverse_pass_n_osc (df, sf, nbr_coef, len, osc);
+
+		return (true);
+	}
+
+	return (false);
+}
+
+
+
+template <>
+inline bool	FFTRealSimd <float>::direct_pass_n2_lut (int level, DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr [])
+{
+#if defined (ffft_SIMD_AVX512)
+	if (level >= SimdLevel_AVX512 && nbr_coef >= FFTRealSimdAvx512::MIN_NBR_COEF)
+	{
+		FFTRealSimdAvx512::direct_pass_n2_lut (df, sf, nbr_coef, len, cos1_ptr, cos2_ptr);
+
+		return (true);
+	}
+#endif
+#if defined (ffft_SIMD_AVX2)
+	if (level >= SimdLevel_AVX2 && nbr_coef >= FFTRealSimdAvx2::MIN_NBR_COEF)
+	{
+		FFTRealSimdAvx2::direct_pass_n2_lut (df, sf, nbr_coef, len, cos1_ptr, cos2_ptr);
+
+		return (true);
+	}
+#endif
+	if (level >= SimdLevel_SSE2 && nbr_coef >= FFTRealSimdSse2::MIN_NBR_COEF)
+	{
+		FFTRealSimdSse2::direct_pass_n2_lut (df, sf, nbr_coef, len, cos1_ptr, cos2_ptr);
+
+		return (true);
+	}
+
+	return (false);
+}
+
+
+
+template <>
+inline bool	FFTRealSimd <float>::direct_pass_n2_osc (int level, DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc1, OscType &osc2)
+{
+#if defined (ffft_SIMD_AVX512)
+	if (level >= SimdLevel_AVX512 && nbr_coef >= FFTRealSimdAvx512::MIN_NBR_COEF)
+	{
+		FFTRealSimdAvx512::direct_pass_n2_osc (df, sf, nbr_coef, len, osc1, osc2);
+
+		return (true);
+	}
+#endif
+#if defined (ffft_SIMD_AVX2)
+	if (level >= SimdLevel_AVX2 && nbr_coef >= FFTRealSimdAvx2::MIN_NBR_COEF)
+	{
+		FFTRealSimdAvx2::direct_pass_n2_osc (df, sf, nbr_coef, len, osc1, osc2);
+
+		return (true);
+	}
+#endif
+	if (level >= SimdLevel_SSE2 && nbr_coef >= FFTRealSimdSse2::MIN_NBR_COEF)
+	{
+		FFTRealSimdSse2::direct_pass_n2_osc (df, sf, nbr_coef, len, osc1, osc2);
+
+		return (true);
+	}
+
+	return (false);
+}
+
+
+
+template <>
+inline bool	FFTRealSimd <float>::inverse_pass_n2_lut (int level, DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr [])
+{
+#if defined (ffft_SIMD_AVX512)
+	if (level >= SimdLevel_AVX512 && nbr_coef >= FFTRealSimdAvx512::MIN_NBR_COEF)
+	{
+		FFTRealSimdAvx512::inverse_pass_n2_lut (df, sf, nbr_coef, len, cos1_ptr, cos2_ptr);
+
+		return (true);
+	}
+#endif
+#if defined (ffft_SIMD_AVX2)
+	if (level >= SimdLevel_AVX2 && nbr_coef >= FFTRealSimdAvx2::MIN_NBR_COEF)
+	{
+		FFTRealSimdAvx2::inverse_pass_n2_lut (df, sf, nbr_coef, len, cos1_ptr, cos2_ptr);
+
+		return (true);
+	}
+#endif
+	if (level >= SimdLevel_SSE2 && nbr_coef >= FFTRealSimdSse2::MIN_NBR_COEF)
+	{
+		FFTRealSimdSse2::inverse_pass_n2_lut (df, sf, nbr_coef, len, cos1_ptr, cos2_ptr);
+
+		return (true);
+	}
+
+	return (false);
+}
+
+
+
+template <>
+inline bool	FFTRealSimd <float>::inverse_pass_n2_osc (int level, DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc1, OscType &osc2)
+{
+#if defined (ffft_SIMD_AVX512)
+	if (level >= SimdLevel_AVX512 && nbr_coef >= FFTRealSimdAvx512::MIN_NBR_COEF)
+	{
+		FFTRealSimdAvx512::inverse_pass_n2_osc (df, sf, nbr_coef, len, osc1, osc2);
+
+		return (true);
+	}
+#endif
+#if defined (ffft_SIMD_AVX2)
+	if (level >= SimdLevel_AVX2 && nbr_coef >= FFTRealSimdAvx2::MIN_NBR_COEF)
+	{
+		FFTRealSimdAvx2::inverse_pass_n2_osc (df, sf, nbr_coef, len, osc1, osc2);
+
+		return (true);
+	}
+#endif
+	if (level >= SimdLevel_SSE2 && nbr_coef >= FFTRealSimdSse2::MIN_NBR_COEF)
+	{
+		FFTRealSimdSse2::inverse_pass_n2_osc (df, sf, nbr_coef, len, osc1, osc2);
+
+		return (true);
+	}
+
+	return (false);
+}
+
+
+
+template <>
+inline bool	FFTRealSimd <float>::inverse_pass_3 (int level, DataType df [], const DataType sf [], long len)
+{
+	if (level >= SimdLevel_SSE2 && len >= FFTRealSimdSse2::MIN_LEN_3)
+	{
+		FFTRealSimdSse2::inverse_pass_3 (df, sf, len);
+
+		return (true);
+	}
+
+	return (false);
+}
+
+
+
+template <>
+inline bool	FFTRealSimd <float>::inverse_pass_1_2 (int level, DataType x [], const DataType sf [], const long br_ptr [], long br_step, long len)
+{
+	if (level >= SimdLevel_SSE2 && len >= FFTRealSimdSse2::MIN_LEN_1_2)
+	{
+		FFTRealSimdSse2::inverse_pass_1_2 (x, sf, br_ptr, br_step, len);
+
+		return (true);
+	}
+
+	return (false);
+}
+
+
+
+template <>
+inline bool	FFTRealSimd <float>::complex_pass_4 (int level, DataType dr [], DataType di [], const DataType sr [], const DataType si [], long nbr_coef, long stride, const DataType tw_ptr [])
+{
+	if (level >= SimdLevel_SSE2 && FFTRealSimdSse2::is_complex_pass_4_ok (nbr_coef, stride))
+	{
+		FFTRealSimdSse2::complex_pass_4 (dr, di, sr, si, nbr_coef, stride, tw_ptr);
+
+		return (true);
+	}
+
+	return (false);
+}
+
+
+
+template <>
+inline bool	FFTRealSimd <float>::complex_pass_2 (int level, DataType dr [], DataType di [], const DataType sr [], const DataType si [], long stride)
+{
+	if (level >= SimdLevel_SSE2 && stride >= FFTRealSimdSse2::NBR_ELT)
+	{
+		FFTRealSimdSse2::complex_pass_2 (dr, di, sr, si, stride);
+
+		return (true);
+	}
+
+	return (false);
+}
+
+
+
+template <>
+inline bool	FFTRealSimd <float>::power_cbrt (int level, DataType out [], const DataType f [], long len)
+{
+	if (level >= SimdLevel_SSE2 && len >= FFTRealSimdSse2::MIN_LEN_POWER)
+	{
+		FFTRealSimdSse2::power_cbrt (out, f, len);
+
+		return (true);
+	}
+
+	return (false);
+}
+
+
+
+// SSE2 only: the raising dominates, wider vectors gain little on it
+template <>
+inline bool	FFTRealSimd <float>::power_pass_n2_lut (int level, DataType out [], const DataType sf [], long nbr_coef, const DataType cos1_ptr [], const DataType cos2_ptr [], DataType exponent)
+{
+	if (level >= SimdLevel_SSE2 && nbr_coef >= FFTRealSimdSse2::MIN_NBR_COEF)
+	{
+		FFTRealSimdSse2::power_pass_n2_lut (
+			out, sf, nbr_coef, cos1_ptr, cos2_ptr, exponent
+		);
+
+		return (true);
+	}
+
+	return (false);
+}
+
+
+
+template <>
+inline bool	FFTRealSimd <float>::power_pass_n2_osc (int level, DataType out [], const DataType sf [], long nbr_coef, OscType &osc1, OscType &osc2, DataType exponent)
+{
+	if (level >= SimdLevel_SSE2 && nbr_coef >= FFTRealSimdSse2::MIN_NBR_COEF)
+	{
+		FFTRealSimdSse2::power_pass_n2_osc (
+			out, sf, nbr_coef, osc1, osc2, exponent
+		);
+
+		return (true);
+	}
+
+	return (false);
+}
+
+
+
+template <>
+inline bool	FFTRealSimd <float>::dct_post (int level, DataType f [], const DataType vf [], const DataType cos_ptr [], const DataType sin_ptr [], long len)
+{
+	if (level >= SimdLevel_SSE2 && len >= FFTRealSimdSse2::MIN_LEN_DCT)
+	{
+		FFTRealSimdSse2::dct_post (f, vf, cos_ptr, sin_ptr, len);
+
+		return (true);
+	}
+
+	return (false);
+}
+
+
+
+template <>
+inline bool	FFTRealSimd <float>::dct_pre (int level, DataType vf [], const DataType f [], const DataType cos_ptr [], const DataType sin_ptr [], long len)
+{
+	if (level >= SimdLevel_SSE2 && len >= FFTRealSimdSse2::MIN_LEN_DCT)
+	{
+		FFTRealSimdSse2::dct_pre (vf, f, cos_ptr, sin_ptr, len);
+
+		return (true);
+	}
+
+	return (false);
+}
+
+#endif	// ffft_SIMD_SSE2
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <class DT>
+int &	FFTRealSimd <DT>::use_level ()
+{
+	// Detected on first use
+	static int			level = clip_level (ffft_SIMD_FORCE_LEVEL);
+
+	return (level);
+}
+
+
+
+template <class DT>
+int	FFTRealSimd <DT>::clip_level (int level)
+{
+	assert (level >= SimdLevel_AUTO);
+	assert (level <= SimdLevel_AVX512);
+
+	const int		detected = detect_level ();
+	if (level == SimdLevel_AUTO || level > detected)
+	{
+		level = detected;
+	}
+
+	return (level);
+}
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_FFTRealSimd_CODEHEADER_INCLUDED
+
+#undef ffft_FFTRealSimd_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,153 @@
+/*****************************************************************************
+
+        FFTRealSimdAvx512.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_FFTRealSimdAvx512_HEADER_INCLUDED)
+#define	ffft_FFTRealSimdAvx512_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/def.h"
+#include	"ffft/FFTRealRadix4.h"
+#include	"ffft/OscSinCos.h"
+#include	"ffft/OscSinCosLanes.h"
+
+#if defined (_MSC_VER)
+	#include	<intrin.h>
+#endif
+#include	<immintrin.h>
+
+
+
+namespace ffft
+{
+
+
+
+// AVX-512 (F subset) versions of the generic FFTReal passes, 16 butterflies
+// per instruction. Same layout as FFTRealSimdAvx2, only the vectors are
+// wider, so they only pay off from 64 coefficients per pass.
+// With GCC and Clang the functions are compiled for AVX-512 whatever the
+// command line says. Don't call them unless is_supported() returns true.
+class FFTRealSimdAvx512
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	float	DataType;
+	typedef	OscSinCos <DataType>	OscType;
+
+	enum {			NBR_ELT		= 16	};
+	typedef	OscSinCosLanes <DataType, NBR_ELT>	OscLanes;
+	enum {			MIN_NBR_COEF	= NBR_ELT * 4	};
+
+	static inline bool
+							is_supported ();
+
+	ffft_TARGET_AVX512 static inline void
+							direct_pass_n_lut (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr []);
+	ffft_TARGET_AVX512 static inline void
+							direct_pass_n_osc (DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc);
+
+	ffft_TARGET_AVX512 static inline void
+							inverse_pass_n_lut (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr []);
+	ffft_TARGET_AVX512 static inline void
+							inverse_pass_n_osc (DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc);
+
+	ffft_TARGET_AVX512 static inline void
+							direct_pass_n2_lut (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr []);
+	ffft_TARGET_AVX512 static inline void
+							direct_pass_n2_osc (DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc1, OscType &osc2);
+	ffft_TARGET_AVX512 static inline void
+							inverse_pass_n2_lut (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr []);
+	ffft_TARGET_AVX512 static inline void
+							inverse_pass_n2_osc (DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc1, OscType &osc2);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	ffft_TARGET_AVX512 ffft_FORCEINLINE static __m512
+							reverse (__m512 v);
+	ffft_TARGET_AVX512 ffft_FORCEINLINE static void
+							step_osc (OscLanes &osc, __m512 &c, __m512 &s);
+
+	ffft_FORCEINLINE static void
+							direct_extremes (DataType df [], const DataType sf [], long nbr_coef);
+	ffft_TARGET_AVX512 ffft_FORCEINLINE static void
+							direct_butterfly (DataType df [], const DataType sf [], long nbr_coef, long i, __m512 c, __m512 s);
+	ffft_FORCEINLINE static void
+							direct_butterfly (DataType df [], const DataType sf [], long nbr_coef, long i, DataType c, DataType s);
+
+	ffft_FORCEINLINE static void
+							inverse_extremes (DataType df [], const DataType sf [], long nbr_coef);
+	ffft_TARGET_AVX512 ffft_FORCEINLINE static void
+							inverse_butterfly (DataType df [], const DataType sf [], long nbr_coef, long i, __m512 c, __m512 s);
+	ffft_FORCEINLINE static void
+							inverse_butterfly (DataType df [], const DataType sf [], long nbr_coef, long i, DataType c, DataType s);
+
+	ffft_TARGET_AVX512 ffft_FORCEINLINE static void
+							direct_butterfly_n2 (DataType df [], const DataType sf [], long nbr_coef, long i, __m512 c1, __m512 s1, __m512 c2, __m512 s2);
+	ffft_TARGET_AVX512 ffft_FORCEINLINE static void
+							inverse_butterfly_n2 (DataType df [], const DataType sf [], long nbr_coef, long i, __m512 c1, __m512 s1, __m512 c2, __m512 s2);
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+							FFTRealSimdAvx512 ();
+							~FFTRealSimdAvx512 ();
+							FFTRealSimdAvx512 (const FFTRealSimdAvx512 &other);
+	FFTRealSimdAvx512 &
+							operator = (const FFTRealSimdAvx512 &other);
+	bool				operator == (const FFTRealSimdAvx512 &other);
+	bool				operator != (const FFTRealSimdAvx512 &other);
+
+};	// class FFTRealSimdAvx512
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/FFTRealSimdAvx512.hpp"
+
+
+
+#endif	// ffft_FFTRealSimdAvx512_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
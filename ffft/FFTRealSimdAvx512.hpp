@@ -0,0 +1,730 @@
+/*****************************************************************************
+
+        FFTRealSimdAvx512.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_FFTRealSimdAvx512_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealSimdAvx512 code header.
+#endif
+#define	ffft_FFTRealSimdAvx512_CURRENT_CODEHEADER
+
+#if ! defined (ffft_FFTRealSimdAvx512_CODEHEADER_INCLUDED)
+#define	ffft_FFTRealSimdAvx512_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// Checks both the CPU and the OS support (saved ZMM and opmask registers).
+bool	FFTRealSimdAvx512::is_supported ()
+{
+#if defined (_MSC_VER)
+
+	int					info [4];
+	__cpuid (info, 0);
+	if (info [0] < 7)
+	{
+		return (false);
+	}
+
+	__cpuid (info, 1);
+	const int			osxsave_avx = (1 << 27) | (1 << 28);
+	if ((info [2] & osxsave_avx) != osxsave_avx)
+	{
+		return (false);
+	}
+	if ((_xgetbv (0) & 0xE6) != 0xE6)
+	{
+		return (false);
+	}
+
+	__cpuidex (info, 7, 0);
+
+	return ((info [1] & (1 << 16)) != 0);
+
+#else
+
+	__builtin_cpu_init ();
+
+	return (__builtin_cpu_supports ("avx512f") != 0);
+
+#endif
+}
+
+
+
+// See FFTRealSimdSse2::direct_pass_n_lut()
+ffft_TARGET_AVX512 void	FFTRealSimdAvx512::direct_pass_n_lut (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr [])
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (nbr_coef >= MIN_NBR_COEF);
+	assert (len >= nbr_coef * 2);
+	assert (cos_ptr != 0);
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		direct_extremes (dfb, sfb, nbr_coef);
+
+		// Overlapping last vector
+		long				i = 1;
+		do
+		{
+			if (i > h_nbr_coef - NBR_ELT)
+			{
+				i = h_nbr_coef - NBR_ELT;
+			}
+
+			const __m512	c = _mm512_loadu_ps (cos_ptr + i);
+			const __m512	s = reverse (_mm512_loadu_ps (cos_ptr + h_nbr_coef - i - (NBR_ELT - 1)));
+			direct_butterfly (dfb, sfb, nbr_coef, i, c, s);
+
+			i += NBR_ELT;
+		}
+		while (i < h_nbr_coef);
+
+		coef_index += d_nbr_coef;
+	}
+	while (coef_index < len);
+}
+
+
+
+ffft_TARGET_AVX512 void	FFTRealSimdAvx512::direct_pass_n_osc (DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc)
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (nbr_coef >= MIN_NBR_COEF);
+	assert (len >= nbr_coef * 2);
+
+	OscLanes			lanes;
+	lanes.set_step (osc.get_step ());
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		lanes.clear_buffers ();
+
+		direct_extremes (dfb, sfb, nbr_coef);
+
+		long				i = 1;
+		for ( ; i + NBR_ELT <= h_nbr_coef; i += NBR_ELT)
+		{
+			__m512			c;
+			__m512			s;
+			step_osc (lanes, c, s);
+			direct_butterfly (dfb, sfb, nbr_coef, i, c, s);
+		}
+		// Lanes left in the last group
+		for (int lane = 0; i < h_nbr_coef; ++ i, ++ lane)
+		{
+			direct_butterfly (dfb, sfb, nbr_coef, i, lanes.get_cos (lane), lanes.get_sin (lane));
+		}
+
+		coef_index += d_nbr_coef;
+	}
+	while (coef_index < len);
+}
+
+
+
+ffft_TARGET_AVX512 void	FFTRealSimdAvx512::inverse_pass_n_lut (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr [])
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (nbr_coef >= MIN_NBR_COEF);
+	assert (len >= nbr_coef * 2);
+	assert (cos_ptr != 0);
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		inverse_extremes (dfb, sfb, nbr_coef);
+
+		long				i = 1;
+		do
+		{
+			if (i > h_nbr_coef - NBR_ELT)
+			{
+				i = h_nbr_coef - NBR_ELT;
+			}
+
+			const __m512	c = _mm512_loadu_ps (cos_ptr + i);
+			const __m512	s = reverse (_mm512_loadu_ps (cos_ptr + h_nbr_coef - i - (NBR_ELT - 1)));
+			inverse_butterfly (dfb, sfb, nbr_coef, i, c, s);
+
+			i += NBR_ELT;
+		}
+		while (i < h_nbr_coef);
+
+		coef_index += d_nbr_coef;
+	}
+	while (coef_index < len);
+}
+
+
+
+ffft_TARGET_AVX512 void	FFTRealSimdAvx512::inverse_pass_n_osc (DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc)
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (nbr_coef >= MIN_NBR_COEF);
+	assert (len >= nbr_coef * 2);
+
+	OscLanes			lanes;
+	lanes.set_step (osc.get_step ());
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		lanes.clear_buffers ();
+
+		inverse_extremes (dfb, sfb, nbr_coef);
+
+		long				i = 1;
+		for ( ; i + NBR_ELT <= h_nbr_coef; i += NBR_ELT)
+		{
+			__m512			c;
+			__m512			s;
+			step_osc (lanes, c, s);
+			inverse_butterfly (dfb, sfb, nbr_coef, i, c, s);
+		}
+		// Lanes left in the last group
+		for (int lane = 0; i < h_nbr_coef; ++ i, ++ lane)
+		{
+			inverse_butterfly (dfb, sfb, nbr_coef, i, lanes.get_cos (lane), lanes.get_sin (lane));
+		}
+
+		coef_index += d_nbr_coef;
+	}
+	while (coef_index < len);
+}
+
+
+
+// Two passes at once, see FFTRealRadix4. nbr_coef is the size of the first
+// one, cos1_ptr and cos2_ptr are the tables of both passes.
+ffft_TARGET_AVX512 void	FFTRealSimdAvx512::direct_pass_n2_lut (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr [])
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (nbr_coef >= MIN_NBR_COEF);
+	assert (len >= nbr_coef * 4);
+	assert (cos1_ptr != 0);
+	assert (cos2_ptr != 0);
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		q_nbr_coef = nbr_coef << 2;
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		FFTRealRadix4 <DataType>::direct_extremes (dfb, sfb, nbr_coef);
+
+		// Overlapping last vector
+		long				i = 1;
+		do
+		{
+			if (i > h_nbr_coef - NBR_ELT)
+			{
+				i = h_nbr_coef - NBR_ELT;
+			}
+
+			const __m512	c1 = _mm512_loadu_ps (cos1_ptr + i);
+			const __m512	s1 = reverse (_mm512_loadu_ps (cos1_ptr + h_nbr_coef - i - (NBR_ELT - 1)));
+			const __m512	c2 = _mm512_loadu_ps (cos2_ptr + i);
+			const __m512	s2 = reverse (_mm512_loadu_ps (cos2_ptr + nbr_coef - i - (NBR_ELT - 1)));
+			direct_butterfly_n2 (dfb, sfb, nbr_coef, i, c1, s1, c2, s2);
+
+			i += NBR_ELT;
+		}
+		while (i < h_nbr_coef);
+
+		coef_index += q_nbr_coef;
+	}
+	while (coef_index < len);
+}
+
+
+
+ffft_TARGET_AVX512 void	FFTRealSimdAvx512::direct_pass_n2_osc (DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc1, OscType &osc2)
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (nbr_coef >= MIN_NBR_COEF);
+	assert (len >= nbr_coef * 4);
+
+	OscLanes			lanes1;
+	OscLanes			lanes2;
+	lanes1.set_step (osc1.get_step ());
+	lanes2.set_step (osc2.get_step ());
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		q_nbr_coef = nbr_coef << 2;
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		lanes1.clear_buffers ();
+		lanes2.clear_buffers ();
+
+		FFTRealRadix4 <DataType>::direct_extremes (dfb, sfb, nbr_coef);
+
+		long				i = 1;
+		for ( ; i + NBR_ELT <= h_nbr_coef; i += NBR_ELT)
+		{
+			__m512			c1;
+			__m512			s1;
+			__m512			c2;
+			__m512			s2;
+			step_osc (lanes1, c1, s1);
+			step_osc (lanes2, c2, s2);
+			direct_butterfly_n2 (dfb, sfb, nbr_coef, i, c1, s1, c2, s2);
+		}
+		for (int lane = 0; i < h_nbr_coef; ++ i, ++ lane)
+		{
+			FFTRealRadix4 <DataType>::direct_butterfly (
+				dfb, sfb, nbr_coef, i,
+				lanes1.get_cos (lane), lanes1.get_sin (lane),
+				lanes2.get_cos (lane), lanes2.get_sin (lane)
+			);
+		}
+
+		coef_index += q_nbr_coef;
+	}
+	while (coef_index < len);
+}
+
+
+
+ffft_TARGET_AVX512 void	FFTRealSimdAvx512::inverse_pass_n2_lut (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr [])
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (nbr_coef >= MIN_NBR_COEF);
+	assert (len >= nbr_coef * 4);
+	assert (cos1_ptr != 0);
+	assert (cos2_ptr != 0);
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		q_nbr_coef = nbr_coef << 2;
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		FFTRealRadix4 <DataType>::inverse_extremes (dfb, sfb, nbr_coef);
+
+		long				i = 1;
+		do
+		{
+			if (i > h_nbr_coef - NBR_ELT)
+			{
+				i = h_nbr_coef - NBR_ELT;
+			}
+
+			const __m512	c1 = _mm512_loadu_ps (cos1_ptr + i);
+			const __m512	s1 = reverse (_mm512_loadu_ps (cos1_ptr + h_nbr_coef - i - (NBR_ELT - 1)));
+			const __m512	c2 = _mm512_loadu_ps (cos2_ptr + i);
+			const __m512	s2 = reverse (_mm512_loadu_ps (cos2_ptr + nbr_coef - i - (NBR_ELT - 1)));
+			inverse_butterfly_n2 (dfb, sfb, nbr_coef, i, c1, s1, c2, s2);
+
+			i += NBR_ELT;
+		}
+		while (i < h_nbr_coef);
+
+		coef_index += q_nbr_coef;
+	}
+	while (coef_index < len);
+}
+
+
+
+ffft_TARGET_AVX512 void	FFTRealSimdAvx512::inverse_pass_n2_osc (DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc1, OscType &osc2)
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (nbr_coef >= MIN_NBR_COEF);
+	assert (len >= nbr_coef * 4);
+
+	OscLanes			lanes1;
+	OscLanes			lanes2;
+	lanes1.set_step (osc1.get_step ());
+	lanes2.set_step (osc2.get_step ());
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		q_nbr_coef = nbr_coef << 2;
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		lanes1.clear_buffers ();
+		lanes2.clear_buffers ();
+
+		FFTRealRadix4 <DataType>::inverse_extremes (dfb, sfb, nbr_coef);
+
+		long				i = 1;
+		for ( ; i + NBR_ELT <= h_nbr_coef; i += NBR_ELT)
+		{
+			__m512			c1;
+			__m512			s1;
+			__m512			c2;
+			__m512			s2;
+			step_osc (lanes1, c1, s1);
+			step_osc (lanes2, c2, s2);
+			inverse_butterfly_n2 (dfb, sfb, nbr_coef, i, c1, s1, c2, s2);
+		}
+		for (int lane = 0; i < h_nbr_coef; ++ i, ++ lane)
+		{
+			FFTRealRadix4 <DataType>::inverse_butterfly (
+				dfb, sfb, nbr_coef, i,
+				lanes1.get_cos (lane), lanes1.get_sin (lane),
+				lanes2.get_cos (lane), lanes2.get_sin (lane)
+			);
+		}
+
+		coef_index += q_nbr_coef;
+	}
+	while (coef_index < len);
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+ffft_TARGET_AVX512 __m512	FFTRealSimdAvx512::reverse (__m512 v)
+{
+	// The masked form avoids GCC's _mm512_undefined_ps() warning
+	return (_mm512_mask_permutexvar_ps (
+		v,
+		__mmask16 (0xFFFF),
+		_mm512_setr_epi32 (15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0),
+		v
+	));
+}
+
+
+
+ffft_TARGET_AVX512 void	FFTRealSimdAvx512::step_osc (OscLanes &osc, __m512 &c, __m512 &s)
+{
+	c = _mm512_loadu_ps (osc.use_cos ());
+	s = _mm512_loadu_ps (osc.use_sin ());
+	osc.step ();
+}
+
+
+
+void	FFTRealSimdAvx512::direct_extremes (DataType df [], const DataType sf [], long nbr_coef)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const DataType * const	sf2r = sf + nbr_coef;
+	DataType * const	dfi = df + nbr_coef;
+
+	// Extreme coefficients are always real
+	df [0] = sf [0] + sf2r [0];
+	dfi [0] = sf [0] - sf2r [0];
+	df [h_nbr_coef] = sf [h_nbr_coef];
+	dfi [h_nbr_coef] = sf2r [h_nbr_coef];
+}
+
+
+
+ffft_TARGET_AVX512 void	FFTRealSimdAvx512::direct_butterfly (DataType df [], const DataType sf [], long nbr_coef, long i, __m512 c, __m512 s)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const DataType * const	sf1r = sf;
+	const DataType * const	sf1i = sf1r + h_nbr_coef;
+	const DataType * const	sf2r = sf1r + nbr_coef;
+	const DataType * const	sf2i = sf2r + h_nbr_coef;
+	DataType * const	dfr = df;
+	DataType * const	dfi = dfr + nbr_coef;
+
+	const __m512	sf1r_i = _mm512_loadu_ps (sf1r + i);
+	const __m512	sf1i_i = _mm512_loadu_ps (sf1i + i);
+	const __m512	sf2r_i = _mm512_loadu_ps (sf2r + i);
+	const __m512	sf2i_i = _mm512_loadu_ps (sf2i + i);
+
+	const __m512	v1 = _mm512_sub_ps (_mm512_mul_ps (sf2r_i, c), _mm512_mul_ps (sf2i_i, s));
+	_mm512_storeu_ps (dfr + i, _mm512_add_ps (sf1r_i, v1));
+	_mm512_storeu_ps (dfi - i - (NBR_ELT - 1), reverse (_mm512_sub_ps (sf1r_i, v1)));
+
+	const __m512	v2 = _mm512_add_ps (_mm512_mul_ps (sf2r_i, s), _mm512_mul_ps (sf2i_i, c));
+	_mm512_storeu_ps (dfi + i, _mm512_add_ps (v2, sf1i_i));
+	_mm512_storeu_ps (dfi + nbr_coef - i - (NBR_ELT - 1), reverse (_mm512_sub_ps (v2, sf1i_i)));
+}
+
+
+
+void	FFTRealSimdAvx512::direct_butterfly (DataType df [], const DataType sf [], long nbr_coef, long i, DataType c, DataType s)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const DataType * const	sf1r = sf;
+	const DataType * const	sf1i = sf1r + h_nbr_coef;
+	const DataType * const	sf2r = sf1r + nbr_coef;
+	const DataType * const	sf2i = sf2r + h_nbr_coef;
+	DataType * const	dfr = df;
+	DataType * const	dfi = dfr + nbr_coef;
+
+	DataType			v;
+
+	v = sf2r [i] * c - sf2i [i] * s;
+	dfr [i] = sf1r [i] + v;
+	dfi [-i] = sf1r [i] - v;
+
+	v = sf2r [i] * s + sf2i [i] * c;
+	dfi [i] = v + sf1i [i];
+	dfi [nbr_coef - i] = v - sf1i [i];
+}
+
+
+
+void	FFTRealSimdAvx512::inverse_extremes (DataType df [], const DataType sf [], long nbr_coef)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const DataType * const	sfi = sf + nbr_coef;
+	DataType * const	df2r = df + nbr_coef;
+
+	// Extreme coefficients are always real
+	df [0] = sf [0] + sfi [0];
+	df2r [0] = sf [0] - sfi [0];
+	df [h_nbr_coef] = sf [h_nbr_coef] * 2;
+	df2r [h_nbr_coef] = sfi [h_nbr_coef] * 2;
+}
+
+
+
+ffft_TARGET_AVX512 void	FFTRealSimdAvx512::inverse_butterfly (DataType df [], const DataType sf [], long nbr_coef, long i, __m512 c, __m512 s)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const DataType * const	sfr = sf;
+	const DataType * const	sfi = sfr + nbr_coef;
+	DataType * const	df1r = df;
+	DataType * const	df1i = df1r + h_nbr_coef;
+	DataType * const	df2r = df1r + nbr_coef;
+	DataType * const	df2i = df2r + h_nbr_coef;
+
+	const __m512	sfr_i = _mm512_loadu_ps (sfr + i);
+	const __m512	sfr_ni = reverse (_mm512_loadu_ps (sfi - i - (NBR_ELT - 1)));
+	const __m512	sfi_i = _mm512_loadu_ps (sfi + i);
+	const __m512	sfi_ni = reverse (_mm512_loadu_ps (sfi + nbr_coef - i - (NBR_ELT - 1)));
+
+	_mm512_storeu_ps (df1r + i, _mm512_add_ps (sfr_i, sfr_ni));
+	_mm512_storeu_ps (df1i + i, _mm512_sub_ps (sfi_i, sfi_ni));
+
+	const __m512	vr = _mm512_sub_ps (sfr_i, sfr_ni);
+	const __m512	vi = _mm512_add_ps (sfi_i, sfi_ni);
+
+	_mm512_storeu_ps (df2r + i, _mm512_add_ps (_mm512_mul_ps (vr, c), _mm512_mul_ps (vi, s)));
+	_mm512_storeu_ps (df2i + i, _mm512_sub_ps (_mm512_mul_ps (vi, c), _mm512_mul_ps (vr, s)));
+}
+
+
+
+void	FFTRealSimdAvx512::inverse_butterfly (DataType df [], const DataType sf [], long nbr_coef, long i, DataType c, DataType s)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const DataType * const	sfr = sf;
+	const DataType * const	sfi = sfr + nbr_coef;
+	DataType * const	df1r = df;
+	DataType * const	df1i = df1r + h_nbr_coef;
+	DataType * const	df2r = df1r + nbr_coef;
+	DataType * const	df2i = df2r + h_nbr_coef;
+
+	df1r [i] = sfr [i] + sfi [-i];
+	df1i [i] = sfi [i] - sfi [nbr_coef - i];
+
+	const DataType	vr = sfr [i] - sfi [-i];
+	const DataType	vi = sfi [i] + sfi [nbr_coef - i];
+
+	df2r [i] = vr * c + vi * s;
+	df2i [i] = vi * c - vr * s;
+}
+
+
+
+// Vector version of FFTRealRadix4::direct_butterfly(). Stores going
+// backward are reversed.
+ffft_TARGET_AVX512 void	FFTRealSimdAvx512::direct_butterfly_n2 (DataType df [], const DataType sf [], long nbr_coef, long i, __m512 c1, __m512 s1, __m512 c2, __m512 s2)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	const long		last = NBR_ELT - 1;
+	const DataType * const	sfa = sf;
+	const DataType * const	sfb = sf + d_nbr_coef;
+
+	__m512			v;
+
+	// First pass, both half-blocks
+	const __m512	a1r = _mm512_loadu_ps (sfa + i);
+	const __m512	a1i = _mm512_loadu_ps (sfa + h_nbr_coef + i);
+	const __m512	a2r = _mm512_loadu_ps (sfa + nbr_coef + i);
+	const __m512	a2i = _mm512_loadu_ps (sfa + nbr_coef + h_nbr_coef + i);
+	v = _mm512_sub_ps (_mm512_mul_ps (a2r, c1), _mm512_mul_ps (a2i, s1));
+	const __m512	a_i = _mm512_add_ps (a1r, v);
+	const __m512	a_ni = _mm512_sub_ps (a1r, v);
+	v = _mm512_add_ps (_mm512_mul_ps (a2r, s1), _mm512_mul_ps (a2i, c1));
+	const __m512	a_pi = _mm512_add_ps (v, a1i);
+	const __m512	a_dni = _mm512_sub_ps (v, a1i);
+
+	const __m512	b1r = _mm512_loadu_ps (sfb + i);
+	const __m512	b1i = _mm512_loadu_ps (sfb + h_nbr_coef + i);
+	const __m512	b2r = _mm512_loadu_ps (sfb + nbr_coef + i);
+	const __m512	b2i = _mm512_loadu_ps (sfb + nbr_coef + h_nbr_coef + i);
+	v = _mm512_sub_ps (_mm512_mul_ps (b2r, c1), _mm512_mul_ps (b2i, s1));
+	const __m512	b_i = _mm512_add_ps (b1r, v);
+	const __m512	b_ni = _mm512_sub_ps (b1r, v);
+	v = _mm512_add_ps (_mm512_mul_ps (b2r, s1), _mm512_mul_ps (b2i, c1));
+	const __m512	b_pi = _mm512_add_ps (v, b1i);
+	const __m512	b_dni = _mm512_sub_ps (v, b1i);
+
+	// Second pass at i
+	v = _mm512_sub_ps (_mm512_mul_ps (b_i, c2), _mm512_mul_ps (b_pi, s2));
+	_mm512_storeu_ps (df + i, _mm512_add_ps (a_i, v));
+	_mm512_storeu_ps (df + d_nbr_coef - i - last, reverse (_mm512_sub_ps (a_i, v)));
+	v = _mm512_add_ps (_mm512_mul_ps (b_i, s2), _mm512_mul_ps (b_pi, c2));
+	_mm512_storeu_ps (df + d_nbr_coef + i, _mm512_add_ps (v, a_pi));
+	_mm512_storeu_ps (df + (d_nbr_coef << 1) - i - last, reverse (_mm512_sub_ps (v, a_pi)));
+
+	// Second pass at nbr_coef - i
+	v = _mm512_sub_ps (_mm512_mul_ps (b_ni, s2), _mm512_mul_ps (b_dni, c2));
+	_mm512_storeu_ps (df + nbr_coef - i - last, reverse (_mm512_add_ps (a_ni, v)));
+	_mm512_storeu_ps (df + nbr_coef + i, _mm512_sub_ps (a_ni, v));
+	v = _mm512_add_ps (_mm512_mul_ps (b_ni, c2), _mm512_mul_ps (b_dni, s2));
+	_mm512_storeu_ps (df + nbr_coef * 3 - i - last, reverse (_mm512_add_ps (v, a_dni)));
+	_mm512_storeu_ps (df + nbr_coef * 3 + i, _mm512_sub_ps (v, a_dni));
+}
+
+
+
+// Vector version of FFTRealRadix4::inverse_butterfly(). Loads going backward
+// are reversed.
+ffft_TARGET_AVX512 void	FFTRealSimdAvx512::inverse_butterfly_n2 (DataType df [], const DataType sf [], long nbr_coef, long i, __m512 c1, __m512 s1, __m512 c2, __m512 s2)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	const long		last = NBR_ELT - 1;
+	DataType * const	dfa = df;
+	DataType * const	dfb = df + d_nbr_coef;
+
+	__m512			vr;
+	__m512			vi;
+
+	// First pass (nbr_coef * 2) at i
+	const __m512	r_i = _mm512_loadu_ps (sf + i);
+	const __m512	r_ni = reverse (_mm512_loadu_ps (sf + d_nbr_coef - i - last));
+	const __m512	i_i = _mm512_loadu_ps (sf + d_nbr_coef + i);
+	const __m512	i_ni = reverse (_mm512_loadu_ps (sf + (d_nbr_coef << 1) - i - last));
+	const __m512	a_i = _mm512_add_ps (r_i, r_ni);
+	const __m512	a_pi = _mm512_sub_ps (i_i, i_ni);
+	vr = _mm512_sub_ps (r_i, r_ni);
+	vi = _mm512_add_ps (i_i, i_ni);
+	const __m512	b_i = _mm512_add_ps (_mm512_mul_ps (vr, c2), _mm512_mul_ps (vi, s2));
+	const __m512	b_pi = _mm512_sub_ps (_mm512_mul_ps (vi, c2), _mm512_mul_ps (vr, s2));
+
+	// First pass at nbr_coef - i
+	const __m512	r_j = reverse (_mm512_loadu_ps (sf + nbr_coef - i - last));
+	const __m512	r_nj = _mm512_loadu_ps (sf + nbr_coef + i);
+	const __m512	i_j = reverse (_mm512_loadu_ps (sf + nbr_coef * 3 - i - last));
+	const __m512	i_nj = _mm512_loadu_ps (sf + nbr_coef * 3 + i);
+	const __m512	a_ni = _mm512_add_ps (r_j, r_nj);
+	const __m512	a_dni = _mm512_sub_ps (i_j, i_nj);
+	vr = _mm512_sub_ps (r_j, r_nj);
+	vi = _mm512_add_ps (i_j, i_nj);
+	const __m512	b_ni = _mm512_add_ps (_mm512_mul_ps (vr, s2), _mm512_mul_ps (vi, c2));
+	const __m512	b_dni = _mm512_sub_ps (_mm512_mul_ps (vi, s2), _mm512_mul_ps (vr, c2));
+
+	// Second pass (nbr_coef), both half-blocks
+	_mm512_storeu_ps (dfa + i, _mm512_add_ps (a_i, a_ni));
+	_mm512_storeu_ps (dfa + h_nbr_coef + i, _mm512_sub_ps (a_pi, a_dni));
+	vr = _mm512_sub_ps (a_i, a_ni);
+	vi = _mm512_add_ps (a_pi, a_dni);
+	_mm512_storeu_ps (dfa + nbr_coef + i, _mm512_add_ps (_mm512_mul_ps (vr, c1), _mm512_mul_ps (vi, s1)));
+	_mm512_storeu_ps (dfa + nbr_coef + h_nbr_coef + i, _mm512_sub_ps (_mm512_mul_ps (vi, c1), _mm512_mul_ps (vr, s1)));
+
+	_mm512_storeu_ps (dfb + i, _mm512_add_ps (b_i, b_ni));
+	_mm512_storeu_ps (dfb + h_nbr_coef + i, _mm512_sub_ps (b_pi, b_dni));
+	vr = _mm512_sub_ps (b_i, b_ni);
+	vi = _mm512_add_ps (b_pi, b_dni);
+	_mm512_storeu_ps (dfb + nbr_coef + i, _mm512_add_ps (_mm512_mul_ps (vr, c1), _mm512_mul_ps (vi, s1)));
+	_mm512_storeu_ps (dfb + nbr_coef + h_nbr_coef + i, _mm512_sub_ps (_mm512_mul_ps (vi, c1), _mm512_mul_ps (vr, s1)));
+}
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_FFTRealSimdAvx512_CODEHEADER_INCLUDED
+
+#undef ffft_FFTRealSimdAvx512_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
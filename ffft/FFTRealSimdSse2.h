@@ -0,0 +1,206 @@
+/*****************************************************************************
+
+        FFTRealSimdSse2.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_FFTRealSimdSse2_HEADER_INCLUDED)
+#define	ffft_FFTRealSimdSse2_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/def.h"
+#include	"ffft/FFTRealRadix4.h"
+#include	"ffft/OscSinCos.h"
+#include	"ffft/OscSinCosLanes.h"
+
+#include	<emmintrin.h>
+
+
+
+namespace ffft
+{
+
+
+
+// SSE2 versions of the FFTReal passes, 4 butterflies per instruction.
+// Data layout and pass numbering are the same as in FFTReal. All passes are
+// out-of-place, buffers need no particular alignment.
+class FFTRealSimdSse2
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	float	DataType;
+	typedef	OscSinCos <DataType>	OscType;
+
+	enum {			NBR_ELT		= 4	};
+	typedef	OscSinCosLanes <DataType, NBR_ELT>	OscLanes;
+
+	// Smallest sizes the kernels accept
+	enum {			MIN_LEN_1_2	= NBR_ELT * 4	};
+	enum {			MIN_LEN_3		= NBR_ELT * 8	};
+	enum {			MIN_NBR_COEF	= NBR_ELT * 4	};
+	enum {			MIN_LEN_POWER	= NBR_ELT * 2	};
+	enum {			MIN_LEN_DCT	= NBR_ELT * 4	};
+
+	static inline void
+							direct_pass_1_2 (DataType df [], const DataType x [], const long br_ptr [], long br_step, long len);
+	static inline void
+							direct_pass_3 (DataType df [], const DataType sf [], long len);
+	static inline void
+							direct_pass_n_lut (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr []);
+	static inline void
+							direct_pass_n_osc (DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc);
+
+	static inline void
+							inverse_pass_n_lut (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr []);
+	static inline void
+							inverse_pass_n_osc (DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc);
+
+	static inline void
+							direct_pass_n2_lut (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr []);
+	static inline void
+							direct_pass_n2_osc (DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc1, OscType &osc2);
+	static inline void
+							inverse_pass_n2_lut (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr []);
+	static inline void
+							inverse_pass_n2_osc (DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc1, OscType &osc2);
+
+	static inline void
+							inverse_pass_3 (DataType df [], const DataType sf [], long len);
+	static inline void
+							inverse_pass_1_2 (DataType x [], const DataType sf [], const long br_ptr [], long br_step, long len);
+
+	static inline void
+							power_cbrt (DataType out [], const DataType f [], long len);
+	// Radix-4 and radix-2 passes of FFTComplex
+	static inline bool
+							is_complex_pass_4_ok (long nbr_coef, long stride);
+	static inline void
+							complex_pass_4 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long nbr_coef, long stride, const DataType tw_ptr []);
+	static inline void
+							complex_pass_2 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long stride);
+
+	static inline void
+							power_pass_n2_lut (DataType out [], const DataType sf [], long nbr_coef, const DataType cos1_ptr [], const DataType cos2_ptr [], DataType exponent);
+	static inline void
+							power_pass_n2_osc (DataType out [], const DataType sf [], long nbr_coef, OscType &osc1, OscType &osc2, DataType exponent);
+	static inline void
+							dct_post (DataType f [], const DataType vf [], const DataType cos_ptr [], const DataType sin_ptr [], long len);
+	static inline void
+							dct_pre (DataType vf [], const DataType f [], const DataType cos_ptr [], const DataType sin_ptr [], long len);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	ffft_FORCEINLINE static __m128
+							reverse (__m128 v);
+	ffft_FORCEINLINE static __m128
+							gather (const DataType x [], const long ri [4], long offset);
+	ffft_FORCEINLINE static void
+							step_osc (OscLanes &osc, __m128 &c, __m128 &s);
+	ffft_FORCEINLINE static __m128
+							cbrt (__m128 x);
+	// Exponents of the power kernels, see FFTRealPower
+	enum Exponent
+	{
+		Exponent_ONE = 0,
+		Exponent_HALF,
+		Exponent_THIRD,
+		Exponent_OTHER
+	};
+
+	static inline int
+							find_exponent (DataType exponent);
+	ffft_FORCEINLINE static __m128
+							raise (__m128 power, int id, DataType exponent);
+
+	ffft_FORCEINLINE static void
+							direct_extremes (DataType df [], const DataType sf [], long nbr_coef);
+	ffft_FORCEINLINE static void
+							direct_butterfly (DataType df [], const DataType sf [], long nbr_coef, long i, __m128 c, __m128 s);
+	ffft_FORCEINLINE static void
+							direct_butterfly (DataType df [], const DataType sf [], long nbr_coef, long i, DataType c, DataType s);
+
+	ffft_FORCEINLINE static void
+							inverse_extremes (DataType df [], const DataType sf [], long nbr_coef);
+	ffft_FORCEINLINE static void
+							inverse_butterfly (DataType df [], const DataType sf [], long nbr_coef, long i, __m128 c, __m128 s);
+	ffft_FORCEINLINE static void
+							inverse_butterfly (DataType df [], const DataType sf [], long nbr_coef, long i, DataType c, DataType s);
+
+	ffft_FORCEINLINE static void
+							direct_butterfly_n2 (DataType df [], const DataType sf [], long nbr_coef, long i, __m128 c1, __m128 s1, __m128 c2, __m128 s2);
+	ffft_FORCEINLINE static void
+							inverse_butterfly_n2 (DataType df [], const DataType sf [], long nbr_coef, long i, __m128 c1, __m128 s1, __m128 c2, __m128 s2);
+
+	ffft_FORCEINLINE static void
+							complex_butterfly_4 (__m128 yr [4], __m128 yi [4], const __m128 xr [4], const __m128 xi [4], const __m128 wr [3], const __m128 wi [3]);
+
+	ffft_FORCEINLINE static void
+							power_extremes (DataType out [], const DataType sf [], long nbr_coef, int id, DataType exponent);
+	ffft_FORCEINLINE static void
+							power_butterfly (DataType out [], const DataType sf [], long nbr_coef, long i, DataType c1, DataType s1, DataType c2, DataType s2, int id, DataType exponent);
+	ffft_FORCEINLINE static void
+							power_butterfly_n2 (DataType out [], const DataType sf [], long nbr_coef, long i, __m128 c1, __m128 s1, __m128 c2, __m128 s2, int id, DataType exponent);
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+							FFTRealSimdSse2 ();
+							~FFTRealSimdSse2 ();
+							FFTRealSimdSse2 (const FFTRealSimdSse2 &other);
+	FFTRealSimdSse2 &
+							operator = (const FFTRealSimdSse2 &other);
+	bool				operator == (const FFTRealSimdSse2 &other);
+	bool				operator != (const FFTRealSimdSse2 &other);
+
+};	// class FFTRealSimdSse2
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/FFTRealSimdSse2.hpp"
+
+
+
+#endif	// ffft_FFTRealSimdSse2_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
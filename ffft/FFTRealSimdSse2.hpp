@@ -0,0 +1,1486 @@
+/*****************************************************************************
+
+        FFTRealSimdSse2.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_FFTRealSimdSse2_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealSimdSse2 code header.
+#endif
+#define	ffft_FFTRealSimdSse2_CURRENT_CODEHEADER
+
+#if ! defined (ffft_FFTRealSimdSse2_CODEHEADER_INCLUDED)
+#define	ffft_FFTRealSimdSse2_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+#include	<cfloat>
+#include	<cmath>
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: direct_pass_1_2
+Description:
+	First and second passes at once, reading the input in bit-reversed order.
+	Each lane handles one group of 4 coefficients; the results are
+	transposed back before being stored.
+Input parameters:
+	- x: input data, len samples.
+	- br_ptr: bit-reversal table. br_ptr [k * br_step] is the bit-reversed
+		index of coefficient 4 * k.
+	- br_step: stride in br_ptr, > 0.
+	- len: number of samples, multiple of MIN_LEN_1_2.
+Output parameters:
+	- df: transformed data, len samples.
+Throws: Nothing
+==============================================================================
+*/
+
+void	FFTRealSimdSse2::direct_pass_1_2 (DataType df [], const DataType x [], const long br_ptr [], long br_step, long len)
+{
+	assert (df != 0);
+	assert (x != 0);
+	assert (df != x);
+	assert (br_ptr != 0);
+	assert (br_step > 0);
+	assert (len >= MIN_LEN_1_2);
+	assert ((len & (MIN_LEN_1_2 - 1)) == 0);
+
+	const long		qlen = len >> 2;
+
+	long				coef_index = 0;
+	do
+	{
+		const long * const	br = br_ptr + (coef_index >> 2) * br_step;
+		const long		ri [4] = { br [0], br [br_step], br [br_step * 2], br [br_step * 3] };
+
+		const __m128	x_0 = gather (x, ri, 0       );
+		const __m128	x_1 = gather (x, ri, 2 * qlen);
+		const __m128	x_2 = gather (x, ri, 1 * qlen);
+		const __m128	x_3 = gather (x, ri, 3 * qlen);
+
+		__m128			df_1 = _mm_sub_ps (x_0, x_1);
+		__m128			df_3 = _mm_sub_ps (x_2, x_3);
+
+		const __m128	sf_0 = _mm_add_ps (x_0, x_1);
+		const __m128	sf_2 = _mm_add_ps (x_2, x_3);
+
+		__m128			df_0 = _mm_add_ps (sf_0, sf_2);
+		__m128			df_2 = _mm_sub_ps (sf_0, sf_2);
+
+		_MM_TRANSPOSE4_PS (df_0, df_1, df_2, df_3);
+
+		_mm_storeu_ps (df + coef_index     , df_0);
+		_mm_storeu_ps (df + coef_index +  4, df_1);
+		_mm_storeu_ps (df + coef_index +  8, df_2);
+		_mm_storeu_ps (df + coef_index + 12, df_3);
+
+		coef_index += 16;
+	}
+	while (coef_index < len);
+}
+
+
+
+// Third pass, 4 blocks of 8 coefficients at once, one block per lane.
+// len must be a multiple of MIN_LEN_3.
+void	FFTRealSimdSse2::direct_pass_3 (DataType df [], const DataType sf [], long len)
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (len >= MIN_LEN_3);
+	assert ((len & (MIN_LEN_3 - 1)) == 0);
+
+	const __m128	sqrt2_2 = _mm_set1_ps (DataType (SQRT2 * 0.5));
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		// After the transpositions, s_k holds coefficient k of each block
+		__m128			s_0 = _mm_loadu_ps (sfb     );
+		__m128			s_1 = _mm_loadu_ps (sfb +  8);
+		__m128			s_2 = _mm_loadu_ps (sfb + 16);
+		__m128			s_3 = _mm_loadu_ps (sfb + 24);
+		__m128			s_4 = _mm_loadu_ps (sfb +  4);
+		__m128			s_5 = _mm_loadu_ps (sfb + 12);
+		__m128			s_6 = _mm_loadu_ps (sfb + 20);
+		__m128			s_7 = _mm_loadu_ps (sfb + 28);
+		_MM_TRANSPOSE4_PS (s_0, s_1, s_2, s_3);
+		_MM_TRANSPOSE4_PS (s_4, s_5, s_6, s_7);
+
+		__m128			d_0 = _mm_add_ps (s_0, s_4);
+		__m128			d_4 = _mm_sub_ps (s_0, s_4);
+		__m128			d_2 = s_2;
+		__m128			d_6 = s_6;
+
+		__m128			v;
+
+		v = _mm_mul_ps (_mm_sub_ps (s_5, s_7), sqrt2_2);
+		__m128			d_1 = _mm_add_ps (s_1, v);
+		__m128			d_3 = _mm_sub_ps (s_1, v);
+
+		v = _mm_mul_ps (_mm_add_ps (s_5, s_7), sqrt2_2);
+		__m128			d_5 = _mm_add_ps (v, s_3);
+		__m128			d_7 = _mm_sub_ps (v, s_3);
+
+		_MM_TRANSPOSE4_PS (d_0, d_1, d_2, d_3);
+		_MM_TRANSPOSE4_PS (d_4, d_5, d_6, d_7);
+
+		_mm_storeu_ps (dfb     , d_0);
+		_mm_storeu_ps (dfb +  4, d_4);
+		_mm_storeu_ps (dfb +  8, d_1);
+		_mm_storeu_ps (dfb + 12, d_5);
+		_mm_storeu_ps (dfb + 16, d_2);
+		_mm_storeu_ps (dfb + 20, d_6);
+		_mm_storeu_ps (dfb + 24, d_3);
+		_mm_storeu_ps (dfb + 28, d_7);
+
+		coef_index += 32;
+	}
+	while (coef_index < len);
+}
+
+
+
+/*
+==============================================================================
+Name: direct_pass_n_lut
+Description:
+	Generic forward pass with twiddle factors read from a table.
+Input parameters:
+	- sf: source data, len samples.
+	- nbr_coef: 1 << pass, >= MIN_NBR_COEF.
+	- len: number of samples, multiple of 2 * nbr_coef.
+	- cos_ptr: cos (i * PI / nbr_coef) for i in [0 ; nbr_coef / 2[
+Output parameters:
+	- df: destination data, len samples.
+Throws: Nothing
+==============================================================================
+*/
+
+void	FFTRealSimdSse2::direct_pass_n_lut (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr [])
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (nbr_coef >= MIN_NBR_COEF);
+	assert (len >= nbr_coef * 2);
+	assert (cos_ptr != 0);
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		direct_extremes (dfb, sfb, nbr_coef);
+
+		// h_nbr_coef - 1 is never a multiple of NBR_ELT, so the last vector
+		// is moved back and overlaps the previous one. The pass is out-of-
+		// place, these coefficients are just computed twice.
+		long				i = 1;
+		do
+		{
+			if (i > h_nbr_coef - NBR_ELT)
+			{
+				i = h_nbr_coef - NBR_ELT;
+			}
+
+			const __m128	c = _mm_loadu_ps (cos_ptr + i);
+			const __m128	s = reverse (_mm_loadu_ps (cos_ptr + h_nbr_coef - i - (NBR_ELT - 1)));
+			direct_butterfly (dfb, sfb, nbr_coef, i, c, s);
+
+			i += NBR_ELT;
+		}
+		while (i < h_nbr_coef);
+
+		coef_index += d_nbr_coef;
+	}
+	while (coef_index < len);
+}
+
+
+
+// Same as direct_pass_n_lut, with twiddle factors from an oscillator.
+void	FFTRealSimdSse2::direct_pass_n_osc (DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc)
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (nbr_coef >= MIN_NBR_COEF);
+	assert (len >= nbr_coef * 2);
+
+	OscLanes			lanes;
+	lanes.set_step (osc.get_step ());
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		lanes.clear_buffers ();
+
+		direct_extremes (dfb, sfb, nbr_coef);
+
+		long				i = 1;
+		for ( ; i + NBR_ELT <= h_nbr_coef; i += NBR_ELT)
+		{
+			__m128			c;
+			__m128			s;
+			step_osc (lanes, c, s);
+			direct_butterfly (dfb, sfb, nbr_coef, i, c, s);
+		}
+		// Lanes left in the last group
+		for (int lane = 0; i < h_nbr_coef; ++ i, ++ lane)
+		{
+			direct_butterfly (dfb, sfb, nbr_coef, i, lanes.get_cos (lane), lanes.get_sin (lane));
+		}
+
+		coef_index += d_nbr_coef;
+	}
+	while (coef_index < len);
+}
+
+
+
+// Inverse of direct_pass_n_lut, same parameters
+void	FFTRealSimdSse2::inverse_pass_n_lut (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr [])
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (nbr_coef >= MIN_NBR_COEF);
+	assert (len >= nbr_coef * 2);
+	assert (cos_ptr != 0);
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		inverse_extremes (dfb, sfb, nbr_coef);
+
+		// Overlapping last vector, see direct_pass_n_lut()
+		long				i = 1;
+		do
+		{
+			if (i > h_nbr_coef - NBR_ELT)
+			{
+				i = h_nbr_coef - NBR_ELT;
+			}
+
+			const __m128	c = _mm_loadu_ps (cos_ptr + i);
+			const __m128	s = reverse (_mm_loadu_ps (cos_ptr + h_nbr_coef - i - (NBR_ELT - 1)));
+			inverse_butterfly (dfb, sfb, nbr_coef, i, c, s);
+
+			i += NBR_ELT;
+		}
+		while (i < h_nbr_coef);
+
+		coef_index += d_nbr_coef;
+	}
+	while (coef_index < len);
+}
+
+
+
+// Inverse of direct_pass_n_osc, same parameters
+void	FFTRealSimdSse2::inverse_pass_n_osc (DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc)
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (nbr_coef >= MIN_NBR_COEF);
+	assert (len >= nbr_coef * 2);
+
+	OscLanes			lanes;
+	lanes.set_step (osc.get_step ());
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		lanes.clear_buffers ();
+
+		inverse_extremes (dfb, sfb, nbr_coef);
+
+		long				i = 1;
+		for ( ; i + NBR_ELT <= h_nbr_coef; i += NBR_ELT)
+		{
+			__m128			c;
+			__m128			s;
+			step_osc (lanes, c, s);
+			inverse_butterfly (dfb, sfb, nbr_coef, i, c, s);
+		}
+		// Lanes left in the last group
+		for (int lane = 0; i < h_nbr_coef; ++ i, ++ lane)
+		{
+			inverse_butterfly (dfb, sfb, nbr_coef, i, lanes.get_cos (lane), lanes.get_sin (lane));
+		}
+
+		coef_index += d_nbr_coef;
+	}
+	while (coef_index < len);
+}
+
+
+
+// Inverse of direct_pass_3, same parameters
+void	FFTRealSimdSse2::inverse_pass_3 (DataType df [], const DataType sf [], long len)
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (len >= MIN_LEN_3);
+	assert ((len & (MIN_LEN_3 - 1)) == 0);
+
+	const __m128	sqrt2_2 = _mm_set1_ps (DataType (SQRT2 * 0.5));
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		__m128			s_0 = _mm_loadu_ps (sfb     );
+		__m128			s_1 = _mm_loadu_ps (sfb +  8);
+		__m128			s_2 = _mm_loadu_ps (sfb + 16);
+		__m128			s_3 = _mm_loadu_ps (sfb + 24);
+		__m128			s_4 = _mm_loadu_ps (sfb +  4);
+		__m128			s_5 = _mm_loadu_ps (sfb + 12);
+		__m128			s_6 = _mm_loadu_ps (sfb + 20);
+		__m128			s_7 = _mm_loadu_ps (sfb + 28);
+		_MM_TRANSPOSE4_PS (s_0, s_1, s_2, s_3);
+		_MM_TRANSPOSE4_PS (s_4, s_5, s_6, s_7);
+
+		__m128			d_0 = _mm_add_ps (s_0, s_4);
+		__m128			d_4 = _mm_sub_ps (s_0, s_4);
+		__m128			d_2 = _mm_add_ps (s_2, s_2);
+		__m128			d_6 = _mm_add_ps (s_6, s_6);
+
+		__m128			d_1 = _mm_add_ps (s_1, s_3);
+		__m128			d_3 = _mm_sub_ps (s_5, s_7);
+
+		const __m128	vr = _mm_sub_ps (s_1, s_3);
+		const __m128	vi = _mm_add_ps (s_5, s_7);
+
+		__m128			d_5 = _mm_mul_ps (_mm_add_ps (vr, vi), sqrt2_2);
+		__m128			d_7 = _mm_mul_ps (_mm_sub_ps (vi, vr), sqrt2_2);
+
+		_MM_TRANSPOSE4_PS (d_0, d_1, d_2, d_3);
+		_MM_TRANSPOSE4_PS (d_4, d_5, d_6, d_7);
+
+		_mm_storeu_ps (dfb     , d_0);
+		_mm_storeu_ps (dfb +  4, d_4);
+		_mm_storeu_ps (dfb +  8, d_1);
+		_mm_storeu_ps (dfb + 12, d_5);
+		_mm_storeu_ps (dfb + 16, d_2);
+		_mm_storeu_ps (dfb + 20, d_6);
+		_mm_storeu_ps (dfb + 24, d_3);
+		_mm_storeu_ps (dfb + 28, d_7);
+
+		coef_index += 32;
+	}
+	while (coef_index < len);
+}
+
+
+
+// Inverse of direct_pass_1_2, same parameters
+void	FFTRealSimdSse2::inverse_pass_1_2 (DataType x [], const DataType sf [], const long br_ptr [], long br_step, long len)
+{
+	assert (x != 0);
+	assert (sf != 0);
+	assert (x != sf);
+	assert (br_ptr != 0);
+	assert (br_step > 0);
+	assert (len >= MIN_LEN_1_2);
+	assert ((len & (MIN_LEN_1_2 - 1)) == 0);
+
+	const long		qlen = len >> 2;
+
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+
+		__m128			s_0 = _mm_loadu_ps (sfb     );
+		__m128			s_1 = _mm_loadu_ps (sfb +  4);
+		__m128			s_2 = _mm_loadu_ps (sfb +  8);
+		__m128			s_3 = _mm_loadu_ps (sfb + 12);
+		_MM_TRANSPOSE4_PS (s_0, s_1, s_2, s_3);
+
+		const __m128	b_0 = _mm_add_ps (s_0, s_2);
+		const __m128	b_2 = _mm_sub_ps (s_0, s_2);
+		const __m128	b_1 = _mm_add_ps (s_1, s_1);
+		const __m128	b_3 = _mm_add_ps (s_3, s_3);
+
+		// The output is scattered in bit-reversed order, lane by lane
+		DataType		x_0 [NBR_ELT];
+		DataType		x_1 [NBR_ELT];
+		DataType		x_2 [NBR_ELT];
+		DataType		x_3 [NBR_ELT];
+		_mm_storeu_ps (x_0, _mm_add_ps (b_0, b_1));
+		_mm_storeu_ps (x_1, _mm_sub_ps (b_0, b_1));
+		_mm_storeu_ps (x_2, _mm_add_ps (b_2, b_3));
+		_mm_storeu_ps (x_3, _mm_sub_ps (b_2, b_3));
+
+		const long * const	br = br_ptr + (coef_index >> 2) * br_step;
+		for (int lane = 0; lane < NBR_ELT; ++ lane)
+		{
+			const long		ri_0 = br [lane * br_step];
+			x [ri_0           ] = x_0 [lane];
+			x [ri_0 + 2 * qlen] = x_1 [lane];
+			x [ri_0 + 1 * qlen] = x_2 [lane];
+			x [ri_0 + 3 * qlen] = x_3 [lane];
+		}
+
+		coef_index += 16;
+	}
+	while (coef_index < len);
+}
+
+
+
+// Two passes at once, see FFTRealRadix4. nbr_coef is the size of the first
+// one, cos1_ptr and cos2_ptr are the tables of both passes.
+void	FFTRealSimdSse2::direct_pass_n2_lut (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr [])
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (nbr_coef >= MIN_NBR_COEF);
+	assert (len >= nbr_coef * 4);
+	assert (cos1_ptr != 0);
+	assert (cos2_ptr != 0);
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		q_nbr_coef = nbr_coef << 2;
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		FFTRealRadix4 <DataType>::direct_extremes (dfb, sfb, nbr_coef);
+
+		// Overlapping last vector
+		long				i = 1;
+		do
+		{
+			if (i > h_nbr_coef - NBR_ELT)
+			{
+				i = h_nbr_coef - NBR_ELT;
+			}
+
+			const __m128	c1 = _mm_loadu_ps (cos1_ptr + i);
+			const __m128	s1 = reverse (_mm_loadu_ps (cos1_ptr + h_nbr_coef - i - (NBR_ELT - 1)));
+			const __m128	c2 = _mm_loadu_ps (cos2_ptr + i);
+			const __m128	s2 = reverse (_mm_loadu_ps (cos2_ptr + nbr_coef - i - (NBR_ELT - 1)));
+			direct_butterfly_n2 (dfb, sfb, nbr_coef, i, c1, s1, c2, s2);
+
+			i += NBR_ELT;
+		}
+		while (i < h_nbr_coef);
+
+		coef_index += q_nbr_coef;
+	}
+	while (coef_index < len);
+}
+
+
+
+void	FFTRealSimdSse2::direct_pass_n2_osc (DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc1, OscType &osc2)
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (nbr_coef >= MIN_NBR_COEF);
+	assert (len >= nbr_coef * 4);
+
+	OscLanes			lanes1;
+	OscLanes			lanes2;
+	lanes1.set_step (osc1.get_step ());
+	lanes2.set_step (osc2.get_step ());
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		q_nbr_coef = nbr_coef << 2;
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		lanes1.clear_buffers ();
+		lanes2.clear_buffers ();
+
+		FFTRealRadix4 <DataType>::direct_extremes (dfb, sfb, nbr_coef);
+
+		long				i = 1;
+		for ( ; i + NBR_ELT <= h_nbr_coef; i += NBR_ELT)
+		{
+			__m128			c1;
+			__m128			s1;
+			__m128			c2;
+			__m128			s2;
+			step_osc (lanes1, c1, s1);
+			step_osc (lanes2, c2, s2);
+			direct_butterfly_n2 (dfb, sfb, nbr_coef, i, c1, s1, c2, s2);
+		}
+		for (int lane = 0; i < h_nbr_coef; ++ i, ++ lane)
+		{
+			FFTRealRadix4 <DataType>::direct_butterfly (
+				dfb, sfb, nbr_coef, i,
+				lanes1.get_cos (lane), lanes1.get_sin (lane),
+				lanes2.get_cos (lane), lanes2.get_sin (lane)
+			);
+		}
+
+		coef_index += q_nbr_coef;
+	}
+	while (coef_index < len);
+}
+
+
+
+void	FFTRealSimdSse2::inverse_pass_n2_lut (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr [])
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (nbr_coef >= MIN_NBR_COEF);
+	assert (len >= nbr_coef * 4);
+	assert (cos1_ptr != 0);
+	assert (cos2_ptr != 0);
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		q_nbr_coef = nbr_coef << 2;
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		FFTRealRadix4 <DataType>::inverse_extremes (dfb, sfb, nbr_coef);
+
+		long				i = 1;
+		do
+		{
+			if (i > h_nbr_coef - NBR_ELT)
+			{
+				i = h_nbr_coef - NBR_ELT;
+			}
+
+			const __m128	c1 = _mm_loadu_ps (cos1_ptr + i);
+			const __m128	s1 = reverse (_mm_loadu_ps (cos1_ptr + h_nbr_coef - i - (NBR_ELT - 1)));
+			const __m128	c2 = _mm_loadu_ps (cos2_ptr + i);
+			const __m128	s2 = reverse (_mm_loadu_ps (cos2_ptr + nbr_coef - i - (NBR_ELT - 1)));
+			inverse_butterfly_n2 (dfb, sfb, nbr_coef, i, c1, s1, c2, s2);
+
+			i += NBR_ELT;
+		}
+		while (i < h_nbr_coef);
+
+		coef_index += q_nbr_coef;
+	}
+	while (coef_index < len);
+}
+
+
+
+void	FFTRealSimdSse2::inverse_pass_n2_osc (DataType df [], const DataType sf [], long nbr_coef, long len, OscType &osc1, OscType &osc2)
+{
+	assert (df != 0);
+	assert (sf != 0);
+	assert (df != sf);
+	assert (nbr_coef >= MIN_NBR_COEF);
+	assert (len >= nbr_coef * 4);
+
+	OscLanes			lanes1;
+	OscLanes			lanes2;
+	lanes1.set_step (osc1.get_step ());
+	lanes2.set_step (osc2.get_step ());
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		q_nbr_coef = nbr_coef << 2;
+	long				coef_index = 0;
+	do
+	{
+		const DataType * const	sfb = sf + coef_index;
+		DataType * const	dfb = df + coef_index;
+
+		lanes1.clear_buffers ();
+		lanes2.clear_buffers ();
+
+		FFTRealRadix4 <DataType>::inverse_extremes (dfb, sfb, nbr_coef);
+
+		long				i = 1;
+		for ( ; i + NBR_ELT <= h_nbr_coef; i += NBR_ELT)
+		{
+			__m128			c1;
+			__m128			s1;
+			__m128			c2;
+			__m128			s2;
+			step_osc (lanes1, c1, s1);
+			step_osc (lanes2, c2, s2);
+			inverse_butterfly_n2 (dfb, sfb, nbr_coef, i, c1, s1, c2, s2);
+		}
+		for (int lane = 0; i < h_nbr_coef; ++ i, ++ lane)
+		{
+			FFTRealRadix4 <DataType>::inverse_butterfly (
+				dfb, sfb, nbr_coef, i,
+				lanes1.get_cos (lane), lanes1.get_sin (lane),
+				lanes2.get_cos (lane), lanes2.get_sin (lane)
+			);
+		}
+
+		coef_index += q_nbr_coef;
+	}
+	while (coef_index < len);
+}
+
+
+
+// Cube root of the power of bins 0 to len/2-1 of a spectrum in the FFTReal
+// layout, see FFTRealPower::compute(). Bin 0 gets f [len/2] as imaginary
+// part, the caller overwrites it. out may be f. len must be a multiple of
+// MIN_LEN_POWER.
+void	FFTRealSimdSse2::power_cbrt (DataType out [], const DataType f [], long len)
+{
+	assert (out != 0);
+	assert (f != 0);
+	assert (len >= MIN_LEN_POWER);
+	assert ((len & (MIN_LEN_POWER - 1)) == 0);
+
+	const long		half = len >> 1;
+
+	long				bin = 0;
+	do
+	{
+		const __m128	re = _mm_loadu_ps (f + bin);
+		const __m128	im = _mm_loadu_ps (f + half + bin);
+		const __m128	power = _mm_add_ps (_mm_mul_ps (re, re), _mm_mul_ps (im, im));
+		_mm_storeu_ps (out + bin, cbrt (power));
+
+		bin += NBR_ELT;
+	}
+	while (bin < half);
+}
+
+
+
+// The vectors go along the interleaved sequences, or along the butterflies
+// of the first pass. The latter are transposed before being stored.
+bool	FFTRealSimdSse2::is_complex_pass_4_ok (long nbr_coef, long stride)
+{
+	return (stride >= NBR_ELT || (stride == 1 && nbr_coef >= NBR_ELT * 4));
+}
+
+
+
+// See FFTComplex::compute_pass_4()
+void	FFTRealSimdSse2::complex_pass_4 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long nbr_coef, long stride, const DataType tw_ptr [])
+{
+	assert (dr != 0);
+	assert (di != 0);
+	assert (sr != 0);
+	assert (si != 0);
+	assert (tw_ptr != 0);
+	assert (is_complex_pass_4_ok (nbr_coef, stride));
+
+	const long		quarter = nbr_coef >> 2;
+	const long		dist = quarter * stride;
+
+	__m128			xr [4];
+	__m128			xi [4];
+	__m128			yr [4];
+	__m128			yi [4];
+	__m128			wr [3];
+	__m128			wi [3];
+
+	if (stride == 1)
+	{
+		for (long p = 0; p < quarter; p += NBR_ELT)
+		{
+			for (int l = 0; l < 4; ++l)
+			{
+				xr [l] = _mm_loadu_ps (sr + p + dist * l);
+				xi [l] = _mm_loadu_ps (si + p + dist * l);
+			}
+			for (int r = 0; r < 3; ++r)
+			{
+				wr [r] = _mm_loadu_ps (tw_ptr + quarter * (r * 2    ) + p);
+				wi [r] = _mm_loadu_ps (tw_ptr + quarter * (r * 2 + 1) + p);
+			}
+
+			complex_butterfly_4 (yr, yi, xr, xi, wr, wi);
+
+			_MM_TRANSPOSE4_PS (yr [0], yr [1], yr [2], yr [3]);
+			_MM_TRANSPOSE4_PS (yi [0], yi [1], yi [2], yi [3]);
+			for (int k = 0; k < 4; ++k)
+			{
+				_mm_storeu_ps (dr + (p + k) * 4, yr [k]);
+				_mm_storeu_ps (di + (p + k) * 4, yi [k]);
+			}
+		}
+	}
+
+	else
+	{
+		for (long p = 0; p < quarter; ++p)
+		{
+			for (int r = 0; r < 3; ++r)
+			{
+				wr [r] = _mm_set1_ps (tw_ptr [quarter * (r * 2    ) + p]);
+				wi [r] = _mm_set1_ps (tw_ptr [quarter * (r * 2 + 1) + p]);
+			}
+
+			const DataType * const	sr0 = sr + p * stride;
+			const DataType * const	si0 = si + p * stride;
+			DataType * const	dr0 = dr + p * 4 * stride;
+			DataType * const	di0 = di + p * 4 * stride;
+
+			for (long q = 0; q < stride; q += NBR_ELT)
+			{
+				for (int l = 0; l < 4; ++l)
+				{
+					xr [l] = _mm_loadu_ps (sr0 + q + dist * l);
+					xi [l] = _mm_loadu_ps (si0 + q + dist * l);
+				}
+
+				complex_butterfly_4 (yr, yi, xr, xi, wr, wi);
+
+				for (int r = 0; r < 4; ++r)
+				{
+					_mm_storeu_ps (dr0 + q + stride * r, yr [r]);
+					_mm_storeu_ps (di0 + q + stride * r, yi [r]);
+				}
+			}
+		}
+	}
+}
+
+
+
+// See FFTComplex::compute_pass_2()
+void	FFTRealSimdSse2::complex_pass_2 (DataType dr [], DataType di [], const DataType sr [], const DataType si [], long stride)
+{
+	assert (dr != 0);
+	assert (di != 0);
+	assert (sr != 0);
+	assert (si != 0);
+	assert (stride >= NBR_ELT);
+
+	for (long q = 0; q < stride; q += NBR_ELT)
+	{
+		const __m128	ar = _mm_loadu_ps (sr + q);
+		const __m128	ai = _mm_loadu_ps (si + q);
+		const __m128	br = _mm_loadu_ps (sr + q + stride);
+		const __m128	bi = _mm_loadu_ps (si + q + stride);
+
+		_mm_storeu_ps (dr + q, _mm_add_ps (ar, br));
+		_mm_storeu_ps (di + q, _mm_add_ps (ai, bi));
+		_mm_storeu_ps (dr + q + stride, _mm_sub_ps (ar, br));
+		_mm_storeu_ps (di + q + stride, _mm_sub_ps (ai, bi));
+	}
+}
+
+
+
+// Last sweep of a forward transform with the power of the bins raised to
+// the exponent, see FFTRealPower::compute_pass_lut(). The overlapping last
+// vector computes some bins twice, with the same result.
+void	FFTRealSimdSse2::power_pass_n2_lut (DataType out [], const DataType sf [], long nbr_coef, const DataType cos1_ptr [], const DataType cos2_ptr [], DataType exponent)
+{
+	assert (out != 0);
+	assert (sf != 0);
+	assert (out != sf);
+	assert (nbr_coef >= MIN_NBR_COEF);
+	assert (cos1_ptr != 0);
+	assert (cos2_ptr != 0);
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const int		id = find_exponent (exponent);
+
+	power_extremes (out, sf, nbr_coef, id, exponent);
+
+	long				i = 1;
+	do
+	{
+		if (i > h_nbr_coef - NBR_ELT)
+		{
+			i = h_nbr_coef - NBR_ELT;
+		}
+
+		const __m128	c1 = _mm_loadu_ps (cos1_ptr + i);
+		const __m128	s1 = reverse (_mm_loadu_ps (cos1_ptr + h_nbr_coef - i - (NBR_ELT - 1)));
+		const __m128	c2 = _mm_loadu_ps (cos2_ptr + i);
+		const __m128	s2 = reverse (_mm_loadu_ps (cos2_ptr + nbr_coef - i - (NBR_ELT - 1)));
+		power_butterfly_n2 (out, sf, nbr_coef, i, c1, s1, c2, s2, id, exponent);
+
+		i += NBR_ELT;
+	}
+	while (i < h_nbr_coef);
+}
+
+
+
+void	FFTRealSimdSse2::power_pass_n2_osc (DataType out [], const DataType sf [], long nbr_coef, OscType &osc1, OscType &osc2, DataType exponent)
+{
+	assert (out != 0);
+	assert (sf != 0);
+	assert (out != sf);
+	assert (nbr_coef >= MIN_NBR_COEF);
+
+	OscLanes			lanes1;
+	OscLanes			lanes2;
+	lanes1.set_step (osc1.get_step ());
+	lanes2.set_step (osc2.get_step ());
+
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const int		id = find_exponent (exponent);
+
+	power_extremes (out, sf, nbr_coef, id, exponent);
+
+	long				i = 1;
+	for ( ; i + NBR_ELT <= h_nbr_coef; i += NBR_ELT)
+	{
+		__m128			c1;
+		__m128			s1;
+		__m128			c2;
+		__m128			s2;
+		step_osc (lanes1, c1, s1);
+		step_osc (lanes2, c2, s2);
+		power_butterfly_n2 (out, sf, nbr_coef, i, c1, s1, c2, s2, id, exponent);
+	}
+	for (int lane = 0; i < h_nbr_coef; ++ i, ++ lane)
+	{
+		power_butterfly (
+			out, sf, nbr_coef, i,
+			lanes1.get_cos (lane), lanes1.get_sin (lane),
+			lanes2.get_cos (lane), lanes2.get_sin (lane),
+			id, exponent
+		);
+	}
+}
+
+
+
+// Post-twiddles of the type-II DCT, see FFTRealDct::compute_type_2().
+// Coefficients k and len-k come from bin k of vf, the upper ones are stored
+// in reverse order. The tail that does not fill a vector is scalar.
+void	FFTRealSimdSse2::dct_post (DataType f [], const DataType vf [], const DataType cos_ptr [], const DataType sin_ptr [], long len)
+{
+	assert (f != 0);
+	assert (vf != 0);
+	assert (f != vf);
+	assert (cos_ptr != 0);
+	assert (sin_ptr != 0);
+	assert (len >= MIN_LEN_DCT);
+
+	const long		half = len >> 1;
+
+	long				k = 1;
+	for ( ; k + NBR_ELT <= half; k += NBR_ELT)
+	{
+		const __m128	re = _mm_loadu_ps (vf + k);
+		const __m128	im = _mm_loadu_ps (vf + half + k);
+		const __m128	c = _mm_loadu_ps (cos_ptr + k);
+		const __m128	s = _mm_loadu_ps (sin_ptr + k);
+		const __m128	lo = _mm_sub_ps (_mm_mul_ps (c, re), _mm_mul_ps (s, im));
+		const __m128	hi = _mm_add_ps (_mm_mul_ps (s, re), _mm_mul_ps (c, im));
+		_mm_storeu_ps (f + k, lo);
+		_mm_storeu_ps (f + len - k - (NBR_ELT - 1), reverse (hi));
+	}
+
+	for ( ; k < half; ++k)
+	{
+		const DataType	c = cos_ptr [k];
+		const DataType	s = sin_ptr [k];
+		f [k      ] = c * vf [k] - s * vf [half + k];
+		f [len - k] = s * vf [k] + c * vf [half + k];
+	}
+}
+
+
+
+// Pre-twiddles of the type-III DCT, see FFTRealDct::compute_type_3().
+// Coefficients len-k are loaded in reverse order.
+void	FFTRealSimdSse2::dct_pre (DataType vf [], const DataType f [], const DataType cos_ptr [], const DataType sin_ptr [], long len)
+{
+	assert (vf != 0);
+	assert (f != 0);
+	assert (vf != f);
+	assert (cos_ptr != 0);
+	assert (sin_ptr != 0);
+	assert (len >= MIN_LEN_DCT);
+
+	const long		half = len >> 1;
+	const __m128	h = _mm_set1_ps (0.5f);
+
+	long				k = 1;
+	for ( ; k + NBR_ELT <= half; k += NBR_ELT)
+	{
+		const __m128	a = _mm_loadu_ps (f + k);
+		const __m128	b = reverse (_mm_loadu_ps (f + len - k - (NBR_ELT - 1)));
+		const __m128	c = _mm_mul_ps (_mm_loadu_ps (cos_ptr + k), h);
+		const __m128	s = _mm_mul_ps (_mm_loadu_ps (sin_ptr + k), h);
+		_mm_storeu_ps (vf + k, _mm_add_ps (_mm_mul_ps (c, a), _mm_mul_ps (s, b)));
+		_mm_storeu_ps (vf + half + k, _mm_sub_ps (_mm_mul_ps (c, b), _mm_mul_ps (s, a)));
+	}
+
+	for ( ; k < half; ++k)
+	{
+		const DataType	c = cos_ptr [k] * 0.5f;
+		const DataType	s = sin_ptr [k] * 0.5f;
+		const DataType	a = f [k];
+		const DataType	b = f [len - k];
+		vf [k       ] = c * a + s * b;
+		vf [half + k] = c * b - s * a;
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+__m128	FFTRealSimdSse2::reverse (__m128 v)
+{
+	return (_mm_shuffle_ps (v, v, _MM_SHUFFLE (0, 1, 2, 3)));
+}
+
+
+
+__m128	FFTRealSimdSse2::gather (const DataType x [], const long ri [4], long offset)
+{
+	return (_mm_setr_ps (
+		x [ri [0] + offset],
+		x [ri [1] + offset],
+		x [ri [2] + offset],
+		x [ri [3] + offset]
+	));
+}
+
+
+
+// Current group of twiddle factors, then moves to the next one
+void	FFTRealSimdSse2::step_osc (OscLanes &osc, __m128 &c, __m128 &s)
+{
+	c = _mm_loadu_ps (osc.use_cos ());
+	s = _mm_loadu_ps (osc.use_sin ());
+	osc.step ();
+}
+
+
+
+// 4 lanes of FFTRealPower <float>::fast_cbrt(), keep them in sync. Both
+// round the first guess to nearest.
+__m128	FFTRealSimdSse2::cbrt (__m128 x)
+{
+	const __m128	third = _mm_set1_ps (DataType (1.0 / 3));
+
+	const __m128	bits = _mm_cvtepi32_ps (_mm_castps_si128 (x));
+	const __m128i	guess = _mm_add_epi32 (
+		_mm_cvtps_epi32 (_mm_mul_ps (bits, third)),
+		_mm_set1_epi32 (0x2A5119F2)
+	);
+	__m128			y = _mm_castsi128_ps (guess);
+
+	y = _mm_mul_ps (_mm_add_ps (_mm_add_ps (y, y), _mm_div_ps (x, _mm_mul_ps (y, y))), third);
+	y = _mm_mul_ps (_mm_add_ps (_mm_add_ps (y, y), _mm_div_ps (x, _mm_mul_ps (y, y))), third);
+
+	// 0 and denormals
+	const __m128	normal = _mm_cmpge_ps (x, _mm_set1_ps (FLT_MIN));
+
+	return (_mm_and_ps (y, normal));
+}
+
+
+
+int	FFTRealSimdSse2::find_exponent (DataType exponent)
+{
+	assert (exponent > 0);
+
+	if (exponent == DataType (1))
+	{
+		return (Exponent_ONE);
+	}
+	else if (exponent == DataType (0.5))
+	{
+		return (Exponent_HALF);
+	}
+	else if (exponent == DataType (1.0 / 3))
+	{
+		return (Exponent_THIRD);
+	}
+
+	return (Exponent_OTHER);
+}
+
+
+
+// id comes from find_exponent(). Other exponents use std::pow() on each
+// value.
+__m128	FFTRealSimdSse2::raise (__m128 power, int id, DataType exponent)
+{
+	assert (id >= Exponent_ONE);
+	assert (id <= Exponent_OTHER);
+
+	if (id == Exponent_HALF)
+	{
+		return (_mm_sqrt_ps (power));
+	}
+	else if (id == Exponent_THIRD)
+	{
+		return (cbrt (power));
+	}
+	else if (id == Exponent_OTHER)
+	{
+		DataType			val [NBR_ELT];
+		_mm_storeu_ps (val, power);
+		for (int k = 0; k < NBR_ELT; ++k)
+		{
+			val [k] = DataType (pow (val [k], exponent));
+		}
+
+		return (_mm_loadu_ps (val));
+	}
+
+	return (power);
+}
+
+
+
+void	FFTRealSimdSse2::direct_extremes (DataType df [], const DataType sf [], long nbr_coef)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const DataType * const	sf2r = sf + nbr_coef;
+	DataType * const	dfi = df + nbr_coef;
+
+	// Extreme coefficients are always real
+	df [0] = sf [0] + sf2r [0];
+	dfi [0] = sf [0] - sf2r [0];
+	df [h_nbr_coef] = sf [h_nbr_coef];
+	dfi [h_nbr_coef] = sf2r [h_nbr_coef];
+}
+
+
+
+// Coefficients i to i + NBR_ELT - 1 of a block. Terms at nbr_coef - i are
+// in reverse order, they are swapped within the vector.
+void	FFTRealSimdSse2::direct_butterfly (DataType df [], const DataType sf [], long nbr_coef, long i, __m128 c, __m128 s)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const DataType * const	sf1r = sf;
+	const DataType * const	sf1i = sf1r + h_nbr_coef;
+	const DataType * const	sf2r = sf1r + nbr_coef;
+	const DataType * const	sf2i = sf2r + h_nbr_coef;
+	DataType * const	dfr = df;
+	DataType * const	dfi = dfr + nbr_coef;
+
+	const __m128	sf1r_i = _mm_loadu_ps (sf1r + i);
+	const __m128	sf1i_i = _mm_loadu_ps (sf1i + i);
+	const __m128	sf2r_i = _mm_loadu_ps (sf2r + i);
+	const __m128	sf2i_i = _mm_loadu_ps (sf2i + i);
+
+	const __m128	v1 = _mm_sub_ps (_mm_mul_ps (sf2r_i, c), _mm_mul_ps (sf2i_i, s));
+	_mm_storeu_ps (dfr + i, _mm_add_ps (sf1r_i, v1));
+	_mm_storeu_ps (dfi - i - (NBR_ELT - 1), reverse (_mm_sub_ps (sf1r_i, v1)));
+
+	const __m128	v2 = _mm_add_ps (_mm_mul_ps (sf2r_i, s), _mm_mul_ps (sf2i_i, c));
+	_mm_storeu_ps (dfi + i, _mm_add_ps (v2, sf1i_i));
+	_mm_storeu_ps (dfi + nbr_coef - i - (NBR_ELT - 1), reverse (_mm_sub_ps (v2, sf1i_i)));
+}
+
+
+
+void	FFTRealSimdSse2::direct_butterfly (DataType df [], const DataType sf [], long nbr_coef, long i, DataType c, DataType s)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const DataType * const	sf1r = sf;
+	const DataType * const	sf1i = sf1r + h_nbr_coef;
+	const DataType * const	sf2r = sf1r + nbr_coef;
+	const DataType * const	sf2i = sf2r + h_nbr_coef;
+	DataType * const	dfr = df;
+	DataType * const	dfi = dfr + nbr_coef;
+
+	DataType			v;
+
+	v = sf2r [i] * c - sf2i [i] * s;
+	dfr [i] = sf1r [i] + v;
+	dfi [-i] = sf1r [i] - v;
+
+	v = sf2r [i] * s + sf2i [i] * c;
+	dfi [i] = v + sf1i [i];
+	dfi [nbr_coef - i] = v - sf1i [i];
+}
+
+
+
+void	FFTRealSimdSse2::inverse_extremes (DataType df [], const DataType sf [], long nbr_coef)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const DataType * const	sfi = sf + nbr_coef;
+	DataType * const	df2r = df + nbr_coef;
+
+	// Extreme coefficients are always real
+	df [0] = sf [0] + sfi [0];
+	df2r [0] = sf [0] - sfi [0];
+	df [h_nbr_coef] = sf [h_nbr_coef] * 2;
+	df2r [h_nbr_coef] = sfi [h_nbr_coef] * 2;
+}
+
+
+
+void	FFTRealSimdSse2::inverse_butterfly (DataType df [], const DataType sf [], long nbr_coef, long i, __m128 c, __m128 s)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const DataType * const	sfr = sf;
+	const DataType * const	sfi = sfr + nbr_coef;
+	DataType * const	df1r = df;
+	DataType * const	df1i = df1r + h_nbr_coef;
+	DataType * const	df2r = df1r + nbr_coef;
+	DataType * const	df2i = df2r + h_nbr_coef;
+
+	const __m128	sfr_i = _mm_loadu_ps (sfr + i);
+	const __m128	sfr_ni = reverse (_mm_loadu_ps (sfi - i - (NBR_ELT - 1)));
+	const __m128	sfi_i = _mm_loadu_ps (sfi + i);
+	const __m128	sfi_ni = reverse (_mm_loadu_ps (sfi + nbr_coef - i - (NBR_ELT - 1)));
+
+	_mm_storeu_ps (df1r + i, _mm_add_ps (sfr_i, sfr_ni));
+	_mm_storeu_ps (df1i + i, _mm_sub_ps (sfi_i, sfi_ni));
+
+	const __m128	vr = _mm_sub_ps (sfr_i, sfr_ni);
+	const __m128	vi = _mm_add_ps (sfi_i, sfi_ni);
+
+	_mm_storeu_ps (df2r + i, _mm_add_ps (_mm_mul_ps (vr, c), _mm_mul_ps (vi, s)));
+	_mm_storeu_ps (df2i + i, _mm_sub_ps (_mm_mul_ps (vi, c), _mm_mul_ps (vr, s)));
+}
+
+
+
+void	FFTRealSimdSse2::inverse_butterfly (DataType df [], const DataType sf [], long nbr_coef, long i, DataType c, DataType s)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const DataType * const	sfr = sf;
+	const DataType * const	sfi = sfr + nbr_coef;
+	DataType * const	df1r = df;
+	DataType * const	df1i = df1r + h_nbr_coef;
+	DataType * const	df2r = df1r + nbr_coef;
+	DataType * const	df2i = df2r + h_nbr_coef;
+
+	df1r [i] = sfr [i] + sfi [-i];
+	df1i [i] = sfi [i] - sfi [nbr_coef - i];
+
+	const DataType	vr = sfr [i] - sfi [-i];
+	const DataType	vi = sfi [i] + sfi [nbr_coef - i];
+
+	df2r [i] = vr * c + vi * s;
+	df2i [i] = vi * c - vr * s;
+}
+
+
+
+// Vector version of FFTRealRadix4::direct_butterfly(). Stores going
+// backward are reversed.
+void	FFTRealSimdSse2::direct_butterfly_n2 (DataType df [], const DataType sf [], long nbr_coef, long i, __m128 c1, __m128 s1, __m128 c2, __m128 s2)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	const long		last = NBR_ELT - 1;
+	const DataType * const	sfa = sf;
+	const DataType * const	sfb = sf + d_nbr_coef;
+
+	__m128			v;
+
+	// First pass, both half-blocks
+	const __m128	a1r = _mm_loadu_ps (sfa + i);
+	const __m128	a1i = _mm_loadu_ps (sfa + h_nbr_coef + i);
+	const __m128	a2r = _mm_loadu_ps (sfa + nbr_coef + i);
+	const __m128	a2i = _mm_loadu_ps (sfa + nbr_coef + h_nbr_coef + i);
+	v = _mm_sub_ps (_mm_mul_ps (a2r, c1), _mm_mul_ps (a2i, s1));
+	const __m128	a_i = _mm_add_ps (a1r, v);
+	const __m128	a_ni = _mm_sub_ps (a1r, v);
+	v = _mm_add_ps (_mm_mul_ps (a2r, s1), _mm_mul_ps (a2i, c1));
+	const __m128	a_pi = _mm_add_ps (v, a1i);
+	const __m128	a_dni = _mm_sub_ps (v, a1i);
+
+	const __m128	b1r = _mm_loadu_ps (sfb + i);
+	const __m128	b1i = _mm_loadu_ps (sfb + h_nbr_coef + i);
+	const __m128	b2r = _mm_loadu_ps (sfb + nbr_coef + i);
+	const __m128	b2i = _mm_loadu_ps (sfb + nbr_coef + h_nbr_coef + i);
+	v = _mm_sub_ps (_mm_mul_ps (b2r, c1), _mm_mul_ps (b2i, s1));
+	const __m128	b_i = _mm_add_ps (b1r, v);
+	const __m128	b_ni = _mm_sub_ps (b1r, v);
+	v = _mm_add_ps (_mm_mul_ps (b2r, s1), _mm_mul_ps (b2i, c1));
+	const __m128	b_pi = _mm_add_ps (v, b1i);
+	const __m128	b_dni = _mm_sub_ps (v, b1i);
+
+	// Second pass at i
+	v = _mm_sub_ps (_mm_mul_ps (b_i, c2), _mm_mul_ps (b_pi, s2));
+	_mm_storeu_ps (df + i, _mm_add_ps (a_i, v));
+	_mm_storeu_ps (df + d_nbr_coef - i - last, reverse (_mm_sub_ps (a_i, v)));
+	v = _mm_add_ps (_mm_mul_ps (b_i, s2), _mm_mul_ps (b_pi, c2));
+	_mm_storeu_ps (df + d_nbr_coef + i, _mm_add_ps (v, a_pi));
+	_mm_storeu_ps (df + (d_nbr_coef << 1) - i - last, reverse (_mm_sub_ps (v, a_pi)));
+
+	// Second pass at nbr_coef - i
+	v = _mm_sub_ps (_mm_mul_ps (b_ni, s2), _mm_mul_ps (b_dni, c2));
+	_mm_storeu_ps (df + nbr_coef - i - last, reverse (_mm_add_ps (a_ni, v)));
+	_mm_storeu_ps (df + nbr_coef + i, _mm_sub_ps (a_ni, v));
+	v = _mm_add_ps (_mm_mul_ps (b_ni, c2), _mm_mul_ps (b_dni, s2));
+	_mm_storeu_ps (df + nbr_coef * 3 - i - last, reverse (_mm_add_ps (v, a_dni)));
+	_mm_storeu_ps (df + nbr_coef * 3 + i, _mm_sub_ps (v, a_dni));
+}
+
+
+
+// Vector version of the butterfly of FFTComplex::compute_pass_4(). x [l]
+// are the 4 inputs, wr/wi [r - 1] the twiddle factors of outputs y [r].
+void	FFTRealSimdSse2::complex_butterfly_4 (__m128 yr [4], __m128 yi [4], const __m128 xr [4], const __m128 xi [4], const __m128 wr [3], const __m128 wi [3])
+{
+	const __m128	apc_r = _mm_add_ps (xr [0], xr [2]);
+	const __m128	apc_i = _mm_add_ps (xi [0], xi [2]);
+	const __m128	amc_r = _mm_sub_ps (xr [0], xr [2]);
+	const __m128	amc_i = _mm_sub_ps (xi [0], xi [2]);
+	const __m128	bpd_r = _mm_add_ps (xr [1], xr [3]);
+	const __m128	bpd_i = _mm_add_ps (xi [1], xi [3]);
+	const __m128	bmd_r = _mm_sub_ps (xr [1], xr [3]);
+	const __m128	bmd_i = _mm_sub_ps (xi [1], xi [3]);
+
+	yr [0] = _mm_add_ps (apc_r, bpd_r);
+	yi [0] = _mm_add_ps (apc_i, bpd_i);
+
+	// (a - c) - i * (b - d)
+	const __m128	t1r = _mm_add_ps (amc_r, bmd_i);
+	const __m128	t1i = _mm_sub_ps (amc_i, bmd_r);
+	yr [1] = _mm_sub_ps (_mm_mul_ps (t1r, wr [0]), _mm_mul_ps (t1i, wi [0]));
+	yi [1] = _mm_add_ps (_mm_mul_ps (t1r, wi [0]), _mm_mul_ps (t1i, wr [0]));
+
+	const __m128	t2r = _mm_sub_ps (apc_r, bpd_r);
+	const __m128	t2i = _mm_sub_ps (apc_i, bpd_i);
+	yr [2] = _mm_sub_ps (_mm_mul_ps (t2r, wr [1]), _mm_mul_ps (t2i, wi [1]));
+	yi [2] = _mm_add_ps (_mm_mul_ps (t2r, wi [1]), _mm_mul_ps (t2i, wr [1]));
+
+	// (a - c) + i * (b - d)
+	const __m128	t3r = _mm_sub_ps (amc_r, bmd_i);
+	const __m128	t3i = _mm_add_ps (amc_i, bmd_r);
+	yr [3] = _mm_sub_ps (_mm_mul_ps (t3r, wr [2]), _mm_mul_ps (t3i, wi [2]));
+	yi [3] = _mm_add_ps (_mm_mul_ps (t3r, wi [2]), _mm_mul_ps (t3i, wr [2]));
+}
+
+
+
+// Scalar steps of the power kernels, raised 4 values at a time
+void	FFTRealSimdSse2::power_extremes (DataType out [], const DataType sf [], long nbr_coef, int id, DataType exponent)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+
+	DataType			pw [5];
+	FFTRealRadix4 <DataType>::direct_power_extremes (pw, sf, nbr_coef);
+
+	DataType			res [NBR_ELT];
+	_mm_storeu_ps (res, raise (_mm_loadu_ps (pw), id, exponent));
+	out [0] = res [0];
+	out [h_nbr_coef] = res [1];
+	out [nbr_coef] = res [2];
+	out [d_nbr_coef - h_nbr_coef] = res [3];
+	out [d_nbr_coef] = _mm_cvtss_f32 (raise (_mm_set_ss (pw [4]), id, exponent));
+}
+
+
+
+void	FFTRealSimdSse2::power_butterfly (DataType out [], const DataType sf [], long nbr_coef, long i, DataType c1, DataType s1, DataType c2, DataType s2, int id, DataType exponent)
+{
+	const long		d_nbr_coef = nbr_coef << 1;
+
+	DataType			pw [NBR_ELT];
+	FFTRealRadix4 <DataType>::direct_power_butterfly (
+		pw, sf, nbr_coef, i, c1, s1, c2, s2
+	);
+
+	_mm_storeu_ps (pw, raise (_mm_loadu_ps (pw), id, exponent));
+	out [i] = pw [0];
+	out [nbr_coef - i] = pw [1];
+	out [nbr_coef + i] = pw [2];
+	out [d_nbr_coef - i] = pw [3];
+}
+
+
+
+// direct_butterfly_n2() on the last sweep, see
+// FFTRealRadix4::direct_power_butterfly(). Each bin is complete, its power
+// is raised and stored at its index. Stores going backward are reversed.
+void	FFTRealSimdSse2::power_butterfly_n2 (DataType out [], const DataType sf [], long nbr_coef, long i, __m128 c1, __m128 s1, __m128 c2, __m128 s2, int id, DataType exponent)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	const long		last = NBR_ELT - 1;
+	const DataType * const	sfa = sf;
+	const DataType * const	sfb = sf + d_nbr_coef;
+
+	__m128			v;
+
+	// First pass, both half-blocks
+	const __m128	a1r = _mm_loadu_ps (sfa + i);
+	const __m128	a1i = _mm_loadu_ps (sfa + h_nbr_coef + i);
+	const __m128	a2r = _mm_loadu_ps (sfa + nbr_coef + i);
+	const __m128	a2i = _mm_loadu_ps (sfa + nbr_coef + h_nbr_coef + i);
+	v = _mm_sub_ps (_mm_mul_ps (a2r, c1), _mm_mul_ps (a2i, s1));
+	const __m128	a_i = _mm_add_ps (a1r, v);
+	const __m128	a_ni = _mm_sub_ps (a1r, v);
+	v = _mm_add_ps (_mm_mul_ps (a2r, s1), _mm_mul_ps (a2i, c1));
+	const __m128	a_pi = _mm_add_ps (v, a1i);
+	const __m128	a_dni = _mm_sub_ps (v, a1i);
+
+	const __m128	b1r = _mm_loadu_ps (sfb + i);
+	const __m128	b1i = _mm_loadu_ps (sfb + h_nbr_coef + i);
+	const __m128	b2r = _mm_loadu_ps (sfb + nbr_coef + i);
+	const __m128	b2i = _mm_loadu_ps (sfb + nbr_coef + h_nbr_coef + i);
+	v = _mm_sub_ps (_mm_mul_ps (b2r, c1), _mm_mul_ps (b2i, s1));
+	const __m128	b_i = _mm_add_ps (b1r, v);
+	const __m128	b_ni = _mm_sub_ps (b1r, v);
+	v = _mm_add_ps (_mm_mul_ps (b2r, s1), _mm_mul_ps (b2i, c1));
+	const __m128	b_pi = _mm_add_ps (v, b1i);
+	const __m128	b_dni = _mm_sub_ps (v, b1i);
+
+	// Second pass at i and nbr_coef * 2 - i
+	const __m128	vr_i = _mm_sub_ps (_mm_mul_ps (b_i, c2), _mm_mul_ps (b_pi, s2));
+	const __m128	vi_i = _mm_add_ps (_mm_mul_ps (b_i, s2), _mm_mul_ps (b_pi, c2));
+	const __m128	r_i = _mm_add_ps (a_i, vr_i);
+	const __m128	i_i = _mm_add_ps (vi_i, a_pi);
+	const __m128	r_di = _mm_sub_ps (a_i, vr_i);
+	const __m128	i_di = _mm_sub_ps (vi_i, a_pi);
+	const __m128	p_i = _mm_add_ps (_mm_mul_ps (r_i, r_i), _mm_mul_ps (i_i, i_i));
+	const __m128	p_di = _mm_add_ps (_mm_mul_ps (r_di, r_di), _mm_mul_ps (i_di, i_di));
+
+	// Second pass at nbr_coef - i and nbr_coef + i
+	const __m128	vr_ni = _mm_sub_ps (_mm_mul_ps (b_ni, s2), _mm_mul_ps (b_dni, c2));
+	const __m128	vi_ni = _mm_add_ps (_mm_mul_ps (b_ni, c2), _mm_mul_ps (b_dni, s2));
+	const __m128	r_ni = _mm_add_ps (a_ni, vr_ni);
+	const __m128	i_ni = _mm_add_ps (vi_ni, a_dni);
+	const __m128	r_pi = _mm_sub_ps (a_ni, vr_ni);
+	const __m128	i_pi = _mm_sub_ps (vi_ni, a_dni);
+	const __m128	p_ni = _mm_add_ps (_mm_mul_ps (r_ni, r_ni), _mm_mul_ps (i_ni, i_ni));
+	const __m128	p_pi = _mm_add_ps (_mm_mul_ps (r_pi, r_pi), _mm_mul_ps (i_pi, i_pi));
+
+	// Raising last, when only the powers are left
+	_mm_storeu_ps (out + i, raise (p_i, id, exponent));
+	_mm_storeu_ps (out + nbr_coef - i - last, reverse (raise (p_ni, id, exponent)));
+	_mm_storeu_ps (out + nbr_coef + i, raise (p_pi, id, exponent));
+	_mm_storeu_ps (out + d_nbr_coef - i - last, reverse (raise (p_di, id, exponent)));
+}
+
+
+
+// Vector version of FFTRealRadix4::inverse_butterfly(). Loads going backward
+// are reversed.
+void	FFTRealSimdSse2::inverse_butterfly_n2 (DataType df [], const DataType sf [], long nbr_coef, long i, __m128 c1, __m128 s1, __m128 c2, __m128 s2)
+{
+	const long		h_nbr_coef = nbr_coef >> 1;
+	const long		d_nbr_coef = nbr_coef << 1;
+	const long		last = NBR_ELT - 1;
+	DataType * const	dfa = df;
+	DataType * const	dfb = df + d_nbr_coef;
+
+	__m128			vr;
+	__m128			vi;
+
+	// First pass (nbr_coef * 2) at i
+	const __m128	r_i = _mm_loadu_ps (sf + i);
+	const __m128	r_ni = reverse (_mm_loadu_ps (sf + d_nbr_coef - i - last));
+	const __m128	i_i = _mm_loadu_ps (sf + d_nbr_coef + i);
+	const __m128	i_ni = reverse (_mm_loadu_ps (sf + (d_nbr_coef << 1) - i - last));
+	const __m128	a_i = _mm_add_ps (r_i, r_ni);
+	const __m128	a_pi = _mm_sub_ps (i_i, i_ni);
+	vr = _mm_sub_ps (r_i, r_ni);
+	vi = _mm_add_ps (i_i, i_ni);
+	const __m128	b_i = _mm_add_ps (_mm_mul_ps (vr, c2), _mm_mul_ps (vi, s2));
+	const __m128	b_pi = _mm_sub_ps (_mm_mul_ps (vi, c2), _mm_mul_ps (vr, s2));
+
+	// First pass at nbr_coef - i
+	const __m128	r_j = reverse (_mm_loadu_ps (sf + nbr_coef - i - last));
+	const __m128	r_nj = _mm_loadu_ps (sf + nbr_coef + i);
+	const __m128	i_j = reverse (_mm_loadu_ps (sf + nbr_coef * 3 - i - last));
+	const __m128	i_nj = _mm_loadu_ps (sf + nbr_coef * 3 + i);
+	const __m128	a_ni = _mm_add_ps (r_j, r_nj);
+	const __m128	a_dni = _mm_sub_ps (i_j, i_nj);
+	vr = _mm_sub_ps (r_j, r_nj);
+	vi = _mm_add_ps (i_j, i_nj);
+	const __m128	b_ni = _mm_add_ps (_mm_mul_ps (vr, s2), _mm_mul_ps (vi, c2));
+	const __m128	b_dni = _mm_sub_ps (_mm_mul_ps (vi, s2), _mm_mul_ps (vr, c2));
+
+	// Second pass (nbr_coef), both half-blocks
+	_mm_storeu_ps (dfa + i, _mm_add_ps (a_i, a_ni));
+	_mm_storeu_ps (dfa + h_nbr_coef + i, _mm_sub_ps (a_pi, a_dni));
+	vr = _mm_sub_ps (a_i, a_ni);
+	vi = _mm_add_ps (a_pi, a_dni);
+	_mm_storeu_ps (dfa + nbr_coef + i, _mm_add_ps (_mm_mul_ps (vr, c1), _mm_mul_ps (vi, s1)));
+	_mm_storeu_ps (dfa + nbr_coef + h_nbr_coef + i, _mm_sub_ps (_mm_mul_ps (vi, c1), _mm_mul_ps (vr, s1)));
+
+	_mm_storeu_ps (dfb + i, _mm_add_ps (b_i, b_ni));
+	_mm_storeu_ps (dfb + h_nbr_coef + i, _mm_sub_ps (b_pi, b_dni));
+	vr = _mm_sub_ps (b_i, b_ni);
+	vi = _mm_add_ps (b_pi, b_dni);
+	_mm_storeu_ps (dfb + nbr_coef + i, _mm_add_ps (_mm_mul_ps (vr, c1), _mm_mul_ps (vi, s1)));
+	_mm_storeu_ps (dfb + nbr_coef + h_nbr_coef + i, _mm_sub_ps (_mm_mul_ps (vi, c1), _mm_mul_ps (vr, s1)));
+}
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_FFTRealSimdSse2_CODEHEADER_INCLUDED
+
+#undef ffft_FFTRealSimdSse2_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,111 @@
+/*****************************************************************************
+
+        FFTRealSplit.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_FFTRealSplit_HEADER_INCLUDED)
+#define	ffft_FFTRealSplit_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/def.h"
+
+
+
+namespace ffft
+{
+
+
+
+// Split complex view of a spectrum in the layout of FFTReal::do_fft() and
+// FFTRealFixLen::do_fft(). The last pass already leaves the real parts and
+// the imaginary parts in two separate halves of f, so nothing is moved or
+// copied, the view only points at them:
+//    re [k] = f [k]                   k = 0...len/2
+//    im [k] = -f [len/2 + k]          k = 1...len/2-1
+// This is the packed split format: im [0] and im [len/2] are always 0 and
+// are not stored, the slot of im [0] holds re [len/2].
+// Bins above len/2 are the complex conjugates of the ones below.
+template <class DT>
+class FFTRealSplit
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	DT	DataType;
+
+	inline			FFTRealSplit (DataType f [], long len);
+
+	inline long		get_nbr_bins () const;
+	inline DataType *
+							get_re_ptr () const;
+	inline DataType *
+							get_neg_im_ptr () const;
+	inline DataType	get_re (long bin) const;
+	inline DataType	get_im (long bin) const;
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	DataType *		_f_ptr;
+	long				_len;
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+							FFTRealSplit ();
+							FFTRealSplit (const FFTRealSplit &other);
+	FFTRealSplit &
+							operator = (const FFTRealSplit &other);
+	bool				operator == (const FFTRealSplit &other);
+	bool				operator != (const FFTRealSplit &other);
+
+};	// class FFTRealSplit
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/FFTRealSplit.hpp"
+
+
+
+#endif	// ffft_FFTRealSplit_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
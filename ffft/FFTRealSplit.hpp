@@ -0,0 +1,140 @@
+/*****************************************************************************
+
+        FFTRealSplit.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_FFTRealSplit_CURRENT_CODEHEADER)
+	#error Recursive inclusion of FFTRealSplit code header.
+#endif
+#define	ffft_FFTRealSplit_CURRENT_CODEHEADER
+
+#if ! defined (ffft_FFTRealSplit_CODEHEADER_INCLUDED)
+#define	ffft_FFTRealSplit_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// f: spectrum computed by do_fft(), len values. len is a power of 2, 2 or
+// more.
+template <class DT>
+FFTRealSplit <DT>::FFTRealSplit (DataType f [], long len)
+:	_f_ptr (f)
+,	_len (len)
+{
+	assert (f != 0);
+	assert (len >= 2);
+	assert ((len & (len - 1)) == 0);
+}
+
+
+
+// Number of bins stored in each half: re [0...len/2-1] and the slots of
+// im [0...len/2-1].
+template <class DT>
+long	FFTRealSplit <DT>::get_nbr_bins () const
+{
+	return (_len >> 1);
+}
+
+
+
+// Real parts, len/2 + 1 values: the Nyquist bin is the first value of the
+// other half.
+template <class DT>
+typename FFTRealSplit <DT>::DataType *	FFTRealSplit <DT>::get_re_ptr () const
+{
+	return (_f_ptr);
+}
+
+
+
+// Imaginary parts as stored by do_fft(), with the opposite sign, bins 1 to
+// len/2-1. Index 0 is re [len/2].
+template <class DT>
+typename FFTRealSplit <DT>::DataType *	FFTRealSplit <DT>::get_neg_im_ptr () const
+{
+	return (_f_ptr + (_len >> 1));
+}
+
+
+
+// bin: 0...len-1
+template <class DT>
+typename FFTRealSplit <DT>::DataType	FFTRealSplit <DT>::get_re (long bin) const
+{
+	assert (bin >= 0);
+	assert (bin < _len);
+
+	const long		half = _len >> 1;
+	if (bin > half)
+	{
+		bin = _len - bin;
+	}
+
+	return (_f_ptr [bin]);
+}
+
+
+
+// bin: 0...len-1
+template <class DT>
+typename FFTRealSplit <DT>::DataType	FFTRealSplit <DT>::get_im (long bin) const
+{
+	assert (bin >= 0);
+	assert (bin < _len);
+
+	const long		half = _len >> 1;
+	const DataType	im =
+		  (bin == 0 || bin == half) ? DataType (0)
+		: (bin < half)              ? -_f_ptr [half + bin]
+		:                             _f_ptr [half + _len - bin];
+
+	return (im);
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_FFTRealSplit_CODEHEADER_INCLUDED
+
+#undef ffft_FFTRealSplit_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -29,6 +29,9 @@ http://sam.zoy.org/wtfpl/COPYING for more details.
 
 #include	"ffft/def.h"
 #include	"ffft/FFTRealFixLenParam.h"
+#include	"ffft/FFTRealPower.h"
+#include	"ffft/FFTRealRadix4.h"
+#include	"ffft/FFTRealSimd.h"
 #include	"ffft/OscSinCos.h"
 
 
@@ -38,7 +41,8 @@ namespace ffft
 
 
 
-template <int ALGO>
+// ALGO 1: the twiddle factors come from oscillators
+template <int ALGO, class DT>
 class FFTRealUseTrigo
 {
 
@@ -46,13 +50,23 @@ class FFTRealUseTrigo
 
 public:
 
-   typedef	FFTRealFixLenParam::DataType	DataType;
+	typedef	DT	DataType;
 	typedef	OscSinCos <DataType>	OscType;
 
 	ffft_FORCEINLINE static void
 						prepare (OscType &osc);
 	ffft_FORCEINLINE	static void
 						iterate (OscType &osc, DataType &c, DataType &s, const DataType cos_ptr [], long index_c, long index_s);
+	ffft_FORCEINLINE static bool
+						direct_pass_simd (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr [], OscType &osc);
+	ffft_FORCEINLINE static bool
+						inverse_pass_simd (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr [], OscType &osc);
+	ffft_FORCEINLINE static void
+						direct_pass_n2 (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr [], OscType &osc1, OscType &osc2);
+	ffft_FORCEINLINE static void
+						power_pass_n2 (DataType out [], const DataType sf [], long nbr_coef, const DataType cos1_ptr [], const DataType cos2_ptr [], OscType &osc1, OscType &osc2, DataType exponent);
+	ffft_FORCEINLINE static void
+						inverse_pass_n2 (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr [], OscType &osc1, OscType &osc2);
 
 
 
@@ -84,6 +98,63 @@ private:
 
 
 
+// ALGO 0: the twiddle factors are read from the tables
+template <class DT>
+class FFTRealUseTrigo <0, DT>
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	DT	DataType;
+	typedef	OscSinCos <DataType>	OscType;
+
+	static inline void
+						prepare (OscType &osc);
+	static inline void
+						iterate (OscType &osc, DataType &c, DataType &s, const DataType cos_ptr [], long index_c, long index_s);
+	static inline bool
+						direct_pass_simd (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr [], OscType &osc);
+	static inline bool
+						inverse_pass_simd (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr [], OscType &osc);
+	static inline void
+						direct_pass_n2 (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr [], OscType &osc1, OscType &osc2);
+	ffft_FORCEINLINE static void
+						power_pass_n2 (DataType out [], const DataType sf [], long nbr_coef, const DataType cos1_ptr [], const DataType cos2_ptr [], OscType &osc1, OscType &osc2, DataType exponent);
+	static inline void
+						inverse_pass_n2 (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr [], OscType &osc1, OscType &osc2);
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						FFTRealUseTrigo ();
+						~FFTRealUseTrigo ();
+						FFTRealUseTrigo (const FFTRealUseTrigo &other);
+	FFTRealUseTrigo &
+						operator = (const FFTRealUseTrigo &other);
+	bool				operator == (const FFTRealUseTrigo &other);
+	bool				operator != (const FFTRealUseTrigo &other);
+
+};	// class FFTRealUseTrigo <0, DT>
+
+
+
 }	// namespace ffft
 
 
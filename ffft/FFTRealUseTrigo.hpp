@@ -40,35 +40,175 @@ namespace ffft
 
 
 
-template <int ALGO>
-void	FFTRealUseTrigo <ALGO>::prepare (OscType &osc)
+template <int ALGO, class DT>
+void	FFTRealUseTrigo <ALGO, DT>::prepare (OscType &osc)
 {
 	osc.clear_buffers ();
 }
 
-template <>
-inline void	FFTRealUseTrigo <0>::prepare (OscType &osc)
+template <class DT>
+void	FFTRealUseTrigo <0, DT>::prepare (OscType &osc)
 {
 	// Nothing
-    (void)(osc);
+	(void) osc;
 }
 
 
 
-template <int ALGO>
-void	FFTRealUseTrigo <ALGO>::iterate (OscType &osc, DataType &c, DataType &s, const DataType cos_ptr [], long index_c, long index_s)
+template <int ALGO, class DT>
+void	FFTRealUseTrigo <ALGO, DT>::iterate (OscType &osc, DataType &c, DataType &s, const DataType cos_ptr [], long index_c, long index_s)
 {
 	osc.step ();
 	c = osc.get_cos ();
 	s = osc.get_sin ();
 }
 
-template <>
-inline void	FFTRealUseTrigo <0>::iterate (OscType &osc, DataType &c, DataType &s, const DataType cos_ptr [], long index_c, long index_s)
+template <class DT>
+void	FFTRealUseTrigo <0, DT>::iterate (OscType &osc, DataType &c, DataType &s, const DataType cos_ptr [], long index_c, long index_s)
 {
 	c = cos_ptr [index_c];
 	s = cos_ptr [index_s];
-        (void)(osc);
+	(void) osc;
+}
+
+
+
+// Vectorized pass at the current SIMD level. Returns false if there
+// is none, the caller then runs the scalar loop.
+template <int ALGO, class DT>
+bool	FFTRealUseTrigo <ALGO, DT>::direct_pass_simd (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr [], OscType &osc)
+{
+	(void) cos_ptr;
+
+	return (FFTRealSimd <DataType>::direct_pass_n_osc (
+		FFTRealSimd <DataType>::get_level (), df, sf, nbr_coef, len, osc
+	));
+}
+
+template <class DT>
+bool	FFTRealUseTrigo <0, DT>::direct_pass_simd (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr [], OscType &osc)
+{
+	(void) osc;
+
+	return (FFTRealSimd <DataType>::direct_pass_n_lut (
+		FFTRealSimd <DataType>::get_level (), df, sf, nbr_coef, len, cos_ptr
+	));
+}
+
+
+
+template <int ALGO, class DT>
+bool	FFTRealUseTrigo <ALGO, DT>::inverse_pass_simd (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr [], OscType &osc)
+{
+	(void) cos_ptr;
+
+	return (FFTRealSimd <DataType>::inverse_pass_n_osc (
+		FFTRealSimd <DataType>::get_level (), df, sf, nbr_coef, len, osc
+	));
+}
+
+template <class DT>
+bool	FFTRealUseTrigo <0, DT>::inverse_pass_simd (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos_ptr [], OscType &osc)
+{
+	(void) osc;
+
+	return (FFTRealSimd <DataType>::inverse_pass_n_lut (
+		FFTRealSimd <DataType>::get_level (), df, sf, nbr_coef, len, cos_ptr
+	));
+}
+
+
+
+// Two passes in a single sweep (FFTRealRadix4), vectorized if possible.
+// ALGO is the one of the first pass. The second pass has a table too when
+// the first one has, see FFTRealFixLen::build_trigo_lut().
+template <int ALGO, class DT>
+void	FFTRealUseTrigo <ALGO, DT>::direct_pass_n2 (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr [], OscType &osc1, OscType &osc2)
+{
+	(void) cos1_ptr;
+	(void) cos2_ptr;
+
+	if (! FFTRealSimd <DataType>::direct_pass_n2_osc (
+		FFTRealSimd <DataType>::get_level (), df, sf, nbr_coef, len, osc1, osc2
+	))
+	{
+		FFTRealRadix4 <DataType>::direct_pass_osc (df, sf, nbr_coef, len, osc1, osc2);
+	}
+}
+
+template <class DT>
+void	FFTRealUseTrigo <0, DT>::direct_pass_n2 (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr [], OscType &osc1, OscType &osc2)
+{
+	(void) osc1;
+	(void) osc2;
+
+	if (! FFTRealSimd <DataType>::direct_pass_n2_lut (
+		FFTRealSimd <DataType>::get_level (), df, sf, nbr_coef, len, cos1_ptr, cos2_ptr
+	))
+	{
+		FFTRealRadix4 <DataType>::direct_pass_lut (df, sf, nbr_coef, len, cos1_ptr, cos2_ptr);
+	}
+}
+
+
+
+// Last sweep of a forward transform, see FFTRealPower::compute_pass_lut()
+template <int ALGO, class DT>
+void	FFTRealUseTrigo <ALGO, DT>::power_pass_n2 (DataType out [], const DataType sf [], long nbr_coef, const DataType cos1_ptr [], const DataType cos2_ptr [], OscType &osc1, OscType &osc2, DataType exponent)
+{
+	(void) cos1_ptr;
+	(void) cos2_ptr;
+
+	if (! FFTRealSimd <DataType>::power_pass_n2_osc (
+		FFTRealSimd <DataType>::get_level (), out, sf, nbr_coef, osc1, osc2, exponent
+	))
+	{
+		FFTRealPower <DataType>::compute_pass_osc (out, sf, nbr_coef, osc1, osc2, exponent);
+	}
+}
+
+template <class DT>
+void	FFTRealUseTrigo <0, DT>::power_pass_n2 (DataType out [], const DataType sf [], long nbr_coef, const DataType cos1_ptr [], const DataType cos2_ptr [], OscType &osc1, OscType &osc2, DataType exponent)
+{
+	(void) osc1;
+	(void) osc2;
+
+	if (! FFTRealSimd <DataType>::power_pass_n2_lut (
+		FFTRealSimd <DataType>::get_level (), out, sf, nbr_coef, cos1_ptr, cos2_ptr, exponent
+	))
+	{
+		FFTRealPower <DataType>::compute_pass_lut (out, sf, nbr_coef, cos1_ptr, cos2_ptr, exponent);
+	}
+}
+
+
+
+template <int ALGO, class DT>
+void	FFTRealUseTrigo <ALGO, DT>::inverse_pass_n2 (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr [], OscType &osc1, OscType &osc2)
+{
+	(void) cos1_ptr;
+	(void) cos2_ptr;
+
+	if (! FFTRealSimd <DataType>::inverse_pass_n2_osc (
+		FFTRealSimd <DataType>::get_level (), df, sf, nbr_coef, len, osc1, osc2
+	))
+	{
+		FFTRealRadix4 <DataType>::inverse_pass_osc (df, sf, nbr_coef, len, osc1, osc2);
+	}
+}
+
+template <class DT>
+void	FFTRealUseTrigo <0, DT>::inverse_pass_n2 (DataType df [], const DataType sf [], long nbr_coef, long len, const DataType cos1_ptr [], const DataType cos2_ptr [], OscType &osc1, OscType &osc2)
+{
+	(void) osc1;
+	(void) osc2;
+
+	if (! FFTRealSimd <DataType>::inverse_pass_n2_lut (
+		FFTRealSimd <DataType>::get_level (), df, sf, nbr_coef, len, cos1_ptr, cos2_ptr
+	))
+	{
+		FFTRealRadix4 <DataType>::inverse_pass_lut (df, sf, nbr_coef, len, cos1_ptr, cos2_ptr);
+	}
 }
 
 
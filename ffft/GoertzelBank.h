@@ -0,0 +1,124 @@
+/*****************************************************************************
+
+        GoertzelBank.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_GoertzelBank_HEADER_INCLUDED)
+#define	ffft_GoertzelBank_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/AllocatorHeap.h"
+#include	"ffft/DynArray.h"
+
+
+
+namespace ffft
+{
+
+
+
+// Bank of Goertzel resonators, each one measuring the power of the stream
+// at a single frequency. The stream is cut into consecutive blocks of a
+// given length, the powers are updated at the end of each block.
+// Each sample costs one multiplication and two additions per frequency,
+// cheaper than an FFT when only a handful of bins are needed.
+// When the block holds a whole number of periods of all the frequencies
+// (the harmonics of a fundamental, see set_harmonics()), they fall exactly
+// on DFT bins and do not leak into each other.
+// The resonators run in double precision: at low frequencies their
+// coefficient is close to 2 and float loses the lowest bits of the signal.
+template <class DT>
+class GoertzelBank
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	DT	DataType;
+
+	explicit			GoertzelBank (Allocator &allocator = AllocatorHeap::use_instance ());
+	virtual			~GoertzelBank () {}
+
+	void				set_frequencies (const double freq_arr [], int nbr_freq, long block_len);
+	long				set_harmonics (double fundamental, int nbr_harmonics, long min_block_len);
+	int				get_nbr_frequencies () const;
+	long				get_block_len () const;
+	double			get_frequency (int index) const;
+	void				clear_buffers ();
+	bool				process (const DataType x [], long nbr_spl);
+	double			get_power (int index) const;
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	void				end_block ();
+
+	int				_nbr_freq;
+	long				_block_len;
+	long				_pos;			// Samples in the current block
+	DynArray <double>
+							_freq_arr;		// Cycles per sample
+	DynArray <double>
+							_coef_arr;		// 2 * cos (2 * PI * frequency)
+	DynArray <double>
+							_state_arr;	// Two last outputs of each resonator
+	DynArray <double>
+							_power_arr;	// Results of the last complete block
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+							GoertzelBank (const GoertzelBank &other);
+	GoertzelBank &	operator = (const GoertzelBank &other);
+	bool				operator == (const GoertzelBank &other);
+	bool				operator != (const GoertzelBank &other);
+
+};	// class GoertzelBank
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/GoertzelBank.hpp"
+
+
+
+#endif	// ffft_GoertzelBank_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,297 @@
+/*****************************************************************************
+
+        GoertzelBank.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_GoertzelBank_CURRENT_CODEHEADER)
+	#error Recursive inclusion of GoertzelBank code header.
+#endif
+#define	ffft_GoertzelBank_CURRENT_CODEHEADER
+
+#if ! defined (ffft_GoertzelBank_CODEHEADER_INCLUDED)
+#define	ffft_GoertzelBank_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/def.h"
+
+#include	<algorithm>
+
+#include	<cassert>
+#include	<cmath>
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// The bank is empty, set_frequencies() or set_harmonics() tune it
+template <class DT>
+GoertzelBank <DT>::GoertzelBank (Allocator &allocator)
+:	_nbr_freq (0)
+,	_block_len (1)
+,	_pos (0)
+,	_freq_arr (allocator)
+,	_coef_arr (allocator)
+,	_state_arr (allocator)
+,	_power_arr (allocator)
+{
+	// Nothing
+}
+
+
+
+/*
+==============================================================================
+Name: set_frequencies
+Description:
+	Tune the resonators and start a new block. The powers of the previous
+	block are cleared.
+Input parameters:
+	- freq_arr: frequencies in cycles per sample, in [0 ; 0.5].
+	- nbr_freq: number of frequencies, 1 or more.
+	- block_len: length of the blocks in samples, 1 or more.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <class DT>
+void	GoertzelBank <DT>::set_frequencies (const double freq_arr [], int nbr_freq, long block_len)
+{
+	assert (freq_arr != 0);
+	assert (nbr_freq > 0);
+	assert (block_len > 0);
+
+	_freq_arr.resize (nbr_freq);
+	_coef_arr.resize (nbr_freq);
+	_state_arr.resize (nbr_freq * 2);
+	_power_arr.resize (nbr_freq);
+	_nbr_freq = nbr_freq;
+	_block_len = block_len;
+
+	for (int index = 0; index < nbr_freq; ++index)
+	{
+		assert (freq_arr [index] >= 0);
+		assert (freq_arr [index] <= 0.5);
+
+		_freq_arr [index] = freq_arr [index];
+		_coef_arr [index] = 2 * cos (2 * PI * freq_arr [index]);
+		_power_arr [index] = 0;
+	}
+
+	clear_buffers ();
+}
+
+
+
+/*
+==============================================================================
+Name: set_harmonics
+Description:
+	Tune the resonators on the first harmonics of a fundamental. The blocks
+	hold the smallest whole number of periods of the fundamental that makes
+	min_block_len samples or more. The block is rounded to the sample, so
+	harmonic k can be off its bin by k * fundamental / 2 bin at most.
+	Harmonics above 0.5 are clipped at 0.5.
+Input parameters:
+	- fundamental: frequency of the fundamental in cycles per sample, in
+		]0 ; 0.5].
+	- nbr_harmonics: number of harmonics, fundamental included, 1 or more.
+	- min_block_len: minimum length of the blocks, 1 or more.
+Returns: The block length.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+template <class DT>
+long	GoertzelBank <DT>::set_harmonics (double fundamental, int nbr_harmonics, long min_block_len)
+{
+	assert (fundamental > 0);
+	assert (fundamental <= 0.5);
+	assert (nbr_harmonics > 0);
+	assert (min_block_len > 0);
+
+	const double	nbr_periods = ceil (min_block_len * fundamental);
+	const long		block_len =
+		std::max (long (floor (nbr_periods / fundamental + 0.5)), 1L);
+
+	DynArray <double>	freq_arr (nbr_harmonics);
+	for (int index = 0; index < nbr_harmonics; ++index)
+	{
+		freq_arr [index] = std::min (fundamental * (index + 1), 0.5);
+	}
+	set_frequencies (&freq_arr [0], nbr_harmonics, block_len);
+
+	return (block_len);
+}
+
+
+
+template <class DT>
+int	GoertzelBank <DT>::get_nbr_frequencies () const
+{
+	return (_nbr_freq);
+}
+
+
+
+template <class DT>
+long	GoertzelBank <DT>::get_block_len () const
+{
+	return (_block_len);
+}
+
+
+
+template <class DT>
+double	GoertzelBank <DT>::get_frequency (int index) const
+{
+	assert (index >= 0);
+	assert (index < _nbr_freq);
+
+	return (_freq_arr [index]);
+}
+
+
+
+// Drops the block in progress, the powers of the last one are kept
+template <class DT>
+void	GoertzelBank <DT>::clear_buffers ()
+{
+	for (int index = 0; index < _nbr_freq * 2; ++index)
+	{
+		_state_arr [index] = 0;
+	}
+	_pos = 0;
+}
+
+
+
+/*
+==============================================================================
+Name: process
+Description:
+	Feed the resonators with a chunk of the stream. Chunks can have any
+	size, a block ends as soon as it is complete.
+Input parameters:
+	- x: samples, nbr_spl values.
+	- nbr_spl: number of samples, 0 or more.
+Returns: true if at least one block ended during this call. get_power()
+	gives the result of the last one.
+Throws: Nothing
+==============================================================================
+*/
+
+template <class DT>
+bool	GoertzelBank <DT>::process (const DataType x [], long nbr_spl)
+{
+	assert (x != 0);
+	assert (nbr_spl >= 0);
+
+	bool				end_flag = false;
+	long				pos = 0;
+	while (pos < nbr_spl && _nbr_freq > 0)
+	{
+		const long		work_len = std::min (nbr_spl - pos, _block_len - _pos);
+
+		// s [n] = x [n] + coef * s [n-1] - s [n-2]
+		for (int index = 0; index < _nbr_freq; ++index)
+		{
+			const double	coef = _coef_arr [index];
+			double			s1 = _state_arr [index * 2    ];
+			double			s2 = _state_arr [index * 2 + 1];
+			for (long spl = 0; spl < work_len; ++spl)
+			{
+				const double	s0 = x [pos + spl] + coef * s1 - s2;
+				s2 = s1;
+				s1 = s0;
+			}
+			_state_arr [index * 2    ] = s1;
+			_state_arr [index * 2 + 1] = s2;
+		}
+
+		_pos += work_len;
+		pos += work_len;
+		if (_pos == _block_len)
+		{
+			end_block ();
+			end_flag = true;
+		}
+	}
+
+	return (end_flag);
+}
+
+
+
+// Squared amplitude of a sinusoid on a bin, at the last complete block.
+// 0 until the first block ends.
+template <class DT>
+double	GoertzelBank <DT>::get_power (int index) const
+{
+	assert (index >= 0);
+	assert (index < _nbr_freq);
+
+	return (_power_arr [index]);
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// |X|^2 = s1^2 + s2^2 - coef * s1 * s2, scaled so a sinusoid of amplitude A
+// on a bin gives A^2
+template <class DT>
+void	GoertzelBank <DT>::end_block ()
+{
+	const double	scale = 4.0 / (double (_block_len) * double (_block_len));
+	for (int index = 0; index < _nbr_freq; ++index)
+	{
+		const double	s1 = _state_arr [index * 2    ];
+		const double	s2 = _state_arr [index * 2 + 1];
+		const double	power =
+			s1 * s1 + s2 * s2 - _coef_arr [index] * s1 * s2;
+		_power_arr [index] = std::max (power, 0.0) * scale;
+	}
+
+	clear_buffers ();
+}
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_GoertzelBank_CODEHEADER_INCLUDED
+
+#undef ffft_GoertzelBank_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -50,6 +50,8 @@ public:
 
 	ffft_FORCEINLINE void
 						set_step (double angle_rad);
+	ffft_FORCEINLINE double
+						get_step () const;
 
 	ffft_FORCEINLINE DataType
 						get_cos () const;
@@ -76,6 +78,7 @@ private:
 	DataType			_pos_sin;		// -
 	DataType			_step_cos;		// Phase increment per step, [-1 ; 1]
 	DataType			_step_sin;		// -
+	double			_step_angle;	// Full precision, for OscSinCosLanes
 
 
 
@@ -83,8 +86,6 @@ private:
 
 private:
 
-						OscSinCos (const OscSinCos &other);
-	OscSinCos &		operator = (const OscSinCos &other);
 	bool				operator == (const OscSinCos &other);
 	bool				operator != (const OscSinCos &other);
 
@@ -48,6 +48,7 @@ OscSinCos <T>::OscSinCos ()
 ,	_pos_sin (0)
 ,	_step_cos (1)
 ,	_step_sin (0)
+,	_step_angle (0)
 {
 	// Nothing
 }
@@ -61,6 +62,15 @@ void	OscSinCos <T>::set_step (double angle_rad)
 
 	_step_cos = static_cast <DataType> (cos (angle_rad));
 	_step_sin = static_cast <DataType> (sin (angle_rad));
+	_step_angle = angle_rad;
+}
+
+
+
+template <class T>
+double	OscSinCos <T>::get_step () const
+{
+	return (_step_angle);
 }
 
 
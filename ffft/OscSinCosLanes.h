@@ -0,0 +1,129 @@
+/*****************************************************************************
+
+        OscSinCosLanes.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_OscSinCosLanes_HEADER_INCLUDED)
+#define	ffft_OscSinCosLanes_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/def.h"
+
+
+
+namespace ffft
+{
+
+
+
+// Oscillator generating NL consecutive phases at once, for the vectorized
+// passes. The lanes are independent, so a step has no serial dependency
+// between them like OscSinCos::step(). Every RESEED_PER steps, the lanes are
+// set again from an anchor kept in double precision, so the single
+// precision error does not build up along the pass.
+// Starts on the phases 1...NL times the step angle, as OscSinCos after its
+// first step. The remaining lanes of the last group can be read with
+// get_cos() and get_sin() to finish a loop without stepping.
+template <class T, int NL>
+class OscSinCosLanes
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	typedef	T	DataType;
+
+	enum {			NBR_LANES	= NL	};
+
+	// Steps between two re-seedings, a power of 2
+	enum {			RESEED_PER	= 16	};
+
+							OscSinCosLanes ();
+
+	void				set_step (double angle_rad);
+
+	ffft_FORCEINLINE const DataType *
+							use_cos () const;
+	ffft_FORCEINLINE const DataType *
+							use_sin () const;
+	ffft_FORCEINLINE DataType
+							get_cos (int lane) const;
+	ffft_FORCEINLINE DataType
+							get_sin (int lane) const;
+	ffft_FORCEINLINE void
+							step ();
+	ffft_FORCEINLINE void
+							clear_buffers ();
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	void				reseed ();
+
+	DataType			_pos_cos [NL];	// Current phases of the lanes
+	DataType			_pos_sin [NL];	// -
+	DataType			_step_cos;		// Phase increment per step, NL times the angle
+	DataType			_step_sin;		// -
+	double				_lane_cos [NL];	// Phases 1...NL, for the re-seeding
+	double				_lane_sin [NL];	// -
+	double				_anchor_cos;	// Phase 0 of the lanes since the last re-seeding
+	double				_anchor_sin;	// -
+	double				_anchor_step_cos;	// RESEED_PER steps
+	double				_anchor_step_sin;	// -
+	int				_step_cnt;		// Steps since the last re-seeding
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	bool				operator == (const OscSinCosLanes &other);
+	bool				operator != (const OscSinCosLanes &other);
+
+};	// class OscSinCosLanes
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/OscSinCosLanes.hpp"
+
+
+
+#endif	// ffft_OscSinCosLanes_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,223 @@
+/*****************************************************************************
+
+        OscSinCosLanes.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_OscSinCosLanes_CURRENT_CODEHEADER)
+	#error Recursive inclusion of OscSinCosLanes code header.
+#endif
+#define	ffft_OscSinCosLanes_CURRENT_CODEHEADER
+
+#if ! defined (ffft_OscSinCosLanes_CODEHEADER_INCLUDED)
+#define	ffft_OscSinCosLanes_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	<cassert>
+#include	<cmath>
+
+namespace std { }
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <class T, int NL>
+OscSinCosLanes <T, NL>::OscSinCosLanes ()
+:	_step_cos (1)
+,	_step_sin (0)
+,	_anchor_cos (1)
+,	_anchor_sin (0)
+,	_anchor_step_cos (1)
+,	_anchor_step_sin (0)
+,	_step_cnt (0)
+{
+	for (int lane = 0; lane < NL; ++lane)
+	{
+		_pos_cos [lane] = 1;
+		_pos_sin [lane] = 0;
+		_lane_cos [lane] = 1;
+		_lane_sin [lane] = 0;
+	}
+}
+
+
+
+// A single sin/cos pair, the other phases are obtained by multiplication in
+// double precision.
+template <class T, int NL>
+void	OscSinCosLanes <T, NL>::set_step (double angle_rad)
+{
+	using namespace std;
+
+	const double	c = cos (angle_rad);
+	const double	s = sin (angle_rad);
+	double				lc = c;
+	double				ls = s;
+	for (int lane = 0; lane < NL; ++lane)
+	{
+		_lane_cos [lane] = lc;
+		_lane_sin [lane] = ls;
+		const double	old_c = lc;
+		lc = old_c * c - ls * s;
+		ls = old_c * s + ls * c;
+	}
+
+	// NL times the angle, then squared up to RESEED_PER steps
+	double				gc = _lane_cos [NL - 1];
+	double				gs = _lane_sin [NL - 1];
+	_step_cos = static_cast <DataType> (gc);
+	_step_sin = static_cast <DataType> (gs);
+	for (int n = 1; n < RESEED_PER; n <<= 1)
+	{
+		const double	old_c = gc;
+		gc = old_c * old_c - gs * gs;
+		gs = 2 * old_c * gs;
+	}
+	_anchor_step_cos = gc;
+	_anchor_step_sin = gs;
+
+	clear_buffers ();
+}
+
+
+
+// Cosines of the lanes, NL values
+template <class T, int NL>
+const typename OscSinCosLanes <T, NL>::DataType *	OscSinCosLanes <T, NL>::use_cos () const
+{
+	return (_pos_cos);
+}
+
+
+
+// Sines of the lanes, NL values
+template <class T, int NL>
+const typename OscSinCosLanes <T, NL>::DataType *	OscSinCosLanes <T, NL>::use_sin () const
+{
+	return (_pos_sin);
+}
+
+
+
+template <class T, int NL>
+typename OscSinCosLanes <T, NL>::DataType	OscSinCosLanes <T, NL>::get_cos (int lane) const
+{
+	assert (lane >= 0);
+	assert (lane < NL);
+
+	return (_pos_cos [lane]);
+}
+
+
+
+template <class T, int NL>
+typename OscSinCosLanes <T, NL>::DataType	OscSinCosLanes <T, NL>::get_sin (int lane) const
+{
+	assert (lane >= 0);
+	assert (lane < NL);
+
+	return (_pos_sin [lane]);
+}
+
+
+
+// Moves all the lanes NL phases forward
+template <class T, int NL>
+void	OscSinCosLanes <T, NL>::step ()
+{
+	++ _step_cnt;
+	if (_step_cnt == RESEED_PER)
+	{
+		reseed ();
+	}
+	else
+	{
+		for (int lane = 0; lane < NL; ++lane)
+		{
+			const DataType	old_cos = _pos_cos [lane];
+			const DataType	old_sin = _pos_sin [lane];
+			_pos_cos [lane] = old_cos * _step_cos - old_sin * _step_sin;
+			_pos_sin [lane] = old_cos * _step_sin + old_sin * _step_cos;
+		}
+	}
+}
+
+
+
+// Back to the phases 1...NL
+template <class T, int NL>
+void	OscSinCosLanes <T, NL>::clear_buffers ()
+{
+	_anchor_cos = 1;
+	_anchor_sin = 0;
+	_step_cnt = 0;
+	for (int lane = 0; lane < NL; ++lane)
+	{
+		_pos_cos [lane] = static_cast <DataType> (_lane_cos [lane]);
+		_pos_sin [lane] = static_cast <DataType> (_lane_sin [lane]);
+	}
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+template <class T, int NL>
+void	OscSinCosLanes <T, NL>::reseed ()
+{
+	const double	old_cos = _anchor_cos;
+	_anchor_cos = old_cos * _anchor_step_cos - _anchor_sin * _anchor_step_sin;
+	_anchor_sin = old_cos * _anchor_step_sin + _anchor_sin * _anchor_step_cos;
+	_step_cnt = 0;
+
+	for (int lane = 0; lane < NL; ++lane)
+	{
+		_pos_cos [lane] = static_cast <DataType> (
+			_anchor_cos * _lane_cos [lane] - _anchor_sin * _lane_sin [lane]
+		);
+		_pos_sin [lane] = static_cast <DataType> (
+			_anchor_cos * _lane_sin [lane] + _anchor_sin * _lane_cos [lane]
+		);
+	}
+}
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_OscSinCosLanes_CODEHEADER_INCLUDED
+
+#undef ffft_OscSinCosLanes_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
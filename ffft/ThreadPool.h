@@ -0,0 +1,173 @@
+/*****************************************************************************
+
+        ThreadPool.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_ThreadPool_HEADER_INCLUDED)
+#define	ffft_ThreadPool_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#if defined (_WIN32)
+	#if ! defined (WIN32_LEAN_AND_MEAN)
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#include	<windows.h>
+#else
+	#include	<pthread.h>
+#endif
+
+#include	<vector>
+
+
+
+namespace ffft
+{
+
+
+
+// Worker threads for the transforms that split their work in independent
+// parts, see FFTRealLarge::set_thread_pool(). run() hands the parts of a
+// task to the workers and to the calling thread, and returns when all of
+// them are done. A pool runs one task at a time, concurrent calls to run()
+// wait for their turn.
+class ThreadPool
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	class Task
+	{
+	public:
+		virtual		~Task () {}
+
+		// thread is in [0 ; get_nbr_threads ()[, 0 for the calling thread.
+		// Each thread has its own index, for its workspace.
+		virtual void	process (int part, int thread) = 0;
+	};
+
+	explicit inline	ThreadPool (int nbr_threads);
+	virtual inline	~ThreadPool ();
+
+	inline int		get_nbr_threads () const;
+	inline void		run (Task &task, int nbr_parts);
+
+	static inline int
+							count_cores ();
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+#if defined (_WIN32)
+	typedef	HANDLE	ThreadHandle;
+	static inline DWORD WINAPI
+							thread_entry (LPVOID param_ptr);
+#else
+	typedef	pthread_t	ThreadHandle;
+	static inline void *
+							thread_entry (void *param_ptr);
+#endif
+
+	class Worker
+	{
+	public:
+		ThreadPool *	_pool_ptr;
+		int				_thread;
+	};
+
+	inline void		work (int thread);
+	inline void		process_parts (int thread);
+	inline void		lock ();
+	inline void		unlock ();
+	inline void		wait_work ();
+	inline void		wait_done ();
+	inline void		signal_work ();
+	inline void		signal_done ();
+
+#if defined (_WIN32)
+	CRITICAL_SECTION
+							_mutex;
+	CONDITION_VARIABLE
+							_cond_work;	// The workers wait for a task or the end
+	CONDITION_VARIABLE
+							_cond_done;	// run() waits for the last part, or for the pool to be idle
+#else
+	pthread_mutex_t
+							_mutex;
+	pthread_cond_t
+							_cond_work;
+	pthread_cond_t
+							_cond_done;
+#endif
+
+	std::vector <ThreadHandle>
+							_thread_arr;
+	std::vector <Worker>
+							_worker_arr;
+
+	// Protected by the mutex
+	Task *			_task_ptr;	// 0 when idle
+	int				_nbr_parts;
+	int				_next_part;
+	int				_nbr_done;
+	long				_task_count;	// A new value tells the workers there is a new task
+	bool				_quit_flag;
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+							ThreadPool ();
+							ThreadPool (const ThreadPool &other);
+	ThreadPool &	operator = (const ThreadPool &other);
+	bool				operator == (const ThreadPool &other);
+	bool				operator != (const ThreadPool &other);
+
+};	// class ThreadPool
+
+
+
+}	// namespace ffft
+
+
+
+#include	"ffft/ThreadPool.hpp"
+
+
+
+#endif	// ffft_ThreadPool_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -0,0 +1,379 @@
+/*****************************************************************************
+
+        ThreadPool.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_ThreadPool_CURRENT_CODEHEADER)
+	#error Recursive inclusion of ThreadPool code header.
+#endif
+#define	ffft_ThreadPool_CURRENT_CODEHEADER
+
+#if ! defined (ffft_ThreadPool_CODEHEADER_INCLUDED)
+#define	ffft_ThreadPool_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#if ! defined (_WIN32)
+	#include	<unistd.h>
+#endif
+
+#include	<cassert>
+
+
+
+namespace ffft
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*
+==============================================================================
+Name: ctor
+Description:
+	Starts nbr_threads - 1 workers, the calling thread being the first one.
+	If the system cannot start them all, the pool runs with fewer threads.
+Input parameters:
+	- nbr_threads: total number of threads, > 0. count_cores() is a good
+		value.
+Throws: std::bad_alloc
+==============================================================================
+*/
+
+ThreadPool::ThreadPool (int nbr_threads)
+:	_thread_arr ()
+,	_worker_arr (nbr_threads)
+,	_task_ptr (0)
+,	_nbr_parts (0)
+,	_next_part (0)
+,	_nbr_done (0)
+,	_task_count (0)
+,	_quit_flag (false)
+{
+	assert (nbr_threads > 0);
+
+#if defined (_WIN32)
+	::InitializeCriticalSection (&_mutex);
+	::InitializeConditionVariable (&_cond_work);
+	::InitializeConditionVariable (&_cond_done);
+#else
+	::pthread_mutex_init (&_mutex, 0);
+	::pthread_cond_init (&_cond_work, 0);
+	::pthread_cond_init (&_cond_done, 0);
+#endif
+
+	// The workers keep a pointer on their slot, it must not move.
+	_thread_arr.reserve (nbr_threads);
+	for (int thread = 1; thread < nbr_threads; ++thread)
+	{
+		Worker &		worker = _worker_arr [thread];
+		worker._pool_ptr = this;
+		worker._thread = int (_thread_arr.size ()) + 1;
+
+#if defined (_WIN32)
+		const ThreadHandle	handle =
+			::CreateThread (0, 0, &thread_entry, &worker, 0, 0);
+		if (handle == 0)
+		{
+			break;
+		}
+#else
+		ThreadHandle	handle;
+		if (::pthread_create (&handle, 0, &thread_entry, &worker) != 0)
+		{
+			break;
+		}
+#endif
+
+		_thread_arr.push_back (handle);
+	}
+}
+
+
+
+ThreadPool::~ThreadPool ()
+{
+	lock ();
+	_quit_flag = true;
+	signal_work ();
+	unlock ();
+
+	for (size_t pos = 0; pos < _thread_arr.size (); ++pos)
+	{
+#if defined (_WIN32)
+		::WaitForSingleObject (_thread_arr [pos], INFINITE);
+		::CloseHandle (_thread_arr [pos]);
+#else
+		::pthread_join (_thread_arr [pos], 0);
+#endif
+	}
+
+#if defined (_WIN32)
+	::DeleteCriticalSection (&_mutex);
+#else
+	::pthread_cond_destroy (&_cond_done);
+	::pthread_cond_destroy (&_cond_work);
+	::pthread_mutex_destroy (&_mutex);
+#endif
+}
+
+
+
+// Workers actually running, plus the calling thread
+int	ThreadPool::get_nbr_threads () const
+{
+	return (int (_thread_arr.size ()) + 1);
+}
+
+
+
+/*
+==============================================================================
+Name: run
+Description:
+	Calls task.process() once for each part, from any thread of the pool,
+	including the calling one. Returns when all the parts are done.
+	Several threads may call it at the same time: the tasks run one after
+	the other, in no particular order. Must not be called from a task of the
+	same pool.
+Input parameters:
+	- nbr_parts: number of parts, > 0.
+Input/output parameters:
+	- task: the parts to process.
+Throws: Nothing
+==============================================================================
+*/
+
+void	ThreadPool::run (Task &task, int nbr_parts)
+{
+	assert (nbr_parts > 0);
+
+	if (_thread_arr.empty () || nbr_parts == 1)
+	{
+		for (int part = 0; part < nbr_parts; ++part)
+		{
+			task.process (part, 0);
+		}
+	}
+
+	else
+	{
+		lock ();
+		while (_task_ptr != 0)
+		{
+			wait_done ();
+		}
+		_task_ptr = &task;
+		_nbr_parts = nbr_parts;
+		_next_part = 0;
+		_nbr_done = 0;
+		++ _task_count;
+		signal_work ();
+
+		process_parts (0);
+		while (_nbr_done < _nbr_parts)
+		{
+			wait_done ();
+		}
+
+		// Wakes up the callers waiting for their turn
+		_task_ptr = 0;
+		signal_done ();
+		unlock ();
+	}
+}
+
+
+
+// Number of processors available to the program
+int	ThreadPool::count_cores ()
+{
+	int				nbr_cores = 1;
+
+#if defined (_WIN32)
+	SYSTEM_INFO	info;
+	::GetSystemInfo (&info);
+	nbr_cores = int (info.dwNumberOfProcessors);
+#elif defined (_SC_NPROCESSORS_ONLN)
+	nbr_cores = int (::sysconf (_SC_NPROCESSORS_ONLN));
+#endif
+
+	return ((nbr_cores > 0) ? nbr_cores : 1);
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+#if defined (_WIN32)
+
+DWORD WINAPI	ThreadPool::thread_entry (LPVOID param_ptr)
+{
+	Worker &		worker = *static_cast <Worker *> (param_ptr);
+	worker._pool_ptr->work (worker._thread);
+
+	return (0);
+}
+
+#else
+
+void *	ThreadPool::thread_entry (void *param_ptr)
+{
+	Worker &		worker = *static_cast <Worker *> (param_ptr);
+	worker._pool_ptr->work (worker._thread);
+
+	return (0);
+}
+
+#endif
+
+
+
+// Main loop of the workers
+void	ThreadPool::work (int thread)
+{
+	lock ();
+
+	long				task_count = _task_count;
+	while (! _quit_flag)
+	{
+		if (_task_count != task_count && _task_ptr != 0)
+		{
+			task_count = _task_count;
+			process_parts (thread);
+		}
+		else
+		{
+			wait_work ();
+		}
+	}
+
+	unlock ();
+}
+
+
+
+// Takes the parts left one after the other. Called and returns with the
+// mutex locked.
+void	ThreadPool::process_parts (int thread)
+{
+	Task &			task = *_task_ptr;
+	while (_next_part < _nbr_parts)
+	{
+		const int		part = _next_part;
+		++ _next_part;
+
+		unlock ();
+		task.process (part, thread);
+		lock ();
+
+		++ _nbr_done;
+		if (_nbr_done == _nbr_parts)
+		{
+			signal_done ();
+		}
+	}
+}
+
+
+
+void	ThreadPool::lock ()
+{
+#if defined (_WIN32)
+	::EnterCriticalSection (&_mutex);
+#else
+	::pthread_mutex_lock (&_mutex);
+#endif
+}
+
+
+
+void	ThreadPool::unlock ()
+{
+#if defined (_WIN32)
+	::LeaveCriticalSection (&_mutex);
+#else
+	::pthread_mutex_unlock (&_mutex);
+#endif
+}
+
+
+
+void	ThreadPool::wait_work ()
+{
+#if defined (_WIN32)
+	::SleepConditionVariableCS (&_cond_work, &_mutex, INFINITE);
+#else
+	::pthread_cond_wait (&_cond_work, &_mutex);
+#endif
+}
+
+
+
+void	ThreadPool::wait_done ()
+{
+#if defined (_WIN32)
+	::SleepConditionVariableCS (&_cond_done, &_mutex, INFINITE);
+#else
+	::pthread_cond_wait (&_cond_done, &_mutex);
+#endif
+}
+
+
+
+void	ThreadPool::signal_work ()
+{
+#if defined (_WIN32)
+	::WakeAllConditionVariable (&_cond_work);
+#else
+	::pthread_cond_broadcast (&_cond_work);
+#endif
+}
+
+
+
+// Wakes up all the waiters: the owner of the task and the next callers
+void	ThreadPool::signal_done ()
+{
+#if defined (_WIN32)
+	::WakeAllConditionVariable (&_cond_done);
+#else
+	::pthread_cond_broadcast (&_cond_done);
+#endif
+}
+
+
+
+}	// namespace ffft
+
+
+
+#endif	// ffft_ThreadPool_CODEHEADER_INCLUDED
+
+#undef ffft_ThreadPool_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
@@ -41,6 +41,10 @@ const double	SQRT2	= 1.41421356237309514547462185873883;
 
 	#define	ffft_FORCEINLINE	__forceinline
 
+#elif defined (__GNUC__)
+
+	#define	ffft_FORCEINLINE	inline __attribute__ ((always_inline))
+
 #else
 
 	#define	ffft_FORCEINLINE	inline
@@ -49,6 +53,69 @@ const double	SQRT2	= 1.41421356237309514547462185873883;
 
 
 
+// Vectorized passes (float only). Define ffft_NO_SIMD to build the scalar
+// code only.
+#if ! defined (ffft_NO_SIMD)
+
+	#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define	ffft_SIMD_SSE2
+	#endif
+
+	// AVX2 and AVX-512 code is always compiled in and picked at run-time if
+	// the CPU has it
+	#if defined (ffft_SIMD_SSE2) && (defined (_MSC_VER) || defined (__GNUC__))
+		#define	ffft_SIMD_AVX2
+	#endif
+	#if defined (ffft_SIMD_AVX2) && (! defined (_MSC_VER) || _MSC_VER >= 1910)
+		#define	ffft_SIMD_AVX512
+	#endif
+
+#endif
+
+#if defined (ffft_SIMD_AVX2) && defined (__GNUC__) && ! defined (__AVX2__)
+	#define	ffft_TARGET_AVX2	__attribute__ ((target ("avx2")))
+#else
+	#define	ffft_TARGET_AVX2
+#endif
+
+#if defined (ffft_SIMD_AVX512) && defined (__GNUC__) && ! defined (__AVX512F__)
+	#define	ffft_TARGET_AVX512	__attribute__ ((target ("avx512f")))
+#else
+	#define	ffft_TARGET_AVX512
+#endif
+
+// Alignment of the DynArray and Array storage, in bytes. A power of 2. The
+// default covers a cache line and an AVX-512 vector.
+#if ! defined (ffft_ALIGNMENT)
+	#define	ffft_ALIGNMENT	64
+#endif
+
+#if defined (_MSC_VER)
+	#define	ffft_ALIGN(a)	__declspec (align (a))
+#else
+	#define	ffft_ALIGN(a)	__attribute__ ((aligned (a)))
+#endif
+
+enum SimdLevel
+{
+	SimdLevel_AUTO = -1,	// Best level the CPU supports
+
+	SimdLevel_NONE = 0,
+	SimdLevel_SSE2,
+	SimdLevel_AVX2,
+	SimdLevel_AVX512
+};
+
+// Define ffft_SIMD_FORCE_LEVEL to one of the SimdLevel values to start with
+// this level instead of the detected one, for benchmarking or to reproduce a
+// problem seen on another machine. It is clipped to what the CPU supports.
+// FFTRealSimd::force_level() does the same at run-time.
+#if ! defined (ffft_SIMD_FORCE_LEVEL)
+	#define	ffft_SIMD_FORCE_LEVEL	ffft::SimdLevel_AUTO
+#endif
+
+
+
 }	// namespace ffft
 
 
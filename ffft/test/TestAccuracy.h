@@ -51,6 +51,7 @@ public:
    static int		perform_test_d (FO &fft, const char *class_name_0);
    static int		perform_test_i (FO &fft, const char *class_name_0);
    static int		perform_test_di (FO &fft, const char *class_name_0);
+   static int		perform_test_batch (FO &fft, const char *class_name_0);
 
 
 
@@ -31,6 +31,7 @@ http://sam.zoy.org/wtfpl/COPYING for more details.
 #include	"ffft/test/fnc.h"
 #include	"ffft/test/TestWhiteNoiseGen.h"
 
+#include	<algorithm>
 #include	<typeinfo>
 #include	<vector>
 
@@ -238,6 +239,72 @@ int	TestAccuracy <FO>::perform_test_di (FO &fft, const char *class_name_0)
 
 
 
+// Checks the multi-frame functions against the single-frame ones. The frame
+// count leaves an incomplete lane group, to exercise both code paths.
+template <class FO>
+int	TestAccuracy <FO>::perform_test_batch (FO &fft, const char *class_name_0)
+{
+	assert (&fft != 0);
+   assert (class_name_0 != 0);
+
+	using namespace std;
+
+	int				ret_val = 0;
+	const long		len = fft.get_length ();
+	const long		nbr_frames = 7;
+   const long     nbr_tests = limit (
+      NBR_ACC_TESTS / len / len,
+      1L,
+      static_cast <long> (MAX_NBR_TESTS)
+   );
+
+	printf (
+		"Testing %s::do_fft_batch () / do_ifft_batch () [%ld samples]... ",
+		class_name_0,
+		len
+	);
+	fflush (stdout);
+	TestWhiteNoiseGen <DataType>	noise;
+	std::vector <DataType>	x (len * nbr_frames);
+	std::vector <DataType>	s1 (len * nbr_frames);
+	std::vector <DataType>	s2 (len);
+	std::vector <DataType>	y1 (len * nbr_frames);
+	std::vector <DataType>	y2 (len);
+	BigFloat			err_avg = 0;
+
+	for (long test = 0; test < nbr_tests && ret_val == 0; ++ test)
+	{
+		noise.generate (&x [0], len * nbr_frames);
+		fft.do_fft_batch (&s1 [0], &x [0], nbr_frames);
+		fft.do_ifft_batch (&s1 [0], &y1 [0], nbr_frames);
+
+		for (long frame = 0; frame < nbr_frames; ++frame)
+		{
+			const long		ofs = frame * len;
+			fft.do_fft (&s2 [0], &x [ofs]);
+			fft.do_ifft (&s1 [ofs], &y2 [0]);
+
+			BigFloat			max_err_d;
+			BigFloat			max_err_i;
+			compare_vect_display (&s1 [ofs], &s2 [0], len, max_err_d);
+			compare_vect_display (&y1 [ofs], &y2 [0], len, max_err_i);
+			err_avg += max (max_err_d, max_err_i);
+		}
+	}
+	err_avg /= NBR_ACC_TESTS;
+
+	printf ("done.\n");
+	printf (
+		"Average maximum error: %.6f %% (%f dB)\n",
+		static_cast <double> (err_avg * 100),
+		static_cast <double> ((20 / TestAccuracy_LN10) * log (err_avg + 1e-300))
+	);
+
+	return (ret_val);
+}
+
+
+
 /*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
 
@@ -0,0 +1,142 @@
+/*****************************************************************************
+
+        TestFeatures.h
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if ! defined (ffft_test_TestFeatures_HEADER_INCLUDED)
+#define	ffft_test_TestFeatures_HEADER_INCLUDED
+
+#if defined (_MSC_VER)
+	#pragma once
+	#pragma warning (4 : 4250) // "Inherits via dominance."
+#endif
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/FFTRealLarge.h"
+#include	"ffft/ThreadPool.h"
+
+#include	<vector>
+
+
+
+namespace ffft
+{
+namespace test
+{
+
+
+
+// Checks of the objects that are not plain power-of-2 FFTs, or that need
+// more than the generic accuracy test. Each one prints its name and returns
+// 0 on success.
+class TestFeatures
+{
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+public:
+
+	static inline int	perform_test_allocator_arena ();
+	static inline int	perform_test_plan_cache ();
+	static inline int	perform_test_split ();
+	static inline int	perform_test_power ();
+	static inline int	perform_test_even ();
+	static inline int	perform_test_pruned ();
+	static inline int	perform_test_large ();
+	static inline int	perform_test_osc_lanes ();
+	static inline int	perform_test_complex ();
+	static inline int	perform_test_any_len ();
+	static inline int	perform_test_dct ();
+	static inline int	perform_test_convolver ();
+	static inline int	perform_test_goertzel ();
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+protected:
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+	// Transforms run from the threads of another pool, all on the same object
+	class ConcurrentTask
+	:	public ThreadPool::Task
+	{
+	public:
+		virtual inline void
+							process (int part, int thread);
+		const FFTRealLarge <float> *
+							_fft_ptr;
+		const float *	_x_ptr;
+		std::vector <std::vector <float> > *
+							_f_arr_ptr;		// One spectrum per part
+		std::vector <std::vector <float> > *
+							_ws_arr_ptr;	// One workspace per thread
+	};
+
+	template <class FFT>
+	static inline int	check_power (FFT &fft, long len);
+	template <class DT>
+	static inline int	check_large (long len, double tol, ThreadPool *pool_ptr);
+	static inline int	check_large_concurrent (ThreadPool &pool);
+	template <class FFT>
+	static inline int	check_float_precision (FFT &fft, long len);
+	template <class DT>
+	static inline int	check_complex (long len, double tol);
+	template <class DT>
+	static inline int	check_any_len (long len, double tol);
+	template <class FO>
+	static inline int	check_dct (const FO &fft, double tol);
+	template <class CO>
+	static inline int	check_convolver (long ir_len, bool corr_flag, double tol);
+	template <class DT>
+	static inline int	check_goertzel (double fundamental, double tol);
+
+
+
+/*\\\ FORBIDDEN MEMBER FUNCTIONS \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+private:
+
+						TestFeatures ();
+						TestFeatures (const TestFeatures &other);
+	TestFeatures &	operator = (const TestFeatures &other);
+	bool				operator == (const TestFeatures &other);
+	bool				operator != (const TestFeatures &other);
+
+};	// class TestFeatures
+
+
+
+}	// namespace test
+}	// namespace ffft
+
+
+
+#include	"ffft/test/TestFeatures.hpp"
+
+
+
+#endif	// ffft_test_TestFeatures_HEADER_INCLUDED
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
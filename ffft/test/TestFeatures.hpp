@@ -0,0 +1,1460 @@
+/*****************************************************************************
+
+        TestFeatures.hpp
+
+--- Legal stuff ---
+
+This program is free software. It comes without any warranty, to
+the extent permitted by applicable law. You can redistribute it
+and/or modify it under the terms of the Do What The Fuck You Want
+To Public License, Version 2, as published by Sam Hocevar. See
+http://sam.zoy.org/wtfpl/COPYING for more details.
+
+*Tab=3***********************************************************************/
+
+
+
+#if defined (ffft_test_TestFeatures_CURRENT_CODEHEADER)
+	#error Recursive inclusion of TestFeatures code header.
+#endif
+#define	ffft_test_TestFeatures_CURRENT_CODEHEADER
+
+#if ! defined (ffft_test_TestFeatures_CODEHEADER_INCLUDED)
+#define	ffft_test_TestFeatures_CODEHEADER_INCLUDED
+
+
+
+/*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+#include	"ffft/def.h"
+#include	"ffft/AllocatorArena.h"
+#include	"ffft/DynArray.h"
+#include	"ffft/FFTAnyLen.h"
+#include	"ffft/FFTComplex.h"
+#include	"ffft/FFTConvolver.h"
+#include	"ffft/FFTReal.h"
+#include	"ffft/FFTRealAnyLen.h"
+#include	"ffft/FFTRealDct.h"
+#include	"ffft/FFTRealEven.h"
+#include	"ffft/FFTRealFixLen.h"
+#include	"ffft/FFTRealLarge.h"
+#include	"ffft/FFTRealPlanCache.h"
+#include	"ffft/FFTRealPower.h"
+#include	"ffft/FFTRealSimd.h"
+#include	"ffft/FFTRealSplit.h"
+#include	"ffft/GoertzelBank.h"
+#include	"ffft/OscSinCosLanes.h"
+#include	"ffft/ThreadPool.h"
+
+#include	<algorithm>
+#include	<vector>
+
+#include	<cfloat>
+#include	<cmath>
+#include	<cstdio>
+#include	<cstring>
+
+
+
+namespace ffft
+{
+namespace test
+{
+
+
+
+/*\\\ PUBLIC \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// Blocks must be aligned on the requested boundary, including the ones
+// larger than the alignment of the chunks themselves, and still be aligned
+// when the request does not fit and a new chunk is taken.
+int	TestFeatures::perform_test_allocator_arena ()
+{
+	printf ("Testing ffft::AllocatorArena... ");
+	fflush (stdout);
+
+	int				ret_val = 0;
+
+	// Small chunks, so several requests need a new one
+	AllocatorArena	arena (1000);
+
+	const size_t	align_arr [] = { 1, 4, 16, 64, 128, 256 };
+	const int		nbr_align = sizeof (align_arr) / sizeof (align_arr [0]);
+	for (int pass = 0; pass < 2 && ret_val == 0; ++pass)
+	{
+		for (int k = 0; k < nbr_align * 4 && ret_val == 0; ++k)
+		{
+			const size_t	align = align_arr [k % nbr_align];
+			const size_t	size = 100 + k * 37;
+			char *			ptr = static_cast <char *> (arena.allocate (size, align));
+			if (reinterpret_cast <size_t> (ptr) % align != 0)
+			{
+				printf (
+					"\n*** Block of %d bytes not aligned on %d bytes.\n",
+					int (size),
+					int (align)
+				);
+				ret_val = -1;
+			}
+			else
+			{
+				// Writes past the chunk end are caught by memory checkers
+				memset (ptr, 0, size);
+			}
+		}
+
+		// Second pass on the merged chunk
+		arena.reset ();
+	}
+
+	if (ret_val == 0)
+	{
+		DynArray <float, 128>	arr_128 (10, arena);
+		DynArray <float, 256>	arr_256 (10, arena);
+		if (   reinterpret_cast <size_t> (&arr_128 [0]) % 128 != 0
+		    || reinterpret_cast <size_t> (&arr_256 [0]) % 256 != 0)
+		{
+			printf ("\n*** DynArray storage not aligned.\n");
+			ret_val = -1;
+		}
+	}
+
+	if (ret_val == 0)
+	{
+		printf ("done.\n\n");
+	}
+
+	return (ret_val);
+}
+
+
+
+// Each plan is built once, then the same object is returned
+int	TestFeatures::perform_test_plan_cache ()
+{
+	typedef	FFTRealPlanCache <float>	Cache;
+
+	printf ("Testing ffft::FFTRealPlanCache... ");
+	fflush (stdout);
+
+	const long		nbr_hits = Cache::get_nbr_hits ();
+	const long		nbr_misses = Cache::get_nbr_misses ();
+
+	const Cache::PlanType &	plan_1 = Cache::use_plan (1024);
+	const Cache::PlanType &	plan_2 = Cache::use_plan (1024);
+	const FFTRealFixLenIface &	fixlen_1 = Cache::use_fixlen_plan (10);
+	const FFTRealFixLenIface &	fixlen_2 = Cache::use_fixlen_plan (10);
+
+	int				ret_val = 0;
+	if (   &plan_1 != &plan_2
+	    || plan_1.get_length () != 1024
+	    || &fixlen_1 != &fixlen_2
+	    || fixlen_1.get_length () != 1024
+	    || Cache::get_nbr_hits () != nbr_hits + 3	// + FixLen batch engine
+	    || Cache::get_nbr_misses () != nbr_misses + 2)
+	{
+		printf ("\n*** Plans are not shared as expected.\n");
+		ret_val = -1;
+	}
+	else
+	{
+		printf ("done.\n\n");
+	}
+
+	return (ret_val);
+}
+
+
+
+// The split view gives the bins of a plain DFT, conjugates included
+int	TestFeatures::perform_test_split ()
+{
+	printf ("Testing ffft::FFTRealSplit... ");
+	fflush (stdout);
+
+	const long		len = 16;
+	const double	pi = 3.1415926535897932384626433832795;
+	float				x [len];
+	float				f [len];
+	for (long pos = 0; pos < len; ++pos)
+	{
+		x [pos] = float (
+			  0.25
+			+ cos (2 * pi * 3 * pos / len)
+			+ 0.5 * sin (2 * pi * 5 * pos / len)
+			- 0.75 * cos (2 * pi * 8 * pos / len)
+		);
+	}
+
+	FFTRealFixLen <4>	fft;
+	fft.do_fft (f, x);
+	const FFTRealSplit <float>	split (f, len);
+
+	int				ret_val = 0;
+	for (long bin = 0; bin < len && ret_val == 0; ++bin)
+	{
+		double			re = 0;
+		double			im = 0;
+		for (long pos = 0; pos < len; ++pos)
+		{
+			const double	a = -2 * pi * bin * pos / len;
+			re += x [pos] * cos (a);
+			im += x [pos] * sin (a);
+		}
+
+		if (   fabs (split.get_re (bin) - re) > 1e-4
+		    || fabs (split.get_im (bin) - im) > 1e-4)
+		{
+			printf (
+				"\n*** Bin %ld: (%f, %f) instead of (%f, %f).\n",
+				bin,
+				split.get_re (bin),
+				split.get_im (bin),
+				re,
+				im
+			);
+			ret_val = -1;
+		}
+	}
+
+	if (   ret_val == 0
+	    && (   split.get_re_ptr () != f
+	        || split.get_neg_im_ptr () != f + len / 2
+	        || split.get_nbr_bins () != len / 2))
+	{
+		printf ("\n*** The view does not point at the spectrum.\n");
+		ret_val = -1;
+	}
+
+	if (ret_val == 0)
+	{
+		printf ("done.\n\n");
+	}
+
+	return (ret_val);
+}
+
+
+
+// The fast cube root stays within its error bound, and do_power_spectrum()
+// matches the FFT followed by a plain pow(), with and without SIMD.
+int	TestFeatures::perform_test_power ()
+{
+	printf ("Testing ffft::FFTRealPower... ");
+	fflush (stdout);
+
+	int				ret_val = 0;
+
+	double			max_err = 0;
+	for (float x = FLT_MIN; x < 1e37f; x *= 1.001f)
+	{
+		const double	ref = pow (double (x), 1.0 / 3);
+		const double	err = fabs (FFTRealPower <float>::fast_cbrt (x) - ref) / ref;
+		if (err > max_err)
+		{
+			max_err = err;
+		}
+	}
+	if (max_err > 1.5e-6 || FFTRealPower <float>::fast_cbrt (0) != 0)
+	{
+		printf ("\n*** fast_cbrt(): relative error %g.\n", max_err);
+		ret_val = -1;
+	}
+
+	// The last sweep gives the powers from 64 points, with oscillators from
+	// 2^14 (FFTRealFixLen) or 2^15 (FFTReal) points
+	for (int level = SimdLevel_NONE; level <= SimdLevel_AVX512 && ret_val == 0; ++level)
+	{
+		FFTRealSimd <float>::force_level (level);
+
+		for (long len = 8; len <= (1L << 15) && ret_val == 0; len *= 8)
+		{
+			FFTReal <float>	fft (len);
+			ret_val = check_power (fft, len);
+		}
+		if (ret_val == 0)
+		{
+			FFTRealFixLen <10, float>	fft;
+			ret_val = check_power (fft, fft.get_length ());
+		}
+		if (ret_val == 0)
+		{
+			FFTRealFixLen <14, float>	fft;
+			ret_val = check_power (fft, fft.get_length ());
+		}
+	}
+	FFTRealSimd <float>::force_level (SimdLevel_AUTO);
+
+	if (ret_val == 0)
+	{
+		printf ("done.\n\n");
+	}
+
+	return (ret_val);
+}
+
+
+
+// FFTRealEven matches the cosine sum for any number of bins, in place too
+int	TestFeatures::perform_test_even ()
+{
+	printf ("Testing ffft::FFTRealEven... ");
+	fflush (stdout);
+
+	int				ret_val = 0;
+
+	const long		len_arr [] = { 4, 8, 16, 1024, 4096 };
+	const int		nbr_len = sizeof (len_arr) / sizeof (len_arr [0]);
+	const double	pi = 3.1415926535897932384626433832795;
+	for (int level = SimdLevel_NONE; level <= SimdLevel_AVX512 && ret_val == 0; ++level)
+	{
+		FFTRealSimd <float>::force_level (level);
+
+		for (int k = 0; k < nbr_len && ret_val == 0; ++k)
+		{
+			const long		len = len_arr [k];
+			const long		half = len / 2;
+			FFTRealEven <float>	even (len);
+			std::vector <float>	x (half + 1);
+			std::vector <float>	f (half + 1);
+			for (long pos = 0; pos <= half; ++pos)
+			{
+				x [pos] = float ((pos * 7919) % 61) * (1.0f / 61) - 0.25f;
+			}
+
+			const long		bins_arr [] = { 1, 2, 3, half, half + 1 };
+			for (int b = 0; b < 5 && ret_val == 0; ++b)
+			{
+				const long		nbr_bins = bins_arr [b];
+				even.do_fft (&f [0], &x [0], nbr_bins);
+
+				for (long bin = 0; bin < nbr_bins && ret_val == 0; ++bin)
+				{
+					double			ref = x [0] + ((bin & 1) ? -x [half] : x [half]);
+					for (long pos = 1; pos < half; ++pos)
+					{
+						ref += 2 * x [pos] * cos (2 * pi * pos * bin / len);
+					}
+					if (fabs (f [bin] - ref) > 1e-5 * len)
+					{
+						printf (
+							"\n*** Length %ld, %ld bins, bin %ld: %f instead of %f.\n",
+							len,
+							nbr_bins,
+							bin,
+							f [bin],
+							ref
+						);
+						ret_val = -1;
+					}
+				}
+			}
+
+			std::vector <float>	y (x);
+			even.do_fft (&y [0], &y [0], half + 1);
+			for (long bin = 0; bin <= half && ret_val == 0; ++bin)
+			{
+				if (y [bin] != f [bin])
+				{
+					printf ("\n*** Length %ld: in-place transform differs.\n", len);
+					ret_val = -1;
+				}
+			}
+		}
+	}
+	FFTRealSimd <float>::force_level (SimdLevel_AUTO);
+
+	if (   ret_val == 0
+	    && (   &FFTRealPlanCache <float>::use_even_plan (2048)
+	        != &FFTRealPlanCache <float>::use_even_plan (2048)))
+	{
+		printf ("\n*** Even plans are not shared.\n");
+		ret_val = -1;
+	}
+
+	if (ret_val == 0)
+	{
+		printf ("done.\n\n");
+	}
+
+	return (ret_val);
+}
+
+
+
+// do_fft_pruned() matches do_fft() on zero-padded data, whatever the number
+// of skipped passes
+int	TestFeatures::perform_test_pruned ()
+{
+	printf ("Testing ffft::FFTReal::do_fft_pruned ()... ");
+	fflush (stdout);
+
+	int				ret_val = 0;
+
+	for (int level = SimdLevel_NONE; level <= SimdLevel_AVX512 && ret_val == 0; ++level)
+	{
+		FFTRealSimd <float>::force_level (level);
+
+		for (long len = 1; len <= 8192 && ret_val == 0; len *= 2)
+		{
+			FFTReal <float>	fft (len);
+			std::vector <float>	x (len);
+			std::vector <float>	f (len);
+			std::vector <float>	f_ref (len);
+
+			const long		nbr_arr [] = { 1, 2, 3, len / 8 + 1, len / 4, len / 4 + 1, len / 2, len };
+			const int		nbr_cases = sizeof (nbr_arr) / sizeof (nbr_arr [0]);
+			for (int c = 0; c < nbr_cases && ret_val == 0; ++c)
+			{
+				const long		nbr_samples = nbr_arr [c];
+				if (nbr_samples < 1 || nbr_samples > len)
+				{
+					continue;
+				}
+
+				for (long pos = 0; pos < len; ++pos)
+				{
+					x [pos] = (pos < nbr_samples)
+						? float ((pos * 7919) % 61) * (1.0f / 61) - 0.5f
+						: 0.0f;
+				}
+
+				fft.do_fft (&f_ref [0], &x [0]);
+				fft.do_fft_pruned (&f [0], &x [0], nbr_samples);
+				for (long bin = 0; bin < len && ret_val == 0; ++bin)
+				{
+					if (fabs (f [bin] - f_ref [bin]) > 1e-3)
+					{
+						printf (
+							"\n*** Length %ld, %ld samples, bin %ld: %f instead of %f.\n",
+							len,
+							nbr_samples,
+							bin,
+							f [bin],
+							f_ref [bin]
+						);
+						ret_val = -1;
+					}
+				}
+			}
+		}
+	}
+	FFTRealSimd <float>::force_level (SimdLevel_AUTO);
+
+	if (ret_val == 0)
+	{
+		printf ("done.\n\n");
+	}
+
+	return (ret_val);
+}
+
+
+
+// FFTRealLarge against FFTReal in double precision. The float version of
+// FFTReal is not the reference, it loses some precision on long lengths.
+int	TestFeatures::perform_test_large ()
+{
+	printf ("Testing ffft::FFTRealLarge... ");
+	fflush (stdout);
+
+	int				ret_val = 0;
+
+	// Odd number of threads, so the parts are not evenly shared
+	ThreadPool	pool (3);
+
+	for (long len = 4; len <= (1L << 17) && ret_val == 0; len *= 2)
+	{
+		ret_val = check_large <float> (len, 1e-5, 0);
+		if (ret_val == 0)
+		{
+			ret_val = check_large <double> (len, 1e-12, 0);
+		}
+		if (ret_val == 0 && len >= (1L << 16))
+		{
+			ret_val = check_large <float> (len, 1e-5, &pool);
+		}
+	}
+
+	if (ret_val == 0)
+	{
+		ret_val = check_large_concurrent (pool);
+	}
+
+	if (ret_val == 0)
+	{
+		printf ("done.\n\n");
+	}
+
+	return (ret_val);
+}
+
+
+
+// The lanes against sin/cos along a long pass, then the float transforms
+// that use them, above FFTRealFixLenParam::TRIGO_BD_LIMIT. A single
+// OscSinCos drifts to about 1e-4 there.
+int	TestFeatures::perform_test_osc_lanes ()
+{
+	printf ("Testing ffft::OscSinCosLanes... ");
+	fflush (stdout);
+
+	int				ret_val = 0;
+
+	const long		len = 1L << 17;
+	const double	angle = 2 * PI / (len * 4);
+	OscSinCosLanes <float, 8>	osc;
+	osc.set_step (angle);
+	for (long pos = 1; pos < len && ret_val == 0; pos += 8)
+	{
+		for (int lane = 0; lane < 8 && ret_val == 0; ++lane)
+		{
+			const double	phase = (pos + lane) * angle;
+			const double	err = std::max (
+				fabs (osc.get_cos (lane) - cos (phase)),
+				fabs (osc.get_sin (lane) - sin (phase))
+			);
+			if (err > 1e-6)
+			{
+				printf ("\n*** Phase %ld: error %g.\n", pos + lane, err);
+				ret_val = -1;
+			}
+		}
+		osc.step ();
+	}
+
+	// Only the vectorized passes use the lanes
+	if (FFTRealSimd <float>::get_level () != SimdLevel_NONE)
+	{
+		for (long len = 1L << 15; len <= (1L << 17) && ret_val == 0; len *= 2)
+		{
+			FFTReal <float>	fft (len);
+			ret_val = check_float_precision (fft, len);
+		}
+		if (ret_val == 0)
+		{
+			FFTRealFixLen <16, float>	fft;
+			ret_val = check_float_precision (fft, fft.get_length ());
+		}
+	}
+
+	if (ret_val == 0)
+	{
+		printf ("done.\n\n");
+	}
+
+	return (ret_val);
+}
+
+
+
+int	TestFeatures::perform_test_complex ()
+{
+	printf ("Testing ffft::FFTComplex... ");
+	fflush (stdout);
+
+	int				ret_val = 0;
+
+	for (long len = 2; len <= 1024 && ret_val == 0; len *= 2)
+	{
+		ret_val = check_complex <float> (len, 1e-5);
+		if (ret_val == 0)
+		{
+			ret_val = check_complex <double> (len, 1e-12);
+		}
+	}
+
+	if (ret_val == 0)
+	{
+		printf ("done.\n\n");
+	}
+
+	return (ret_val);
+}
+
+
+
+int	TestFeatures::perform_test_any_len ()
+{
+	printf ("Testing ffft::FFTAnyLen and ffft::FFTRealAnyLen... ");
+	fflush (stdout);
+
+	// Small lengths cover every radix and the Bluestein algorithm. 96 and
+	// 1920 are mixed radix, 97 is prime, 2205 = 3^2 * 5 * 7^2.
+	static const long	len_arr [] = { 96, 97, 1000, 1920, 2205 };
+	const int		nbr_len = int (sizeof (len_arr) / sizeof (len_arr [0]));
+
+	int				ret_val = 0;
+
+	for (int index = 0; index < 40 + nbr_len && ret_val == 0; ++index)
+	{
+		const long		len = (index < 40) ? index + 1 : len_arr [index - 40];
+		ret_val = check_any_len <float> (len, 1e-5);
+		if (ret_val == 0)
+		{
+			ret_val = check_any_len <double> (len, 1e-12);
+		}
+	}
+
+	if (ret_val == 0)
+	{
+		printf ("done.\n\n");
+	}
+
+	return (ret_val);
+}
+
+
+
+int	TestFeatures::perform_test_dct ()
+{
+	printf ("Testing ffft::FFTRealDct... ");
+	fflush (stdout);
+
+	int				ret_val = 0;
+
+	for (long len = 2; len <= 1024 && ret_val == 0; len *= 2)
+	{
+		FFTReal <float>	fft_flt (len);
+		FFTReal <double>	fft_dbl (len);
+		ret_val = check_dct (fft_flt, 1e-5);
+		if (ret_val == 0)
+		{
+			ret_val = check_dct (fft_dbl, 1e-12);
+		}
+	}
+
+	if (ret_val == 0)
+	{
+		FFTRealFixLen <9, float>	fft_fix;
+		ret_val = check_dct (fft_fix, 1e-5);
+	}
+
+	if (ret_val == 0)
+	{
+		printf ("done.\n\n");
+	}
+
+	return (ret_val);
+}
+
+
+
+int	TestFeatures::perform_test_convolver ()
+{
+	printf ("Testing ffft::FFTConvolver... ");
+	fflush (stdout);
+
+	typedef	FFTConvolver <6, float>	ConvFlt;	// Blocks of 32 samples
+	typedef	FFTConvolver <6, double>	ConvDbl;
+
+	// Shorter and longer than a block, and several partitions
+	static const long	len_arr [] = { 1, 2, 31, 32, 33, 64, 65, 200 };
+	const int		nbr_len = int (sizeof (len_arr) / sizeof (len_arr [0]));
+
+	int				ret_val = 0;
+
+	for (int index = 0; index < nbr_len && ret_val == 0; ++index)
+	{
+		const long		ir_len = len_arr [index];
+		ret_val = check_convolver <ConvFlt> (ir_len, false, 1e-5);
+		if (ret_val == 0)
+		{
+			ret_val = check_convolver <ConvDbl> (ir_len, false, 1e-12);
+		}
+		if (ret_val == 0)
+		{
+			ret_val = check_convolver <ConvDbl> (ir_len, true, 1e-12);
+		}
+	}
+
+	if (ret_val == 0)
+	{
+		printf ("done.\n\n");
+	}
+
+	return (ret_val);
+}
+
+
+
+int	TestFeatures::perform_test_goertzel ()
+{
+	printf ("Testing ffft::GoertzelBank... ");
+	fflush (stdout);
+
+	// From a low bass note to a fundamental with clipped harmonics. All of
+	// them are a whole number of periods in a whole number of samples, so
+	// the harmonics are exactly on the bins.
+	static const double	fund_arr [] = { 1.0 / 1070, 1.0 / 200, 1.0 / 27, 0.13 };
+	const int		nbr_fund = int (sizeof (fund_arr) / sizeof (fund_arr [0]));
+
+	int				ret_val = 0;
+
+	for (int index = 0; index < nbr_fund && ret_val == 0; ++index)
+	{
+		ret_val = check_goertzel <float> (fund_arr [index], 1e-4);
+		if (ret_val == 0)
+		{
+			ret_val = check_goertzel <double> (fund_arr [index], 1e-9);
+		}
+	}
+
+	if (ret_val == 0)
+	{
+		printf ("done.\n\n");
+	}
+
+	return (ret_val);
+}
+
+
+
+/*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+/*\\\ PRIVATE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
+
+
+
+// do_power_spectrum() against the spectrum of do_fft(), for each exponent.
+// The last passes may use other kernels, so the magnitudes are compared,
+// relative to the largest one.
+template <class FFT>
+int	TestFeatures::check_power (FFT &fft, long len)
+{
+	const double	pi = 3.1415926535897932384626433832795;
+	const float		exp_arr [4] = { 1.0f, 0.5f, float (1.0 / 3), 0.25f };
+	std::vector <float>	x (len);
+	std::vector <float>	f (len);
+	std::vector <float>	out (len);
+	for (long pos = 0; pos < len; ++pos)
+	{
+		x [pos] = float (
+			  0.125
+			+ cos (2 * pi * 37 * pos / len)
+			+ 1e-3 * sin (2 * pi * 100.5 * pos / len)
+			+ ((pos * 7919) % 61) * (1.0 / 61) - 0.5
+		);
+	}
+
+	fft.do_fft (&f [0], &x [0]);
+
+	std::vector <double>	mag (len / 2 + 1);
+	double			max_mag = 0;
+	for (long bin = 0; bin <= len / 2; ++bin)
+	{
+		const double	re = f [bin];
+		const double	im = (bin > 0 && bin < len / 2) ? f [len / 2 + bin] : 0;
+		mag [bin] = sqrt (re * re + im * im);
+		max_mag = std::max (max_mag, mag [bin]);
+	}
+
+	int				ret_val = 0;
+	for (int e = 0; e < 4 && ret_val == 0; ++e)
+	{
+		fft.do_power_spectrum (&out [0], &x [0], exp_arr [e]);
+
+		for (long bin = 0; bin <= len / 2 && ret_val == 0; ++bin)
+		{
+			const double	val = pow (double (out [bin]), 0.5 / exp_arr [e]);
+			if (fabs (val - mag [bin]) > 1e-5 * max_mag)
+			{
+				printf (
+					"\n*** Length %ld, exponent %f, bin %ld: magnitude %g instead of %g.\n",
+					len,
+					exp_arr [e],
+					bin,
+					val,
+					mag [bin]
+				);
+				ret_val = -1;
+			}
+		}
+	}
+
+	return (ret_val);
+}
+
+
+
+// tol is relative to the largest value. pool_ptr may be 0.
+template <class DT>
+int	TestFeatures::check_large (long len, double tol, ThreadPool *pool_ptr)
+{
+	FFTReal <double>	fft_ref (len);
+	FFTRealLarge <DT>	fft (len);
+	fft.set_thread_pool (pool_ptr);
+
+	std::vector <double>	x_ref (len);
+	std::vector <double>	f_ref (len);
+	std::vector <DT>	x (len);
+	std::vector <DT>	f (len);
+	for (long pos = 0; pos < len; ++pos)
+	{
+		x [pos] = DT ((pos * 7919) % 61) * DT (1.0 / 61) - DT (0.5);
+		x_ref [pos] = x [pos];
+	}
+
+	int				ret_val = 0;
+
+	fft_ref.do_fft (&f_ref [0], &x_ref [0]);
+	fft.do_fft (&f [0], &x [0]);
+	double			max_val = 0;
+	for (long pos = 0; pos < len; ++pos)
+	{
+		max_val = std::max (max_val, fabs (f_ref [pos]));
+	}
+	for (long pos = 0; pos < len && ret_val == 0; ++pos)
+	{
+		if (fabs (f [pos] - f_ref [pos]) > tol * max_val)
+		{
+			printf ("\n*** Length %ld, bin %ld: %f instead of %f.\n", len, pos, double (f [pos]), f_ref [pos]);
+			ret_val = -1;
+		}
+	}
+
+	for (long pos = 0; pos < len; ++pos)
+	{
+		f [pos] = DT (f_ref [pos]);
+	}
+	fft.do_ifft (&f [0], &x [0]);
+	fft.rescale (&x [0]);
+	for (long pos = 0; pos < len && ret_val == 0; ++pos)
+	{
+		if (fabs (x [pos] - x_ref [pos]) > tol)
+		{
+			printf ("\n*** Inverse, length %ld, position %ld: %f instead of %f.\n", len, pos, double (x [pos]), x_ref [pos]);
+			ret_val = -1;
+		}
+	}
+
+	return (ret_val);
+}
+
+
+
+// Several threads share the object and its pool: their calls to
+// ThreadPool::run() must take turns and give the same result as a lone call.
+int	TestFeatures::check_large_concurrent (ThreadPool &pool)
+{
+	const long		len = 1L << 16;
+	const int		nbr_callers = 3;
+	const int		nbr_parts = 8;
+
+	FFTRealLarge <float>	fft (len);
+	fft.set_thread_pool (&pool);
+
+	std::vector <float>	x (len);
+	for (long pos = 0; pos < len; ++pos)
+	{
+		x [pos] = float ((pos * 7919) % 61) * float (1.0 / 61) - 0.5f;
+	}
+	std::vector <float>	f_ref (len);
+	std::vector <float>	ws (fft.get_workspace_len ());
+	fft.do_fft (&f_ref [0], &x [0], &ws [0]);
+
+	std::vector <std::vector <float> >	f_arr (
+		nbr_parts,
+		std::vector <float> (len)
+	);
+	std::vector <std::vector <float> >	ws_arr (
+		nbr_callers,
+		std::vector <float> (fft.get_workspace_len ())
+	);
+	ConcurrentTask	task;
+	task._fft_ptr = &fft;
+	task._x_ptr = &x [0];
+	task._f_arr_ptr = &f_arr;
+	task._ws_arr_ptr = &ws_arr;
+
+	ThreadPool		callers (nbr_callers);
+	callers.run (task, nbr_parts);
+
+	int				ret_val = 0;
+	for (int part = 0; part < nbr_parts && ret_val == 0; ++part)
+	{
+		for (long pos = 0; pos < len && ret_val == 0; ++pos)
+		{
+			if (f_arr [part] [pos] != f_ref [pos])
+			{
+				printf ("\n*** Concurrent call %d, bin %ld: %f instead of %f.\n", part, pos, f_arr [part] [pos], f_ref [pos]);
+				ret_val = -1;
+			}
+		}
+	}
+
+	return (ret_val);
+}
+
+
+
+void	TestFeatures::ConcurrentTask::process (int part, int thread)
+{
+	_fft_ptr->do_fft (
+		&(*_f_arr_ptr) [part] [0],
+		_x_ptr,
+		&(*_ws_arr_ptr) [thread] [0]
+	);
+}
+
+
+
+// Forward transform against FFTReal <double>, relative to the largest bin
+template <class FFT>
+int	TestFeatures::check_float_precision (FFT &fft, long len)
+{
+	FFTReal <double>	fft_ref (len);
+
+	std::vector <double>	x_ref (len);
+	std::vector <double>	f_ref (len);
+	std::vector <float>	x (len);
+	std::vector <float>	f (len);
+	for (long pos = 0; pos < len; ++pos)
+	{
+		x [pos] = float ((pos * 7919) % 61) * (1.0f / 61) - 0.5f;
+		x_ref [pos] = x [pos];
+	}
+
+	fft_ref.do_fft (&f_ref [0], &x_ref [0]);
+	fft.do_fft (&f [0], &x [0]);
+
+	double			max_val = 0;
+	double			max_err = 0;
+	for (long pos = 0; pos < len; ++pos)
+	{
+		max_val = std::max (max_val, fabs (f_ref [pos]));
+		max_err = std::max (max_err, fabs (f [pos] - f_ref [pos]));
+	}
+
+	int				ret_val = 0;
+	if (max_err > max_val * 2e-6)
+	{
+		printf ("\n*** Length %ld: relative error %g.\n", len, max_err / max_val);
+		ret_val = -1;
+	}
+
+	return (ret_val);
+}
+
+
+
+// Against a direct DFT in double precision. tol is relative to the largest
+// bin. The inverse transform is done in place, then the forward one too.
+// do_fft_pair() is checked against FFTReal.
+template <class DT>
+int	TestFeatures::check_complex (long len, double tol)
+{
+	FFTComplex <DT>	fft (len);
+
+	std::vector <DT>	xr (len);
+	std::vector <DT>	xi (len);
+	std::vector <DT>	fr (len);
+	std::vector <DT>	fi (len);
+	for (long pos = 0; pos < len; ++pos)
+	{
+		xr [pos] = DT ((pos * 7919) % 61) * DT (1.0 / 61) - DT (0.5);
+		xi [pos] = DT ((pos * 104729) % 53) * DT (1.0 / 53) - DT (0.5);
+	}
+
+	int				ret_val = 0;
+
+	fft.do_fft (&fr [0], &fi [0], &xr [0], &xi [0]);
+
+	std::vector <double>	ref_r (len);
+	std::vector <double>	ref_i (len);
+	double			max_val = 0;
+	for (long bin = 0; bin < len; ++bin)
+	{
+		double			sum_r = 0;
+		double			sum_i = 0;
+		for (long pos = 0; pos < len; ++pos)
+		{
+			// Exact phase, reduced before the multiplication
+			const double	a = -2 * PI * ((bin * pos) % len) / len;
+			sum_r += xr [pos] * cos (a) - xi [pos] * sin (a);
+			sum_i += xr [pos] * sin (a) + xi [pos] * cos (a);
+		}
+		ref_r [bin] = sum_r;
+		ref_i [bin] = sum_i;
+		max_val = std::max (max_val, std::max (fabs (sum_r), fabs (sum_i)));
+	}
+	for (long bin = 0; bin < len && ret_val == 0; ++bin)
+	{
+		const double	err = std::max (
+			fabs (fr [bin] - ref_r [bin]),
+			fabs (fi [bin] - ref_i [bin])
+		);
+		if (err > tol * max_val)
+		{
+			printf (
+				"\n*** Length %ld, bin %ld: (%f, %f) instead of (%f, %f).\n",
+				len, bin, double (fr [bin]), double (fi [bin]), ref_r [bin], ref_i [bin]
+			);
+			ret_val = -1;
+		}
+	}
+
+	fft.do_ifft (&fr [0], &fi [0], &fr [0], &fi [0]);
+	fft.rescale (&fr [0], &fi [0]);
+	for (long pos = 0; pos < len && ret_val == 0; ++pos)
+	{
+		if (   fabs (fr [pos] - xr [pos]) > tol
+		    || fabs (fi [pos] - xi [pos]) > tol)
+		{
+			printf ("\n*** Inverse, length %ld, position %ld.\n", len, pos);
+			ret_val = -1;
+		}
+	}
+
+	fft.do_fft (&fr [0], &fi [0], &fr [0], &fi [0]);
+	for (long bin = 0; bin < len && ret_val == 0; ++bin)
+	{
+		const double	err = std::max (
+			fabs (fr [bin] - ref_r [bin]),
+			fabs (fi [bin] - ref_i [bin])
+		);
+		if (err > tol * max_val)
+		{
+			printf ("\n*** In place, length %ld, bin %ld.\n", len, bin);
+			ret_val = -1;
+		}
+	}
+
+	FFTReal <DT>	fft_real (len);
+	std::vector <DT>	f1 (len);
+	std::vector <DT>	f2 (len);
+	fft_real.do_fft (&f1 [0], &xr [0]);
+	fft_real.do_fft (&f2 [0], &xi [0]);
+	fft.do_fft_pair (&fr [0], &fi [0], &xr [0], &xi [0]);
+	for (long pos = 0; pos < len && ret_val == 0; ++pos)
+	{
+		const double	err = std::max (
+			fabs (fr [pos] - f1 [pos]),
+			fabs (fi [pos] - f2 [pos])
+		);
+		if (err > tol * max_val)
+		{
+			printf (
+				"\n*** Pair, length %ld, position %ld: (%f, %f) instead of (%f, %f).\n",
+				len, pos, double (fr [pos]), double (fi [pos]), double (f1 [pos]), double (f2 [pos])
+			);
+			ret_val = -1;
+		}
+	}
+
+	return (ret_val);
+}
+
+
+
+// Complex and real transforms against a direct DFT in double precision. tol
+// is relative to the largest bin for the spectrum, and absolute for the
+// signal after the round trip.
+template <class DT>
+int	TestFeatures::check_any_len (long len, double tol)
+{
+	FFTAnyLen <DT>	fft (len);
+	FFTRealAnyLen <DT>	fft_real (len);
+
+	std::vector <DT>	xr (len);
+	std::vector <DT>	xi (len);
+	std::vector <DT>	fr (len);
+	std::vector <DT>	fi (len);
+	std::vector <DT>	yr (len);
+	std::vector <DT>	yi (len);
+	for (long pos = 0; pos < len; ++pos)
+	{
+		xr [pos] = DT ((pos * 7919) % 61) * DT (1.0 / 61) - DT (0.5);
+		xi [pos] = DT ((pos * 104729) % 53) * DT (1.0 / 53) - DT (0.5);
+	}
+
+	int				ret_val = 0;
+
+	// Reference spectra of the complex signal and of its real part
+	std::vector <double>	ref_r (len);
+	std::vector <double>	ref_i (len);
+	std::vector <double>	real_r (len);
+	std::vector <double>	real_i (len);
+	double			max_val = 0;
+	double			max_real = 0;
+	for (long bin = 0; bin < len; ++bin)
+	{
+		double			sum_r = 0;
+		double			sum_i = 0;
+		double			rsum_r = 0;
+		double			rsum_i = 0;
+		for (long pos = 0; pos < len; ++pos)
+		{
+			// Exact phase, reduced before the multiplication
+			const double	a = -2 * PI * ((bin * pos) % len) / len;
+			sum_r += xr [pos] * cos (a) - xi [pos] * sin (a);
+			sum_i += xr [pos] * sin (a) + xi [pos] * cos (a);
+			rsum_r += xr [pos] * cos (a);
+			rsum_i += xr [pos] * sin (a);
+		}
+		ref_r [bin] = sum_r;
+		ref_i [bin] = sum_i;
+		real_r [bin] = rsum_r;
+		real_i [bin] = rsum_i;
+		max_val = std::max (max_val, std::max (fabs (sum_r), fabs (sum_i)));
+		max_real = std::max (max_real, std::max (fabs (rsum_r), fabs (rsum_i)));
+	}
+
+	fft.do_fft (&fr [0], &fi [0], &xr [0], &xi [0]);
+	for (long bin = 0; bin < len && ret_val == 0; ++bin)
+	{
+		const double	err = std::max (
+			fabs (fr [bin] - ref_r [bin]),
+			fabs (fi [bin] - ref_i [bin])
+		);
+		if (err > tol * max_val)
+		{
+			printf (
+				"\n*** Complex, length %ld, bin %ld: (%f, %f) instead of (%f, %f).\n",
+				len, bin, double (fr [bin]), double (fi [bin]), ref_r [bin], ref_i [bin]
+			);
+			ret_val = -1;
+		}
+	}
+
+	if (ret_val == 0)
+	{
+		fft.do_ifft (&fr [0], &fi [0], &yr [0], &yi [0]);
+		fft.rescale (&yr [0], &yi [0]);
+		for (long pos = 0; pos < len && ret_val == 0; ++pos)
+		{
+			if (   fabs (yr [pos] - xr [pos]) > tol
+			    || fabs (yi [pos] - xi [pos]) > tol)
+			{
+				printf ("\n*** Complex inverse, length %ld, position %ld.\n", len, pos);
+				ret_val = -1;
+			}
+		}
+	}
+
+	// Real transform, FFTReal format
+	if (ret_val == 0)
+	{
+		fft_real.do_fft (&fr [0], &xr [0]);
+		const long		half = len >> 1;
+		for (long bin = 0; bin <= half && ret_val == 0; ++bin)
+		{
+			double			err = fabs (fr [bin] - real_r [bin]);
+			if (bin > 0 && half + bin < len)
+			{
+				err = std::max (err, fabs (fr [half + bin] + real_i [bin]));
+			}
+			if (err > tol * max_real)
+			{
+				printf ("\n*** Real, length %ld, bin %ld.\n", len, bin);
+				ret_val = -1;
+			}
+		}
+	}
+
+	if (ret_val == 0)
+	{
+		fft_real.do_ifft (&fr [0], &yr [0]);
+		fft_real.rescale (&yr [0]);
+		for (long pos = 0; pos < len && ret_val == 0; ++pos)
+		{
+			if (fabs (yr [pos] - xr [pos]) > tol)
+			{
+				printf ("\n*** Real inverse, length %ld, position %ld.\n", len, pos);
+				ret_val = -1;
+			}
+		}
+	}
+
+	return (ret_val);
+}
+
+
+
+// The four transforms against direct sums in double precision, then the
+// type II / type III round trips, in place. tol is relative to the largest
+// coefficient for the transforms, and absolute for the round trips.
+template <class FO>
+int	TestFeatures::check_dct (const FO &fft, double tol)
+{
+	typedef	typename FO::DataType	DT;
+
+	const FFTRealDct <FO>	dct (fft);
+	const long		len = dct.get_length ();
+
+	std::vector <DT>	x (len);
+	std::vector <DT>	fc (len);
+	std::vector <DT>	fs (len);
+	for (long pos = 0; pos < len; ++pos)
+	{
+		x [pos] = DT ((pos * 7919) % 61) * DT (1.0 / 61) - DT (0.5);
+	}
+
+	int				ret_val = 0;
+
+	dct.do_dct2 (&fc [0], &x [0]);
+	dct.do_dst2 (&fs [0], &x [0]);
+
+	std::vector <double>	ref_c (len);
+	std::vector <double>	ref_s (len);
+	double			max_val = 0;
+	for (long k = 0; k < len; ++k)
+	{
+		double			sum_c = 0;
+		double			sum_s = 0;
+		for (long pos = 0; pos < len; ++pos)
+		{
+			const double	a = PI * (2 * pos + 1) / (2 * len);
+			sum_c += x [pos] * cos (a * k);
+			sum_s += x [pos] * sin (a * (k + 1));
+		}
+		ref_c [k] = sum_c;
+		ref_s [k] = sum_s;
+		max_val = std::max (max_val, std::max (fabs (sum_c), fabs (sum_s)));
+	}
+	for (long k = 0; k < len && ret_val == 0; ++k)
+	{
+		if (   fabs (fc [k] - ref_c [k]) > tol * max_val
+		    || fabs (fs [k] - ref_s [k]) > tol * max_val)
+		{
+			printf (
+				"\n*** Length %ld, coefficient %ld: DCT %f instead of %f, DST %f instead of %f.\n",
+				len, k, double (fc [k]), ref_c [k], double (fs [k]), ref_s [k]
+			);
+			ret_val = -1;
+		}
+	}
+
+	// Type III against the direct sums, on the type II output
+	std::vector <DT>	yc (len);
+	std::vector <DT>	ys (len);
+	dct.do_dct3 (&fc [0], &yc [0]);
+	dct.do_dst3 (&fs [0], &ys [0]);
+	for (long pos = 0; pos < len && ret_val == 0; ++pos)
+	{
+		const double	a = PI * (2 * pos + 1) / (2 * len);
+		const double	sign = ((pos & 1) != 0) ? -1 : 1;
+		double			sum_c = fc [0] * 0.5;
+		double			sum_s = fs [len - 1] * 0.5 * sign;
+		for (long k = 1; k < len; ++k)
+		{
+			sum_c += fc [k] * cos (a * k);
+			sum_s += fs [k - 1] * sin (a * k);
+		}
+		if (   fabs (yc [pos] - sum_c) > tol * max_val
+		    || fabs (ys [pos] - sum_s) > tol * max_val)
+		{
+			printf (
+				"\n*** Length %ld, position %ld: DCT-III %f instead of %f, DST-III %f instead of %f.\n",
+				len, pos, double (yc [pos]), sum_c, double (ys [pos]), sum_s
+			);
+			ret_val = -1;
+		}
+	}
+
+	dct.do_dct3 (&fc [0], &fc [0]);
+	dct.do_dst3 (&fs [0], &fs [0]);
+	dct.rescale (&fc [0]);
+	dct.rescale (&fs [0]);
+	for (long pos = 0; pos < len && ret_val == 0; ++pos)
+	{
+		if (   fabs (fc [pos] - x [pos]) > tol
+		    || fabs (fs [pos] - x [pos]) > tol)
+		{
+			printf ("\n*** Inverse, length %ld, position %ld.\n", len, pos);
+			ret_val = -1;
+		}
+	}
+
+	return (ret_val);
+}
+
+
+
+// Against a direct convolution or correlation in double precision, with
+// the stream cut into chunks of irregular sizes and processed in place.
+// tol is relative to the sum of the absolute taps.
+template <class CO>
+int	TestFeatures::check_convolver (long ir_len, bool corr_flag, double tol)
+{
+	typedef	typename CO::DataType	DT;
+
+	CO					conv;
+	const long		latency = conv.get_latency ();
+
+	std::vector <DT>	ir (ir_len);
+	double			ir_sum = 0;
+	for (long pos = 0; pos < ir_len; ++pos)
+	{
+		ir [pos] = DT ((pos * 7919) % 61) * DT (1.0 / 61) - DT (0.5);
+		ir_sum += fabs (ir [pos]);
+	}
+	if (corr_flag)
+	{
+		conv.set_template (&ir [0], ir_len);
+	}
+	else
+	{
+		conv.set_impulse (&ir [0], ir_len);
+	}
+
+	const long		len = ir_len * 3 + latency * 5 + 17;
+	std::vector <DT>	x (len);
+	for (long pos = 0; pos < len; ++pos)
+	{
+		x [pos] = DT ((pos * 104729) % 53) * DT (1.0 / 53) - DT (0.5);
+	}
+
+	std::vector <DT>	y (x);
+	long				pos = 0;
+	long				chunk = 1;
+	while (pos < len)
+	{
+		const long		work_len = std::min (chunk, len - pos);
+		conv.process (&y [pos], &y [pos], work_len);
+		pos += work_len;
+		chunk = (chunk * 7 + 3) % (latency * 2 + 5);
+	}
+
+	int				ret_val = 0;
+
+	for (long n = 0; n < len && ret_val == 0; ++n)
+	{
+		double			sum = 0;
+		for (long k = 0; k < ir_len; ++k)
+		{
+			const long		src = (corr_flag)
+				? n - latency - (ir_len - 1) + k
+				: n - latency - k;
+			if (src >= 0)
+			{
+				sum += ir [k] * x [src];
+			}
+		}
+		if (fabs (y [n] - sum) > tol * ir_sum)
+		{
+			printf (
+				"\n*** %s of %ld taps, sample %ld: %f instead of %f.\n",
+				corr_flag ? "Correlation" : "Convolution",
+				ir_len, n, double (y [n]), sum
+			);
+			ret_val = -1;
+		}
+	}
+
+	return (ret_val);
+}
+
+
+
+// Harmonic amplitudes of a sum of sinusoids, then the powers at arbitrary
+// frequencies against a direct DFT of one block. The stream is fed in
+// chunks of irregular sizes across several blocks.
+// tol is relative to the amplitudes.
+template <class DT>
+int	TestFeatures::check_goertzel (double fundamental, double tol)
+{
+	const int		nbr_harmo = 5;
+	static const double	amp_arr [nbr_harmo] = { 1, 0.5, 0.25, 0.1, 0.05 };
+
+	GoertzelBank <DT>	bank;
+	const long		block_len = bank.set_harmonics (fundamental, nbr_harmo, 1000);
+
+	int				ret_val = 0;
+
+	const long		len = block_len * 3 + 17;
+	std::vector <DT>	x (len);
+	for (long pos = 0; pos < len; ++pos)
+	{
+		double			sum = 0;
+		for (int k = 0; k < nbr_harmo; ++k)
+		{
+			const double	freq = fundamental * (k + 1);
+			if (freq < 0.5)
+			{
+				sum += amp_arr [k] * cos (2 * PI * freq * pos + k);
+			}
+		}
+		x [pos] = DT (sum);
+	}
+
+	long				pos = 0;
+	long				chunk = 1;
+	int				nbr_blocks = 0;
+	while (pos < len)
+	{
+		const long		work_len = std::min (chunk, len - pos);
+		if (bank.process (&x [pos], work_len))
+		{
+			++ nbr_blocks;
+		}
+		pos += work_len;
+		chunk = (chunk * 7 + 3) % 601;
+	}
+	if (nbr_blocks < 3)
+	{
+		printf ("\n*** %d blocks instead of 3 or more.\n", nbr_blocks);
+		ret_val = -1;
+	}
+
+	for (int k = 0; k < nbr_harmo && ret_val == 0; ++k)
+	{
+		const double	amp = sqrt (bank.get_power (k));
+		if (bank.get_frequency (k) < 0.5 && fabs (amp - amp_arr [k]) > tol)
+		{
+			printf (
+				"\n*** Fundamental %f, harmonic %d: %f instead of %f.\n",
+				fundamental, k + 1, amp, amp_arr [k]
+			);
+			ret_val = -1;
+		}
+	}
+
+	static const double	freq_arr [] = { 0.0123, fundamental * 1.5, 0.3, 0.5 };
+	const int		nbr_freq = int (sizeof (freq_arr) / sizeof (freq_arr [0]));
+	const long		dft_len = 777;
+	bank.set_frequencies (freq_arr, nbr_freq, dft_len);
+	bank.process (&x [0], dft_len);
+	for (int f = 0; f < nbr_freq && ret_val == 0; ++f)
+	{
+		double			sum_r = 0;
+		double			sum_i = 0;
+		for (long pos = 0; pos < dft_len; ++pos)
+		{
+			const double	a = 2 * PI * freq_arr [f] * pos;
+			sum_r += x [pos] * cos (a);
+			sum_i -= x [pos] * sin (a);
+		}
+		const double	ref = sqrt (sum_r * sum_r + sum_i * sum_i) * 2 / dft_len;
+		const double	amp = sqrt (bank.get_power (f));
+		if (fabs (amp - ref) > tol)
+		{
+			printf (
+				"\n*** Frequency %f: %f instead of %f.\n",
+				freq_arr [f], amp, ref
+			);
+			ret_val = -1;
+		}
+	}
+
+	return (ret_val);
+}
+
+
+
+}	// namespace test
+}	// namespace ffft
+
+
+
+#endif	// ffft_test_TestFeatures_CODEHEADER_INCLUDED
+
+#undef ffft_test_TestFeatures_CURRENT_CODEHEADER
+
+
+
+/*\\\ EOF \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
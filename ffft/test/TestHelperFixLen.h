@@ -38,7 +38,7 @@ namespace test
 
 
 
-template <int L>
+template <int L, class DT>
 class TestHelperFixLen
 {
 
@@ -46,7 +46,7 @@ class TestHelperFixLen
 
 public:
 
-	typedef  FFTRealFixLen <L> FftType;
+	typedef  FFTRealFixLen <L, DT> FftType;
 
    static void    perform_test_accuracy (int &ret_val);
    static void    perform_test_speed (int &ret_val);
@@ -47,8 +47,8 @@ namespace test
 
 
 
-template <int L>
-void	TestHelperFixLen <L>::perform_test_accuracy (int &ret_val)
+template <int L, class DT>
+void	TestHelperFixLen <L, DT>::perform_test_accuracy (int &ret_val)
 {
    if (ret_val == 0)
    {
@@ -59,8 +59,8 @@ void	TestHelperFixLen <L>::perform_test_accuracy (int &ret_val)
 
 
 
-template <int L>
-void	TestHelperFixLen <L>::perform_test_speed (int &ret_val)
+template <int L, class DT>
+void	TestHelperFixLen <L, DT>::perform_test_speed (int &ret_val)
 {
 #if defined (ffft_test_SPEED_TEST_ENABLED)
 
@@ -34,6 +34,10 @@ http://sam.zoy.org/wtfpl/COPYING for more details.
 	#include	"ffft/test/TestSpeed.h"
 #endif
 
+#include	<typeinfo>
+
+#include	<cstdio>
+
 
 
 namespace ffft
@@ -57,6 +61,14 @@ void	TestHelperNormal <DT>::perform_test_accuracy (int &ret_val)
 		const long		len = 1L << (len_arr [k]);
 		FftType			fft (len);
 		ret_val = TestAccuracy <FftType>::perform_test_single_object (fft);
+		if (ret_val == 0)
+		{
+			ret_val = TestAccuracy <FftType>::perform_test_batch (
+				fft,
+				typeid (fft).name ()
+			);
+			printf ("\n");
+		}
 	}
 }
 
@@ -74,6 +86,53 @@ void	TestHelperNormal <DT>::perform_test_speed (int &ret_val)
 		const long		len = 1L << (len_arr [k]);
 		FftType			fft (len);
 		ret_val = TestSpeed <FftType>::perform_test_single_object (fft);
+		if (ret_val == 0 && len >= 4)
+		{
+			ret_val = TestSpeed <FftType>::perform_test_even (
+				fft,
+				typeid (fft).name ()
+			);
+			printf ("\n");
+		}
+		if (ret_val == 0 && len >= 4)
+		{
+			ret_val = TestSpeed <FftType>::perform_test_pruned (
+				fft,
+				typeid (fft).name ()
+			);
+			printf ("\n");
+		}
+		if (ret_val == 0 && len >= (1L << 16))
+		{
+			ret_val = TestSpeed <FftType>::perform_test_large (
+				fft,
+				typeid (fft).name ()
+			);
+			printf ("\n");
+		}
+		if (ret_val == 0 && len >= (1L << 16))
+		{
+			ret_val = TestSpeed <FftType>::perform_test_threads (fft);
+			printf ("\n");
+		}
+		if (ret_val == 0 && len >= 4 && len <= (1L << 16))
+		{
+			ret_val = TestSpeed <FftType>::perform_test_complex (
+				fft,
+				typeid (fft).name ()
+			);
+			printf ("\n");
+		}
+		if (ret_val == 0 && len >= 16 && len <= (1L << 16))
+		{
+			ret_val = TestSpeed <FftType>::perform_test_any_len (fft);
+			printf ("\n");
+		}
+		if (ret_val == 0 && len >= 2)
+		{
+			ret_val = TestSpeed <FftType>::perform_test_dct (fft);
+			printf ("\n");
+		}
 	}
 
 #endif
@@ -50,6 +50,13 @@ public:
    static int		perform_test_d (FO &fft, const char *class_name_0);
    static int		perform_test_i (FO &fft, const char *class_name_0);
    static int		perform_test_di (FO &fft, const char *class_name_0);
+	static int		perform_test_even (FO &fft, const char *class_name_0);
+	static int		perform_test_pruned (FO &fft, const char *class_name_0);
+	static int		perform_test_large (FO &fft, const char *class_name_0);
+	static int		perform_test_threads (FO &fft);
+	static int		perform_test_complex (FO &fft, const char *class_name_0);
+	static int		perform_test_any_len (FO &fft);
+	static int		perform_test_dct (FO &fft);
 
 
 
@@ -29,9 +29,17 @@ http://sam.zoy.org/wtfpl/COPYING for more details.
 
 #include	"ffft/test/fnc.h"
 #include	"ffft/test/TestWhiteNoiseGen.h"
+#include	"ffft/FFTComplex.h"
+#include	"ffft/FFTRealAnyLen.h"
+#include	"ffft/FFTRealDct.h"
+#include	"ffft/FFTRealEven.h"
+#include	"ffft/FFTRealLarge.h"
+#include	"ffft/ThreadPool.h"
 #include	"stopwatch/StopWatch.h"
 
+#include	<algorithm>
 #include	<typeinfo>
+#include	<vector>
 
 #include	<cstdio>
 
@@ -205,6 +213,416 @@ int	TestSpeed <FO>::perform_test_di (FO &fft, const char *class_name_0)
 
 
 
+// Second transform of a correlation: full FFT of an even sequence, then
+// FFTRealEven computing only the real parts of the first half of the bins.
+template <class FO>
+int	TestSpeed <FO>::perform_test_even (FO &fft, const char *class_name_0)
+{
+	assert (&fft != 0);
+	assert (class_name_0 != 0);
+
+	const long		len = fft.get_length ();
+	const long		half = len >> 1;
+	const long		nbr_tests = limit (
+		static_cast <long> (NBR_SPD_TESTS / len / len),
+		1L,
+		static_cast <long> (MAX_NBR_TESTS)
+	);
+
+	TestWhiteNoiseGen <DataType>	noise;
+	std::vector <DataType>	x (len);
+	std::vector <DataType>	s (len);
+	noise.generate (&x [0], half + 1);
+	for (long pos = 1; pos < half; ++pos)
+	{
+		x [len - pos] = x [pos];
+	}
+
+	FFTRealEven <DataType>	even (len);
+	std::vector <DataType>	ws (even.get_workspace_len ());
+
+	printf (
+		"%s::do_fft () speed test, even sequence [%ld samples]... ",
+		class_name_0,
+		len
+	);
+	fflush (stdout);
+
+	stopwatch::StopWatch	chrono;
+	chrono.start ();
+	for (long test = 0; test < nbr_tests; ++ test)
+	{
+		fft.do_fft (&s [0], &x [0]);
+		chrono.stop_lap ();
+	}
+
+	printf ("%.1f clocks/sample\n", chrono.get_time_best_lap (len));
+
+	printf (
+		"FFTRealEven::do_fft () speed test [%ld samples, %ld bins]... ",
+		len,
+		half
+	);
+	fflush (stdout);
+
+	chrono.start ();
+	for (long test = 0; test < nbr_tests; ++ test)
+	{
+		even.do_fft (&s [0], &x [0], half, &ws [0]);
+		chrono.stop_lap ();
+	}
+
+	printf ("%.1f clocks/sample\n", chrono.get_time_best_lap (len));
+
+	return (0);
+}
+
+
+
+// Zero-padded frames, 2x and 4x. The full transform of the same data is
+// the reference.
+template <class FO>
+int	TestSpeed <FO>::perform_test_pruned (FO &fft, const char *class_name_0)
+{
+	assert (&fft != 0);
+	assert (class_name_0 != 0);
+
+	const long		len = fft.get_length ();
+	const long		nbr_tests = limit (
+		static_cast <long> (NBR_SPD_TESTS / len / len),
+		1L,
+		static_cast <long> (MAX_NBR_TESTS)
+	);
+
+	TestWhiteNoiseGen <DataType>	noise;
+	std::vector <DataType>	x (len, 0);
+	std::vector <DataType>	s (len);
+
+	for (int padding = 2; padding <= 4; padding *= 2)
+	{
+		const long		nbr_samples = len / padding;
+		noise.generate (&x [0], nbr_samples);
+
+		printf (
+			"%s::do_fft () speed test, %dx zero-padding [%ld samples]... ",
+			class_name_0,
+			padding,
+			len
+		);
+		fflush (stdout);
+
+		stopwatch::StopWatch	chrono;
+		chrono.start ();
+		for (long test = 0; test < nbr_tests; ++ test)
+		{
+			fft.do_fft (&s [0], &x [0]);
+			chrono.stop_lap ();
+		}
+
+		printf ("%.1f clocks/sample\n", chrono.get_time_best_lap (len));
+
+		printf (
+			"%s::do_fft_pruned () speed test, %dx zero-padding [%ld samples]... ",
+			class_name_0,
+			padding,
+			len
+		);
+		fflush (stdout);
+
+		chrono.start ();
+		for (long test = 0; test < nbr_tests; ++ test)
+		{
+			fft.do_fft_pruned (&s [0], &x [0], nbr_samples);
+			chrono.stop_lap ();
+		}
+
+		printf ("%.1f clocks/sample\n", chrono.get_time_best_lap (len));
+	}
+
+	return (0);
+}
+
+
+
+// Four-step transform of the same length. At least a few laps, a single
+// one would be mostly cache misses.
+template <class FO>
+int	TestSpeed <FO>::perform_test_large (FO &fft, const char *class_name_0)
+{
+	assert (&fft != 0);
+	assert (class_name_0 != 0);
+
+	const long		len = fft.get_length ();
+	const long		nbr_tests = limit (
+		static_cast <long> (NBR_SPD_TESTS / len / len),
+		4L,
+		static_cast <long> (MAX_NBR_TESTS)
+	);
+
+	TestWhiteNoiseGen <DataType>	noise;
+	std::vector <DataType>	x (len);
+	std::vector <DataType>	s (len);
+	noise.generate (&x [0], len);
+
+	FFTRealLarge <DataType>	large (len);
+	std::vector <DataType>	ws (large.get_workspace_len ());
+
+	printf ("%s::do_fft () speed test [%ld samples]... ", class_name_0, len);
+	fflush (stdout);
+
+	stopwatch::StopWatch	chrono;
+	chrono.start ();
+	for (long test = 0; test < nbr_tests; ++ test)
+	{
+		fft.do_fft (&s [0], &x [0]);
+		chrono.stop_lap ();
+	}
+
+	printf ("%.1f clocks/sample\n", chrono.get_time_best_lap (len));
+
+	printf ("FFTRealLarge::do_fft () speed test [%ld samples]... ", len);
+	fflush (stdout);
+
+	chrono.start ();
+	for (long test = 0; test < nbr_tests; ++ test)
+	{
+		large.do_fft (&s [0], &x [0], &ws [0]);
+		chrono.stop_lap ();
+	}
+
+	printf ("%.1f clocks/sample\n", chrono.get_time_best_lap (len));
+
+	printf ("FFTRealLarge::do_ifft () speed test [%ld samples]... ", len);
+	fflush (stdout);
+
+	chrono.start ();
+	for (long test = 0; test < nbr_tests; ++ test)
+	{
+		large.do_ifft (&s [0], &x [0], &ws [0]);
+		chrono.stop_lap ();
+	}
+
+	printf ("%.1f clocks/sample\n", chrono.get_time_best_lap (len));
+
+	return (0);
+}
+
+
+
+// FFTRealLarge::do_fft() from 1 thread to the number of cores, at least 2
+template <class FO>
+int	TestSpeed <FO>::perform_test_threads (FO &fft)
+{
+	assert (&fft != 0);
+
+	const long		len = fft.get_length ();
+	const long		nbr_tests = limit (
+		static_cast <long> (NBR_SPD_TESTS / len / len),
+		4L,
+		static_cast <long> (MAX_NBR_TESTS)
+	);
+	const int		max_nbr_threads = std::max (ThreadPool::count_cores (), 2);
+
+	TestWhiteNoiseGen <DataType>	noise;
+	std::vector <DataType>	x (len);
+	std::vector <DataType>	s (len);
+	noise.generate (&x [0], len);
+
+	FFTRealLarge <DataType>	large (len);
+
+	double			time_1 = 0;
+	for (int nbr_threads = 1; nbr_threads <= max_nbr_threads; ++nbr_threads)
+	{
+		ThreadPool		pool (nbr_threads);
+		large.set_thread_pool (&pool);
+		std::vector <DataType>	ws (large.get_workspace_len ());
+
+		printf (
+			"FFTRealLarge::do_fft () speed test [%ld samples, %d threads]... ",
+			len,
+			pool.get_nbr_threads ()
+		);
+		fflush (stdout);
+
+		stopwatch::StopWatch	chrono;
+		chrono.start ();
+		for (long test = 0; test < nbr_tests; ++ test)
+		{
+			large.do_fft (&s [0], &x [0], &ws [0]);
+			chrono.stop_lap ();
+		}
+
+		const double	time = chrono.get_time_best_lap (len);
+		if (nbr_threads == 1)
+		{
+			time_1 = time;
+		}
+		printf ("%.1f clocks/sample, x%.2f\n", time, time_1 / time);
+	}
+
+	large.set_thread_pool (0);
+
+	return (0);
+}
+
+
+
+// Complex FFT of the same length, against the real one
+template <class FO>
+int	TestSpeed <FO>::perform_test_complex (FO &fft, const char *class_name_0)
+{
+	assert (&fft != 0);
+	assert (class_name_0 != 0);
+
+	const long		len = fft.get_length ();
+	const long		nbr_tests = limit (
+		static_cast <long> (NBR_SPD_TESTS / len / len),
+		1L,
+		static_cast <long> (MAX_NBR_TESTS)
+	);
+
+	TestWhiteNoiseGen <DataType>	noise;
+	std::vector <DataType>	xr (len);
+	std::vector <DataType>	xi (len);
+	std::vector <DataType>	fr (len);
+	std::vector <DataType>	fi (len);
+	noise.generate (&xr [0], len);
+	noise.generate (&xi [0], len);
+
+	FFTComplex <DataType>	cplx (len);
+	std::vector <DataType>	ws (cplx.get_workspace_len ());
+
+	printf ("%s::do_fft () speed test [%ld samples]... ", class_name_0, len);
+	fflush (stdout);
+
+	stopwatch::StopWatch	chrono;
+	chrono.start ();
+	for (long test = 0; test < nbr_tests; ++ test)
+	{
+		fft.do_fft (&fr [0], &xr [0]);
+		chrono.stop_lap ();
+	}
+
+	printf ("%.1f clocks/sample\n", chrono.get_time_best_lap (len));
+
+	printf ("FFTComplex::do_fft () speed test [%ld samples]... ", len);
+	fflush (stdout);
+
+	chrono.start ();
+	for (long test = 0; test < nbr_tests; ++ test)
+	{
+		cplx.do_fft (&fr [0], &fi [0], &xr [0], &xi [0], &ws [0]);
+		chrono.stop_lap ();
+	}
+
+	printf ("%.1f clocks/sample\n", chrono.get_time_best_lap (len));
+
+	return (0);
+}
+
+
+
+// FFTRealAnyLen on a mixed-radix length slightly shorter (15/16) and on the
+// next length, which usually needs the Bluestein algorithm
+template <class FO>
+int	TestSpeed <FO>::perform_test_any_len (FO &fft)
+{
+	assert (&fft != 0);
+
+	const long		len = fft.get_length ();
+	const long		nbr_tests = limit (
+		static_cast <long> (NBR_SPD_TESTS / len / len),
+		1L,
+		static_cast <long> (MAX_NBR_TESTS)
+	);
+
+	const long		len_arr [2] = { len / 16 * 15, len + 1 };
+	for (int index = 0; index < 2; ++index)
+	{
+		const long		any_len = len_arr [index];
+		FFTRealAnyLen <DataType>	any (any_len);
+
+		TestWhiteNoiseGen <DataType>	noise;
+		std::vector <DataType>	x (any_len);
+		std::vector <DataType>	f (any_len);
+		std::vector <DataType>	ws (any.get_workspace_len ());
+		noise.generate (&x [0], any_len);
+
+		printf (
+			"FFTRealAnyLen::do_fft () speed test [%ld samples, %s]... ",
+			any_len,
+			any.is_mixed_radix () ? "mixed radix" : "Bluestein"
+		);
+		fflush (stdout);
+
+		stopwatch::StopWatch	chrono;
+		chrono.start ();
+		for (long test = 0; test < nbr_tests; ++ test)
+		{
+			any.do_fft (&f [0], &x [0], &ws [0]);
+			chrono.stop_lap ();
+		}
+
+		printf ("%.1f clocks/sample\n", chrono.get_time_best_lap (any_len));
+	}
+
+	return (0);
+}
+
+
+
+// DCT-II and DCT-III on the FFT under test. They are compared with the
+// regular speed test of the FFT itself.
+template <class FO>
+int	TestSpeed <FO>::perform_test_dct (FO &fft)
+{
+	assert (&fft != 0);
+
+	const long		len = fft.get_length ();
+	const long		nbr_tests = limit (
+		static_cast <long> (NBR_SPD_TESTS / len / len),
+		1L,
+		static_cast <long> (MAX_NBR_TESTS)
+	);
+
+	TestWhiteNoiseGen <DataType>	noise;
+	std::vector <DataType>	x (len);
+	std::vector <DataType>	f (len);
+	noise.generate (&x [0], len);
+
+	const FFTRealDct <FO>	dct (fft);
+	std::vector <DataType>	ws (dct.get_workspace_len ());
+
+	printf ("FFTRealDct::do_dct2 () speed test [%ld samples]... ", len);
+	fflush (stdout);
+
+	stopwatch::StopWatch	chrono;
+	chrono.start ();
+	for (long test = 0; test < nbr_tests; ++ test)
+	{
+		dct.do_dct2 (&f [0], &x [0], &ws [0]);
+		chrono.stop_lap ();
+	}
+
+	printf ("%.1f clocks/sample\n", chrono.get_time_best_lap (len));
+
+	printf ("FFTRealDct::do_dct3 () speed test [%ld samples]... ", len);
+	fflush (stdout);
+
+	chrono.start ();
+	for (long test = 0; test < nbr_tests; ++ test)
+	{
+		dct.do_dct3 (&f [0], &x [0], &ws [0]);
+		chrono.stop_lap ();
+	}
+
+	printf ("%.1f clocks/sample\n", chrono.get_time_best_lap (len));
+
+	return (0);
+}
+
+
+
 /*\\\ PROTECTED \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
 
@@ -25,8 +25,10 @@ http://sam.zoy.org/wtfpl/COPYING for more details.
 /*\\\ INCLUDE FILES \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*/
 
 #include	"ffft/test/conf.h"
+#include	"ffft/test/TestFeatures.h"
 #include	"ffft/test/TestHelperFixLen.h"
 #include	"ffft/test/TestHelperNormal.h"
+#include	"ffft/FFTRealSimd.h"
 
 #if defined (_MSC_VER)
 #include	<crtdbg.h>
@@ -37,6 +39,7 @@ http://sam.zoy.org/wtfpl/COPYING for more details.
 
 #include	<cassert>
 #include	<cstdio>
+#include	<cstdlib>
 
 
 
@@ -67,6 +70,12 @@ int main (int argc, char *argv [])
 			ret_val = TEST_perform_test_accuracy_all ();
 		}
 
+		// Optional argument: SIMD level for the speed tests
+		if (ret_val == 0 && argc > 1)
+		{
+			ffft::FFTRealSimd <float>::force_level (atoi (argv [1]));
+		}
+
 		if (ret_val == 0)
 		{
 			ret_val = TEST_perform_test_speed_all ();
@@ -99,15 +108,102 @@ int	TEST_perform_test_accuracy_all ()
 	ffft::test::TestHelperNormal <float >::perform_test_accuracy (ret_val);
 	ffft::test::TestHelperNormal <double>::perform_test_accuracy (ret_val);
 
-   ffft::test::TestHelperFixLen < 1>::perform_test_accuracy (ret_val);
-   ffft::test::TestHelperFixLen < 2>::perform_test_accuracy (ret_val);
-   ffft::test::TestHelperFixLen < 3>::perform_test_accuracy (ret_val);
-   ffft::test::TestHelperFixLen < 4>::perform_test_accuracy (ret_val);
-   ffft::test::TestHelperFixLen < 7>::perform_test_accuracy (ret_val);
-   ffft::test::TestHelperFixLen < 8>::perform_test_accuracy (ret_val);
-   ffft::test::TestHelperFixLen <10>::perform_test_accuracy (ret_val);
-   ffft::test::TestHelperFixLen <12>::perform_test_accuracy (ret_val);
-   ffft::test::TestHelperFixLen <13>::perform_test_accuracy (ret_val);
+   ffft::test::TestHelperFixLen < 1, float >::perform_test_accuracy (ret_val);
+   ffft::test::TestHelperFixLen < 2, float >::perform_test_accuracy (ret_val);
+   ffft::test::TestHelperFixLen < 3, float >::perform_test_accuracy (ret_val);
+   ffft::test::TestHelperFixLen < 4, float >::perform_test_accuracy (ret_val);
+   ffft::test::TestHelperFixLen < 7, float >::perform_test_accuracy (ret_val);
+   ffft::test::TestHelperFixLen < 8, float >::perform_test_accuracy (ret_val);
+   ffft::test::TestHelperFixLen <10, float >::perform_test_accuracy (ret_val);
+   ffft::test::TestHelperFixLen <12, float >::perform_test_accuracy (ret_val);
+   ffft::test::TestHelperFixLen <13, float >::perform_test_accuracy (ret_val);
+
+   ffft::test::TestHelperFixLen < 1, double>::perform_test_accuracy (ret_val);
+   ffft::test::TestHelperFixLen < 2, double>::perform_test_accuracy (ret_val);
+   ffft::test::TestHelperFixLen < 3, double>::perform_test_accuracy (ret_val);
+   ffft::test::TestHelperFixLen < 4, double>::perform_test_accuracy (ret_val);
+   ffft::test::TestHelperFixLen < 7, double>::perform_test_accuracy (ret_val);
+   ffft::test::TestHelperFixLen < 8, double>::perform_test_accuracy (ret_val);
+   ffft::test::TestHelperFixLen <10, double>::perform_test_accuracy (ret_val);
+   ffft::test::TestHelperFixLen <12, double>::perform_test_accuracy (ret_val);
+   ffft::test::TestHelperFixLen <13, double>::perform_test_accuracy (ret_val);
+
+	// Vectorized code: check the lower levels too
+	const int		max_level = ffft::FFTRealSimd <float>::detect_level ();
+	for (int level = ffft::SimdLevel_NONE; level < max_level && ret_val == 0; ++level)
+	{
+		printf ("SIMD level %d:\n", level);
+		ffft::FFTRealSimd <float>::force_level (level);
+		ffft::test::TestHelperNormal <float >::perform_test_accuracy (ret_val);
+		ffft::test::TestHelperFixLen <10, float >::perform_test_accuracy (ret_val);
+		ffft::test::TestHelperFixLen <13, float >::perform_test_accuracy (ret_val);
+	}
+	ffft::FFTRealSimd <float>::force_level (ffft::SimdLevel_AUTO);
+
+	if (ret_val == 0)
+	{
+		ret_val = ffft::test::TestFeatures::perform_test_allocator_arena ();
+	}
+
+	if (ret_val == 0)
+	{
+		ret_val = ffft::test::TestFeatures::perform_test_plan_cache ();
+	}
+
+	if (ret_val == 0)
+	{
+		ret_val = ffft::test::TestFeatures::perform_test_split ();
+	}
+
+	if (ret_val == 0)
+	{
+		ret_val = ffft::test::TestFeatures::perform_test_power ();
+	}
+
+	if (ret_val == 0)
+	{
+		ret_val = ffft::test::TestFeatures::perform_test_even ();
+	}
+
+	if (ret_val == 0)
+	{
+		ret_val = ffft::test::TestFeatures::perform_test_pruned ();
+	}
+
+	if (ret_val == 0)
+	{
+		ret_val = ffft::test::TestFeatures::perform_test_large ();
+	}
+
+	if (ret_val == 0)
+	{
+		ret_val = ffft::test::TestFeatures::perform_test_osc_lanes ();
+	}
+
+	if (ret_val == 0)
+	{
+		ret_val = ffft::test::TestFeatures::perform_test_complex ();
+	}
+
+	if (ret_val == 0)
+	{
+		ret_val = ffft::test::TestFeatures::perform_test_any_len ();
+	}
+
+	if (ret_val == 0)
+	{
+		ret_val = ffft::test::TestFeatures::perform_test_dct ();
+	}
+
+	if (ret_val == 0)
+	{
+		ret_val = ffft::test::TestFeatures::perform_test_convolver ();
+	}
+
+	if (ret_val == 0)
+	{
+		ret_val = ffft::test::TestFeatures::perform_test_goertzel ();
+	}
 
 	return (ret_val);
 }
@@ -123,17 +219,29 @@ int	TEST_perform_test_speed_all ()
 	ffft::test::TestHelperNormal <float >::perform_test_speed (ret_val);
 	ffft::test::TestHelperNormal <double>::perform_test_speed (ret_val);
 
-   ffft::test::TestHelperFixLen < 1>::perform_test_speed (ret_val);
-   ffft::test::TestHelperFixLen < 2>::perform_test_speed (ret_val);
-   ffft::test::TestHelperFixLen < 3>::perform_test_speed (ret_val);
-   ffft::test::TestHelperFixLen < 4>::perform_test_speed (ret_val);
-   ffft::test::TestHelperFixLen < 7>::perform_test_speed (ret_val);
-   ffft::test::TestHelperFixLen < 8>::perform_test_speed (ret_val);
-   ffft::test::TestHelperFixLen <10>::perform_test_speed (ret_val);
-   ffft::test::TestHelperFixLen <12>::perform_test_speed (ret_val);
-   ffft::test::TestHelperFixLen <14>::perform_test_speed (ret_val);
-   ffft::test::TestHelperFixLen <16>::perform_test_speed (ret_val);
-   ffft::test::TestHelperFixLen <20>::perform_test_speed (ret_val);
+   ffft::test::TestHelperFixLen < 1, float >::perform_test_speed (ret_val);
+   ffft::test::TestHelperFixLen < 2, float >::perform_test_speed (ret_val);
+   ffft::test::TestHelperFixLen < 3, float >::perform_test_speed (ret_val);
+   ffft::test::TestHelperFixLen < 4, float >::perform_test_speed (ret_val);
+   ffft::test::TestHelperFixLen < 7, float >::perform_test_speed (ret_val);
+   ffft::test::TestHelperFixLen < 8, float >::perform_test_speed (ret_val);
+   ffft::test::TestHelperFixLen <10, float >::perform_test_speed (ret_val);
+   ffft::test::TestHelperFixLen <12, float >::perform_test_speed (ret_val);
+   ffft::test::TestHelperFixLen <14, float >::perform_test_speed (ret_val);
+   ffft::test::TestHelperFixLen <16, float >::perform_test_speed (ret_val);
+   ffft::test::TestHelperFixLen <20, float >::perform_test_speed (ret_val);
+
+   ffft::test::TestHelperFixLen < 1, double>::perform_test_speed (ret_val);
+   ffft::test::TestHelperFixLen < 2, double>::perform_test_speed (ret_val);
+   ffft::test::TestHelperFixLen < 3, double>::perform_test_speed (ret_val);
+   ffft::test::TestHelperFixLen < 4, double>::perform_test_speed (ret_val);
+   ffft::test::TestHelperFixLen < 7, double>::perform_test_speed (ret_val);
+   ffft::test::TestHelperFixLen < 8, double>::perform_test_speed (ret_val);
+   ffft::test::TestHelperFixLen <10, double>::perform_test_speed (ret_val);
+   ffft::test::TestHelperFixLen <12, double>::perform_test_speed (ret_val);
+   ffft::test::TestHelperFixLen <14, double>::perform_test_speed (ret_val);
+   ffft::test::TestHelperFixLen <16, double>::perform_test_speed (ret_val);
+   ffft::test::TestHelperFixLen <20, double>::perform_test_speed (ret_val);
 
 #endif
 
@@ -110,6 +110,14 @@ Int64	ClockCycleCounter::read_clock_counter ()
 
 	__asm__ __volatile__ ("rdtsc" : "=A" (clock_cnt));
 
+#elif defined (__GNUC__) && defined (__x86_64__)
+
+	// "=A" means rax only on x86-64, the counter is split in eax and edx
+	unsigned int		lo;
+	unsigned int		hi;
+	__asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+	clock_cnt = (static_cast <Int64> (hi) << 32) | lo;
+
 #elif (__MWERKS__) && defined (__POWERPC__) 
 	
 	asm
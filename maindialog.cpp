@@ -11,6 +11,7 @@ Q_DECLARE_METATYPE(QVector<double>)
 MainDialog::MainDialog(QWidget *parent) : QDialog(parent), ui(new Ui::MainDialog)
 {
     logFile = 0;
+    overtoneAnalyzer = 0;
 
     ui->setupUi(this);
     layout()->setSizeConstraint(QLayout::SetFixedSize);
@@ -24,6 +25,7 @@ MainDialog::MainDialog(QWidget *parent) : QDialog(parent), ui(new Ui::MainDialog
     connect(analysisShowShortcut,SIGNAL(activated()),this,SLOT(showAnalysisDialog()));
     connect(ui->logCheckBox,SIGNAL(toggled(bool)),this,SLOT(setLogging(bool)));
     connect(ui->logButton,SIGNAL(clicked()),this,SLOT(selectLogFile()));
+    connect(ui->trackingCheckBox,SIGNAL(toggled(bool)),this,SLOT(setTracking(bool)));
     connect(ui->reloadButton,SIGNAL(clicked()),this,SLOT(loadInstruments()));
 
     QList<QAudioDeviceInfo> devices = QAudioDeviceInfo::availableDevices(QAudio::AudioInput);
@@ -89,6 +91,8 @@ void MainDialog::instrumentChanged(int index)
     InstrumentModel im = ui->instrumentCombo->itemData(index).value<InstrumentModel>();
     currentInstrument = im.model;
     ui->instrumentNameEdit->setText(ui->instrumentCombo->currentText());
+    if(overtoneAnalyzer)
+        overtoneAnalyzer->setWindowOrder(WindowOrderForInstrument(ui->instrumentCombo->currentText()));
 }
 
 void MainDialog::initializeAudio()
@@ -107,6 +111,8 @@ void MainDialog::initializeAudio()
     }
 
     overtoneAnalyzer = new OvertoneAnalyzer(m_format,this);
+    overtoneAnalyzer->setAnalysisMode(StreamingAnalysis); //Fresh result every hop instead of every block.
+    overtoneAnalyzer->setWindowOrder(WindowOrderForInstrument(ui->instrumentCombo->currentText()));
     connect(overtoneAnalyzer, SIGNAL(update()), this, SLOT(refreshDisplay()));
 
     createAudioInput();
@@ -204,12 +210,19 @@ void MainDialog::refreshDisplay()
                  .arg(overtoneAnalyzer->best().at(4).second)
                  .arg(volume4));
 
-    if(logFile) {
+    //Tracked overtones sit on k * f0 by construction, their ratios are not measurements.
+    if(logFile && overtoneAnalyzer->analysisMode() != HarmonicTracking) {
         QTextStream ts(logFile);
         ts << logLine;
     }
 
 
+    //The instrument models come from EAC peaks, tracked ratios can't be compared to them.
+    if(overtoneAnalyzer->analysisMode() == HarmonicTracking) {
+        ui->percentErrorBar->setValue(0);
+        return;
+    }
+
     double similarity = cosineSimilarity(currentVector,currentInstrument);
     qWarning() << similarity;
 
@@ -237,6 +250,12 @@ void MainDialog::toggleAdvanced()
     ui->advancedFrame->setVisible(!ui->advancedFrame->isVisible());
 }
 
+void MainDialog::setTracking(bool track)
+{
+    if(overtoneAnalyzer)
+        overtoneAnalyzer->setAnalysisMode(track ? HarmonicTracking : StreamingAnalysis);
+}
+
 void MainDialog::setLogging(bool log)
 {
     if(logFile) {
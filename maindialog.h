@@ -28,6 +28,7 @@ private slots:
     void refreshDisplay();
     void toggleAdvanced();
     void setLogging(bool log);
+    void setTracking(bool track);
     void selectLogFile();
 
     void pushData();
@@ -1,27 +1,56 @@
 #include <cmath>
+#include <cstring>
 #include <QtCore>
 #include <QtEndian>
 #include <QDebug>
 #include "overtoneanalyzer.h"
 #include "utils.h"
+#include "ffft/FFTRealPower.h"
 
-OvertoneAnalyzer::OvertoneAnalyzer(QAudioFormat format, QObject *parent) : QIODevice(parent), m_format(format)
+OvertoneAnalyzer::OvertoneAnalyzer(QAudioFormat format, QObject *parent) : QIODevice(parent), m_format(format), m_ring(4*FFT_SIZE)
 {
     qRegisterMetaType<PointList>("PointList");
-    qRegisterMetaType<const char*>("const char*");
+    qRegisterMetaType<QVector<DataType> >("QVector<DataType>");
 
     m_maxAmplitude = 1.0;
 
     qWarning() << "Overtone analyzer operating with:";
     qWarning() << formatToString(format);
 
-    ioBuffer.setBuffer(&buffer);
-    ioBuffer.open(QIODevice::ReadWrite);
-
-    analysisThread = new AnalysisThread(this,m_format);
+    analysisThread = new AnalysisThread(this,m_format,&m_ring);
     connect(analysisThread,SIGNAL(calculationComplete(PointList)),this,SLOT(calculationComplete(PointList)));
+    connect(analysisThread,SIGNAL(calculationSkipped()),this,SLOT(calculationSkipped()));
 
     processing = false;
+    m_windowSize = 1 << DEFAULT_WINDOW_ORDER;
+    setAnalysisMode(BlockAnalysis);
+}
+
+void OvertoneAnalyzer::setAnalysisMode(AnalysisMode mode)
+{
+    m_mode = mode;
+    const int sampleBytes = m_format.channelCount() * (m_format.sampleSize() / 8);
+    m_triggerBytes = (mode == BlockAnalysis) ? FFT_SIZE : (m_windowSize/2) * sampleBytes;
+
+    QMetaObject::invokeMethod(analysisThread,"setAnalysisMode",Qt::AutoConnection,Q_ARG(int,mode));
+}
+
+void OvertoneAnalyzer::setWindowOrder(int order)
+{
+    if(!ffft::FFTRealFixLenFactory::is_supported(order)) {
+        qWarning() << "Unsupported window order" << order << "- keeping" << m_windowSize << "samples.";
+        return;
+    }
+
+    m_windowSize = 1 << order;
+    setAnalysisMode(m_mode); //Hop size follows the window.
+
+    QMetaObject::invokeMethod(analysisThread,"setWindowOrder",Qt::AutoConnection,Q_ARG(int,order));
+}
+
+void OvertoneAnalyzer::setPreFilter(const QVector<DataType> &taps)
+{
+    QMetaObject::invokeMethod(analysisThread,"setPreFilter",Qt::AutoConnection,Q_ARG(QVector<DataType>,taps));
 }
 
 void OvertoneAnalyzer::start()
@@ -43,17 +72,12 @@ qint64 OvertoneAnalyzer::readData(char *data, qint64 maxlen)
 
 qint64 OvertoneAnalyzer::writeData(const char *data, qint64 len)
 {
-    ioBuffer.write(data,len);
-    if(buffer.size() > FFT_SIZE && !processing) {
+    m_ring.write(data,len); //Only fails (and counts an overrun) when the analyzer is a whole ring behind.
+    if(m_ring.bytesAvailable() >= m_triggerBytes && !processing) {
         processing = true;
 
-        buffer.resize(FFT_SIZE);
-
-        //This will call calculateVector in a separate thread.
-        QMetaObject::invokeMethod(analysisThread,"calculateVector",
-                                  Qt::AutoConnection,
-                                  Q_ARG(const char*,buffer.constData()),
-                                  Q_ARG(qint64,FFT_SIZE));
+        //This will call calculateVector in a separate thread, which reads straight out of the ring.
+        QMetaObject::invokeMethod(analysisThread,"calculateVector",Qt::AutoConnection);
     }
 
     return len;
@@ -67,32 +91,41 @@ void OvertoneAnalyzer::calculationComplete(PointList points)
     m_maxAmplitude = points.first().second;
     m_best = points;
 
-    buffer.clear();
-    ioBuffer.seek(0);
     emit update();
 }
 
-AnalysisThread::AnalysisThread(QObject *parent, QAudioFormat format) : QObject(parent), m_format(format)
+void OvertoneAnalyzer::calculationSkipped()
+{
+    processing = false;
+}
+
+AnalysisThread::AnalysisThread(QObject *parent, QAudioFormat format, RingBuffer *ring) :
+    QObject(parent),
+    m_window(m_arena), m_input(m_arena), m_output(m_arena),
+    m_batchInput(m_arena), m_batchOutput(m_arena), m_workspace(m_arena),
+    m_ring(ring), m_format(format)
 {
     m_numSamples = SAMPLES;
-    m_window.resize(WINDOW_SIZE);
+    m_wholeInput.resize(FFT_SIZE / ((m_format.sampleSize() / 8) * m_format.channelCount()));
+    m_mode = BlockAnalysis;
+    m_preFilterOn = false;
+    m_pitch = 0.0;
+    m_lockPower = 0.0;
+    fft_object = 0;
+    m_evenFft = 0;
+
+    setWindowOrder(DEFAULT_WINDOW_ORDER);
 
     thread = new QThread(this);
     setParent(0);
     moveToThread(thread);
 
     thread->start(QThread::HighestPriority);
-
-    calculateWindow();
-    fft_object = new ffft::FFTRealFixLen<11>();
-    m_output.resize(WINDOW_SIZE);
-    m_input.resize(WINDOW_SIZE);
 }
 
 AnalysisThread::~AnalysisThread()
 {
     delete thread;
-    delete fft_object;
 }
 
 qreal AnalysisThread::pcmToReal(qint32 pcm)
@@ -134,30 +167,8 @@ void AnalysisThread::assignValueByFormat(qint32 &value, const unsigned char *ptr
 
 void AnalysisThread::calculateWindow() //Hanning Window
 {
-    for(int i = 0; i < WINDOW_SIZE; i++) {
-        m_window[i] = 0.5 * (1 - qCos((2 * M_PI * i) / (WINDOW_SIZE - 1)));
-    }
-}
-
-void putBinInFloats(qint32 bin, float *f, qint32 len, float &real, float &imag) {
-    if(bin == 0 || bin == len/2) {
-        real = imag = 0.0;
-    } else if(bin < len/2) {
-        real = f[bin];
-        imag = f[len/2+bin];
-    } else {
-        real = f[len-bin];
-        imag = -f[3/2*len-bin];
-    }
-}
-
-void splitFFT(QVector<DataType> out1, QVector<DataType> &out_r, QVector<DataType> &out_i)
-{
-    for(int i = 0; i < WINDOW_SIZE; i++) { //Split into real/imag.
-        float r, j;
-        putBinInFloats(i,out1.data(),WINDOW_SIZE,r,j);
-        out_r[i] = r;
-        out_i[i] = j;
+    for(int i = 0; i < m_windowSize; i++) {
+        m_window[i] = 0.5 * (1 - qCos((2 * M_PI * i) / (m_windowSize - 1)));
     }
 }
 
@@ -187,67 +198,333 @@ QList<QPointF> findLocalMaxima(QList<QPointF> func)
     return ret;
 }
 
-void AnalysisThread::calculateVector(const char* data, qint64 len)
+void AnalysisThread::setAnalysisMode(int mode)
+{
+    m_mode = AnalysisMode(mode);
+    resetStreaming();
+}
+
+//Swaps in the shared FFTRealFixLen<order> plan and resizes every per-window
+//buffer. Runs on the analysis thread, so no calculation is ever in flight here.
+void AnalysisThread::setWindowOrder(int order)
+{
+    if(!ffft::FFTRealFixLenFactory::is_supported(order))
+        return;
+
+    //Everything from the arena goes before it is rewound.
+    m_window.clear();
+    m_input.clear();
+    m_output.clear();
+    m_batchInput.clear();
+    m_batchOutput.clear();
+    m_workspace.clear();
+    m_arena.reset();
+
+    //Only the first stream with this order builds the plan, the others share it.
+    typedef ffft::FFTRealPlanCache<DataType> PlanCache;
+    fft_object = &PlanCache::use_fixlen_plan(order);
+    m_evenFft = &PlanCache::use_even_plan(1 << order);
+    m_workspace.resize(qMax(fft_object->get_workspace_len(),m_evenFft->get_workspace_len()));
+
+    m_windowSize = 1 << order;
+    m_historyWindows = (SAMPLES - m_windowSize) / (m_windowSize/2) + 1;
+
+    m_window.resize(m_windowSize);
+    m_input.resize(m_windowSize);
+    m_output.resize(m_windowSize);
+    m_frame.resize(m_windowSize);
+    m_history.resize(m_historyWindows * m_windowSize/2);
+    m_historySum.resize(m_windowSize/2);
+
+    const int maxWindows = (m_wholeInput.size() - m_windowSize) / (m_windowSize/2) + 1;
+    m_batchInput.resize(qMax(maxWindows,1) * m_windowSize);
+    m_batchOutput.resize(m_batchInput.size());
+
+    calculateWindow();
+    resetStreaming();
+}
+
+//The filter sees the stream in order whatever the mode, and delays it by one
+//block. Runs on the analysis thread, between two calculations.
+void AnalysisThread::setPreFilter(QVector<DataType> taps)
+{
+    m_preFilterOn = !taps.isEmpty();
+    if(m_preFilterOn)
+        m_preFilter.set_impulse(taps.constData(),taps.size());
+}
+
+void AnalysisThread::resetStreaming()
+{
+    m_frameFill = 0;
+    m_historyPos = 0;
+    m_historyCount = 0;
+    m_historySum.fill(0.0);
+    m_locked = false;
+    m_hopsSinceAcquire = 0;
+}
+
+int AnalysisThread::readSamples(DataType *dest, int maxSamples)
 {
     const int channelBytes = m_format.sampleSize() / 8;
     const int sampleBytes = m_format.channelCount() * channelBytes;
-    const int numSamples = len / sampleBytes;
 
-    const unsigned char *ptr = reinterpret_cast<const unsigned char*>(data);
+    const char *first, *second;
+    int firstLen, secondLen;
+    const int numSamples = m_ring->peek(maxSamples * sampleBytes,first,firstLen,second,secondLen) / sampleBytes;
 
-    QVector<DataType> wholeInput(numSamples);
+    //Decode in place from the ring. Its size is a power of two, so no sample straddles the wrap.
+    const unsigned char *ptr = reinterpret_cast<const unsigned char*>(first);
+    const unsigned char *end = ptr + firstLen;
     for(int i = 0; i < numSamples; i++) {
+        if(ptr == end)
+            ptr = reinterpret_cast<const unsigned char*>(second);
         qint32 value = 0;
         assignValueByFormat(value,ptr);
-        wholeInput[i] = pcmToReal(qint16(value));
+        dest[i] = pcmToReal(qint16(value));
         ptr += channelBytes;
     }
+    m_ring->release(numSamples * sampleBytes);
 
-    QVector<DataType> meanProcessed(WINDOW_SIZE/2); meanProcessed.resize(WINDOW_SIZE/2);
-    QVector<DataType> out_r(WINDOW_SIZE); out_r.resize(WINDOW_SIZE);
-    QVector<DataType> out_i(WINDOW_SIZE); out_i.resize(WINDOW_SIZE);
+    if(m_preFilterOn)
+        m_preFilter.process(dest,dest,numSamples);
 
-    int half = WINDOW_SIZE/2;
+    return numSamples;
+}
 
-    int start = 0;
-    int windowsCalculated = 0;
+void AnalysisThread::calculateVector()
+{
+    if(m_mode == StreamingAnalysis)
+        calculateStreaming();
+    else if(m_mode == HarmonicTracking)
+        calculateHarmonics();
+    else
+        calculateBlock();
+}
 
-    //Enhanced autocorrelation algorithm by Tolonen and Karjalainen.
+void AnalysisThread::calculateBlock()
+{
+    DataType *wholeInput = m_wholeInput.data();
+    const int numSamples = readSamples(wholeInput,m_wholeInput.size());
+    if(numSamples < m_windowSize) {
+        emit calculationSkipped();
+        return;
+    }
+
+    const int half = m_windowSize/2;
+    QVector<DataType> meanProcessed(half);
 
-    while(start + WINDOW_SIZE <= numSamples) {
-        for(int i = 0; i < WINDOW_SIZE; i++)
-            m_input[i] = m_window[i] * wholeInput[start+i];
+    //Windows are staggered by half a window and all go through the FFT at once.
+    const int windowsCalculated = (numSamples - m_windowSize) / half + 1;
+    accumulateEACBatch(wholeInput,windowsCalculated,meanProcessed.data());
 
-        fft_object->do_fft(m_output.data(),m_input.data());
-        splitFFT(m_output,out_r,out_i); //FFTReal puts everything in one array. This function splits things into the real and imaginary arrays.
+    for(int i = 0; i < half; i++) //Find the mean.
+        meanProcessed[i] /= windowsCalculated;
 
-        for(int i = 0; i < WINDOW_SIZE; i++)
-            m_input[i] = pow((out_r[i]*out_r[i]) + (out_i[i]*out_i[i]),1.0/3.0); //Tolonen and Karjalainen recommend cube root, rather than square.
+    emitPeaks(meanProcessed);
+}
 
-        fft_object->do_fft(m_output.data(),m_input.data());
-        splitFFT(m_output,out_r,out_i);
+//Each hop of half a window of new samples costs a single window: its EAC replaces
+//the oldest one in the history, and the mean is kept as a running sum.
+void AnalysisThread::calculateStreaming()
+{
+    const int half = m_windowSize/2;
+    const int sampleBytes = m_format.channelCount() * (m_format.sampleSize() / 8);
+
+    bool updated = false;
+    while(m_ring->bytesAvailable() >= half * sampleBytes) {
+        //Slide the frame by one hop.
+        if(m_frameFill == m_windowSize) {
+            memmove(m_frame.data(),m_frame.data() + half,half * sizeof(DataType));
+            m_frameFill -= half;
+        }
+        m_frameFill += readSamples(m_frame.data() + m_frameFill,half);
+        if(m_frameFill < m_windowSize)
+            continue;
+
+        DataType *slot = m_history.data() + m_historyPos * half;
+        if(m_historyCount == m_historyWindows) {
+            for(int i = 0; i < half; i++) //Drop the oldest window.
+                m_historySum[i] -= slot[i];
+        } else {
+            m_historyCount++;
+        }
 
+        calculateEAC(m_frame.data(),slot);
         for(int i = 0; i < half; i++)
-            meanProcessed[i] += out_r[i];
+            m_historySum[i] += slot[i];
+
+        m_historyPos = (m_historyPos + 1) % m_historyWindows;
+        if(m_historyPos == 0) { //Rebuild the sum once per lap so rounding never piles up.
+            m_historySum.fill(0.0);
+            for(int w = 0; w < m_historyCount; w++) {
+                const DataType *eac = m_history.constData() + w * half;
+                for(int i = 0; i < half; i++)
+                    m_historySum[i] += eac[i];
+            }
+        }
+        updated = true;
+    }
 
-        start += half; //Stagger the windows.
-        windowsCalculated++;
+    if(!updated) {
+        emit calculationSkipped();
+        return;
     }
 
-    for(int i = 0; i < half; i++) //Find the mean.
-        meanProcessed[i] /= windowsCalculated;
+    QVector<DataType> meanProcessed(half);
+    for(int i = 0; i < half; i++)
+        meanProcessed[i] = m_historySum[i] / m_historyCount;
+
+    emitPeaks(meanProcessed);
+}
+
+//Once the EAC has found a pitch, a hop only feeds the new samples to the Goertzel
+//bank on its first harmonics: a few multiply-adds per sample instead of two FFTs
+//per window. The EAC of the latest window is redone every REACQUIRE_HOPS hops to
+//follow the pitch, and right away when the harmonics fade below a tenth of their
+//peak (the note ended or changed). Until a pitch is locked, and between a retune
+//and the end of the first block, the EAC peaks are emitted instead.
+void AnalysisThread::calculateHarmonics()
+{
+    const int half = m_windowSize/2;
+    const int sampleBytes = m_format.channelCount() * (m_format.sampleSize() / 8);
+
+    bool measured = false;
+    bool acquired = false;
+    QList<QPointF> peaks;
+    while(m_ring->bytesAvailable() >= half * sampleBytes) {
+        if(m_frameFill == m_windowSize) {
+            memmove(m_frame.data(),m_frame.data() + half,half * sizeof(DataType));
+            m_frameFill -= half;
+        }
+        const DataType *fresh = m_frame.constData() + m_frameFill;
+        const int count = readSamples(m_frame.data() + m_frameFill,half);
+        m_frameFill += count;
+
+        if(m_locked && m_harmonics.process(fresh,count)) {
+            double power = 0.0;
+            for(int k = 0; k < TRACKED_HARMONICS; k++)
+                power += m_harmonics.get_power(k);
+            m_lockPower = qMax(m_lockPower,power);
+            if(power < m_lockPower / 10)
+                m_locked = false;
+            else
+                measured = true;
+        }
+        if(m_frameFill < m_windowSize)
+            continue;
+
+        if(m_locked && ++m_hopsSinceAcquire < REACQUIRE_HOPS)
+            continue;
+
+        QVector<DataType> eac(half);
+        calculateEAC(m_frame.constData(),eac.data());
+        peaks = findPeaks(eac);
+        if(tuneHarmonics(peaks.at(0).x()))
+            measured = false; //The bank restarted, its powers are gone.
+        m_hopsSinceAcquire = 0;
+        acquired = true;
+    }
+
+    if(m_locked && measured) {
+        QList<QPointF> points;
+        for(int k = 0; k < TRACKED_HARMONICS; k++)
+            points.append(QPointF((k + 1) * m_pitch,qSqrt(m_harmonics.get_power(k))));
+        emitPoints(points);
+    } else if(acquired) {
+        emitPoints(peaks);
+    } else {
+        emit calculationSkipped();
+    }
+}
+
+//Locks the resonators on pitch, the strongest EAC peak. A pitch within 3% of the
+//tracked one keeps them running, anything else restarts them. Returns true when
+//they were retuned or dropped.
+bool AnalysisThread::tuneHarmonics(qreal pitch)
+{
+    const qreal sampleRate = m_format.sampleRate();
+    if(pitch <= 0.0 || pitch * TRACKED_HARMONICS >= sampleRate / 2) { //No peak, or overtones past Nyquist.
+        const bool wasLocked = m_locked;
+        m_locked = false;
+        return wasLocked;
+    }
+    if(m_locked && qAbs(pitch - m_pitch) <= 0.03 * m_pitch)
+        return false;
+
+    //Whole periods, and short enough that a 3% error stays within the main
+    //lobe of the highest harmonic.
+    m_harmonics.set_harmonics(pitch / sampleRate,TRACKED_HARMONICS,m_windowSize/8);
+    m_pitch = pitch;
+    m_lockPower = 0.0;
+    m_locked = true;
+    return true;
+}
+
+//Enhanced autocorrelation algorithm by Tolonen and Karjalainen, for one window.
+//Writes the first m_windowSize/2 lags to eac.
+void AnalysisThread::calculateEAC(const DataType *samples, DataType *eac)
+{
+    for(int i = 0; i < m_windowSize; i++)
+        m_input[i] = m_window[i] * samples[i];
+
+    //Tolonen and Karjalainen recommend the cube root of the power, rather than the square.
+    fft_object->do_power_spectrum(&m_output[0],&m_input[0],DataType(1.0/3.0),&m_workspace[0]);
+
+    //The powers are half of an even spectrum, so the second FFT only computes the real
+    //parts of its first half: the lags. DC and Nyquist are left out, and so is lag 0.
+    m_output[0] = 0.0;
+    m_output[m_windowSize/2] = 0.0;
+    m_evenFft->do_fft(eac,&m_output[0],m_windowSize/2,&m_workspace[0]);
+    eac[0] = 0.0;
+}
+
+//calculateEAC for count windows staggered by half a window, with the first FFT
+//batched so the SIMD lanes each carry a window. Adds every window's EAC to eacSum.
+void AnalysisThread::accumulateEACBatch(const DataType *samples, int count, DataType *eacSum)
+{
+    const int half = m_windowSize/2;
+    DataType *input = &m_batchInput[0];
+    DataType *output = &m_batchOutput[0];
+
+    for(int w = 0; w < count; w++) {
+        const DataType *src = samples + w * half;
+        DataType *dest = input + w * m_windowSize;
+        for(int i = 0; i < m_windowSize; i++)
+            dest[i] = m_window[i] * src[i];
+    }
+
+    fft_object->do_fft_batch(output,input,count,&m_workspace[0]);
+
+    for(int w = 0; w < count; w++) {
+        DataType *spectrum = output + w * m_windowSize;
+        ffft::FFTRealPower<DataType>::compute(spectrum,spectrum,m_windowSize,DataType(1.0/3.0));
+        spectrum[0] = 0.0;
+        spectrum[half] = 0.0;
+        m_evenFft->do_fft(spectrum,spectrum,half,&m_workspace[0]); //The lags replace the powers.
+
+        for(int i = 1; i < half; i++)
+            eacSum[i] += spectrum[i];
+    }
+}
+
+//Strongest four peaks of an EAC, as (frequency, strength), (0,0) when
+//there are fewer. Clips meanProcessed in place.
+QList<QPointF> AnalysisThread::findPeaks(QVector<DataType> &meanProcessed)
+{
+    const int half = meanProcessed.size();
+    QVector<DataType> clipped(half);
 
     for(int i = 0; i < half; i++) { //Clip at 0, copy
         if(meanProcessed[i] < 0.0)
             meanProcessed[i] = 0.0;
-        out_i[i] = meanProcessed[i];
+        clipped[i] = meanProcessed[i];
     }
 
     for (int i = 0; i < half; i++)
         if ((i % 2) == 0)
-            meanProcessed[i] -= out_i[i / 2];
+            meanProcessed[i] -= clipped[i / 2];
         else
-            meanProcessed[i] -= ((out_i[i / 2] + out_i[i / 2 + 1]) / 2);
+            meanProcessed[i] -= ((clipped[i / 2] + clipped[i / 2 + 1]) / 2);
 
     for(int i = 0; i < half; i++) //Clip at 0, no copy
         if(meanProcessed[i] < 0.0)
@@ -259,8 +536,16 @@ void AnalysisThread::calculateVector(const char* data, qint64 len)
         points.append(QPointF(frequency,meanProcessed[i]));
     }
 
-    points = findLocalMaxima(points);
+    return findLocalMaxima(points);
+}
 
+void AnalysisThread::emitPeaks(QVector<DataType> &meanProcessed)
+{
+    emitPoints(findPeaks(meanProcessed));
+}
+
+void AnalysisThread::emitPoints(const QList<QPointF> &points)
+{
     emit calculationComplete(PointList() << qMakePair(0.5,1.0)
                              << qMakePair((double)points.at(0).x(),(double)points.at(0).y())
                              << qMakePair((double)points.at(1).x(),(double)points.at(1).y())
@@ -5,40 +5,106 @@
 #include <QAudioFormat>
 #include <QVector>
 #include <QPair>
+#include <QList>
+#include <QPointF>
 #include <QThread>
-#include <QBuffer>
-#include "ffft/FFTRealFixLen.h"
+#include "ffft/AllocatorArena.h"
+#include "ffft/DynArray.h"
+#include "ffft/FFTConvolver.h"
+#include "ffft/FFTRealPlanCache.h"
+#include "ffft/GoertzelBank.h"
+#include "ringbuffer.h"
+#include "utils.h"
 
 typedef float DataType;
 typedef QVector<QPair<double, double> > PointList;
 
-const int WINDOW_SIZE = 2048;
+const int DEFAULT_WINDOW_ORDER = 11; //2048 samples; instruments may pick 2^9 to 2^14.
+const int PRE_FILTER_ORDER = 9; //FFT of the pre-filter: blocks of 256 samples, its latency.
+const int TRACKED_HARMONICS = 4; //The fundamental and the overtones the display compares.
+const int REACQUIRE_HOPS = 8; //Hops between two pitch checks while tracking.
+
+enum AnalysisMode {
+    BlockAnalysis,    //One result per FFT_SIZE block, averaging every staggered window in it.
+    StreamingAnalysis, //One result per hop of half a window, same averaging span.
+    HarmonicTracking  //Per hop too, Goertzel resonators on the harmonics of the EAC pitch.
+                      //Overtones are reported at k * f0: only their amplitudes are measured.
+};
 
 class AnalysisThread : public QObject
 {
     Q_OBJECT
 public:
-    AnalysisThread(QObject *parent, QAudioFormat format);
+    AnalysisThread(QObject *parent, QAudioFormat format, RingBuffer *ring);
     ~AnalysisThread();
 
 public slots:
-    void calculateVector(const char* data, qint64 len);
+    void calculateVector();
+    void setAnalysisMode(int mode);
+    void setWindowOrder(int order);
+    void setPreFilter(QVector<DataType> taps);
 
 signals:
     void calculationComplete(PointList points);
+    void calculationSkipped();
 
 private:
     void calculateWindow();
+    int readSamples(DataType *dest, int maxSamples);
+    void calculateBlock();
+    void calculateStreaming();
+    void calculateHarmonics();
+    void calculateEAC(const DataType *samples, DataType *eac);
+    void accumulateEACBatch(const DataType *samples, int count, DataType *eacSum);
+    QList<QPointF> findPeaks(QVector<DataType> &meanProcessed);
+    bool tuneHarmonics(qreal pitch);
+    void emitPeaks(QVector<DataType> &meanProcessed);
+    void emitPoints(const QList<QPointF> &points);
+
+    void resetStreaming();
 
     //FFT stuff
     int m_numSamples;
+    int m_windowSize;
+    int m_historyWindows; //Windows averaged per result.
     void calculateHanningWindow();
-    QVector<DataType> m_window;
-    QVector<DataType> m_input;
-    QVector<DataType> m_output;
+    //The window/FFT buffers and the FFT workspace are carved from one
+    //arena, rewound on each window order change. Declared first so it outlives them.
+    ffft::AllocatorArena m_arena;
+    ffft::DynArray<DataType> m_window;
+    ffft::DynArray<DataType> m_input;
+    ffft::DynArray<DataType> m_output;
+    ffft::DynArray<DataType> m_batchInput; //Every staggered window of a block, one after the other.
+    ffft::DynArray<DataType> m_batchOutput;
+    ffft::DynArray<DataType> m_workspace; //Scratch space for the shared plan.
+
+    //Optional FIR filter on the decoded stream, ahead of the analysis.
+    ffft::FFTConvolver<PRE_FILTER_ORDER,DataType> m_preFilter;
+    bool m_preFilterOn;
 
     QThread *thread;
-    ffft::FFTRealFixLen<11> *fft_object;
+    const ffft::FFTRealFixLenIface *fft_object; //Unrolled FFTRealFixLen<N> picked at runtime, shared by all streams.
+    const ffft::FFTRealPlanCache<DataType>::EvenPlanType *m_evenFft; //Second EAC transform, only the lags we read. Shared too.
+    RingBuffer *m_ring;
+    QVector<DataType> m_wholeInput;
+
+    //Streaming state: the latest window of samples and the EAC of the last
+    //m_historyWindows windows, with their running sum.
+    AnalysisMode m_mode;
+    QVector<DataType> m_frame;
+    int m_frameFill;
+    QVector<DataType> m_history;
+    QVector<double> m_historySum;
+    int m_historyPos;
+    int m_historyCount;
+
+    //Tracking state: the resonators follow m_pitch (Hz) while m_locked. m_lockPower
+    //is the highest total power of the harmonics since the last retune.
+    ffft::GoertzelBank<DataType> m_harmonics;
+    bool m_locked;
+    qreal m_pitch;
+    double m_lockPower;
+    int m_hopsSinceAcquire;
 
     inline void assignValueByFormat(qint32 &in, const unsigned char *ptr);
     inline qreal pcmToReal(qint32 pcm);
@@ -64,11 +130,27 @@ public:
 
     PointList best() const { return m_best; }
 
+    void setAnalysisMode(AnalysisMode mode);
+    AnalysisMode analysisMode() const { return m_mode; }
+
+    void setWindowOrder(int order); //log2 of the window length.
+    int windowSize() const { return m_windowSize; }
+
+    //FIR filter run on the samples before the analysis (pre-emphasis, hum,
+    //band-pass...), any length. No taps turns it off.
+    void setPreFilter(const QVector<DataType> &taps);
+
+    //Audio chunks dropped because the analyzer fell behind, and analysis passes
+    //that found less data than they asked for.
+    int overruns() const { return m_ring.overruns(); }
+    int underruns() const { return m_ring.underruns(); }
+
 signals:
     void update();
 
 private slots:
     void calculationComplete(PointList points);
+    void calculationSkipped();
 
 private:
     const QAudioFormat m_format;
@@ -76,10 +158,12 @@ private:
     qreal m_level;
 
     PointList m_best;
-    QByteArray buffer;
-    QBuffer ioBuffer;
+    RingBuffer m_ring;
     AnalysisThread* analysisThread;
 
+    AnalysisMode m_mode;
+    int m_windowSize;
+    int m_triggerBytes;
     bool processing;
 };
 
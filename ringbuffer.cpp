@@ -0,0 +1,75 @@
+#include "ringbuffer.h"
+#include <cstring>
+
+RingBuffer::RingBuffer(int capacity)
+{
+    m_capacity = 1;
+    while(m_capacity < capacity)
+        m_capacity <<= 1;
+    m_mask = m_capacity - 1;
+    m_indexMask = 2*m_capacity - 1;
+
+    m_data = static_cast<char*>(qMallocAligned(m_capacity, CACHE_LINE_SIZE));
+    memset(m_data, 0, m_capacity); //Touch every page now rather than in the audio callback.
+
+    m_writePos.store(0);
+    m_overruns.store(0);
+    m_readPos.store(0);
+    m_underruns.store(0);
+}
+
+RingBuffer::~RingBuffer()
+{
+    qFreeAligned(m_data);
+}
+
+bool RingBuffer::write(const char *data, int len)
+{
+    const int writePos = m_writePos.load();
+    const int readPos = m_readPos.loadAcquire();
+    if(len > m_capacity - used(writePos, readPos)) {
+        m_overruns.fetchAndAddRelaxed(1);
+        return false;
+    }
+
+    const int offset = writePos & m_mask;
+    const int firstLen = qMin(len, m_capacity - offset);
+    memcpy(m_data + offset, data, firstLen);
+    memcpy(m_data, data + firstLen, len - firstLen);
+
+    m_writePos.storeRelease((writePos + len) & m_indexMask);
+    return true;
+}
+
+int RingBuffer::bytesFree() const
+{
+    return m_capacity - used(m_writePos.load(), m_readPos.loadAcquire());
+}
+
+int RingBuffer::bytesAvailable() const
+{
+    return used(m_writePos.loadAcquire(), m_readPos.load());
+}
+
+int RingBuffer::peek(int len, const char *&first, int &firstLen, const char *&second, int &secondLen)
+{
+    const int readPos = m_readPos.load();
+    const int available = used(m_writePos.loadAcquire(), readPos);
+    if(len > available) {
+        m_underruns.fetchAndAddRelaxed(1);
+        len = available;
+    }
+
+    const int offset = readPos & m_mask;
+    first = m_data + offset;
+    firstLen = qMin(len, m_capacity - offset);
+    second = m_data;
+    secondLen = len - firstLen;
+    return len;
+}
+
+void RingBuffer::release(int len)
+{
+    Q_ASSERT(len <= bytesAvailable());
+    m_readPos.storeRelease((m_readPos.load() + len) & m_indexMask);
+}
@@ -0,0 +1,53 @@
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+
+#include <QtGlobal>
+#include <QAtomicInt>
+
+const int CACHE_LINE_SIZE = 64;
+
+//Single-producer/single-consumer byte FIFO. The audio side calls write(), the
+//analysis thread calls peek()/release(). Neither side ever locks or allocates.
+class RingBuffer
+{
+public:
+    explicit RingBuffer(int capacity); //Rounded up to a power of two.
+    ~RingBuffer();
+
+    int capacity() const { return m_capacity; }
+
+    //Producer side. Chunks that do not fit are dropped whole, so frames stay aligned.
+    bool write(const char *data, int len);
+    int bytesFree() const;
+
+    //Consumer side. peek() hands out up to two contiguous regions (the second
+    //one is non-empty when the data wraps around the end of the storage).
+    int bytesAvailable() const;
+    int peek(int len, const char *&first, int &firstLen, const char *&second, int &secondLen);
+    void release(int len);
+
+    int overruns() const { return m_overruns.load(); }
+    int underruns() const { return m_underruns.load(); }
+
+private:
+    int used(int writePos, int readPos) const { return (writePos - readPos) & m_indexMask; }
+
+    char *m_data;
+    int m_capacity;
+    int m_mask;      //m_capacity - 1
+    int m_indexMask; //2*m_capacity - 1, positions carry one extra wrap bit.
+
+    //Each side owns one cache line so the two threads never share one.
+    char m_pad0[CACHE_LINE_SIZE];
+    QAtomicInt m_writePos;
+    QAtomicInt m_overruns;
+    char m_pad1[CACHE_LINE_SIZE - 2*sizeof(QAtomicInt)];
+    QAtomicInt m_readPos;
+    QAtomicInt m_underruns;
+    char m_pad2[CACHE_LINE_SIZE - 2*sizeof(QAtomicInt)];
+
+    RingBuffer(const RingBuffer &);
+    RingBuffer &operator=(const RingBuffer &);
+};
+
+#endif // RINGBUFFER_H
@@ -112,3 +112,20 @@ QString PitchName(double frequency, bool spellFlat)
     ret += QString("%1").arg((((int)(FreqToMIDInoteNumber(frequency) + 0.5) / 12) - 1));
     return ret;
 }
+
+//log2 of the analysis window length. Low instruments need long windows to
+//resolve their fundamental, high ones get short windows for lower latency.
+int WindowOrderForInstrument(const QString &name)
+{
+    const QString n = name.toLower();
+    if(n.contains("tuba"))
+        return 13;
+    if(n.contains("bari") || n.contains("bassoon") || n.contains("bass clarinet")
+            || n.contains("euphonium") || n.contains("trombone"))
+        return 12;
+    if(n.contains("violin") || n.contains("oboe"))
+        return 10;
+    if(n.contains("flute") || n.contains("piccolo"))
+        return 9;
+    return 11;
+}
@@ -12,5 +12,6 @@ QString formatToString(const QAudioFormat &format);
 double FreqToMIDInoteNumber(double freq);
 unsigned int PitchIndex(double pitchNum);
 QString PitchName(double frequency, bool spellFlat = true);
+int WindowOrderForInstrument(const QString &name);
 
 #endif // UTILS_H